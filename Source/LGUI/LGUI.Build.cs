@@ -55,6 +55,7 @@ public class LGUI : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"ImageWrapper",//LGUISpriteData async create from image file
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -27,6 +27,9 @@
 #include "Math/TransformCalculus2D.h"
 #include "Core/LGUICanvasCustomClip.h"
 #include "TextureResource.h"
+#include "RenderingThread.h"
+#include "Async/Async.h"
+#include "Core/LGUIProfiler.h"
 
 #if LGUI_CAN_DISABLE_OPTIMIZATION
 UE_DISABLE_OPTIMIZATION
@@ -61,6 +64,8 @@ ULGUICanvas::ULGUICanvas()
 	bShouldSortRenderableOrder = true;
 	bAnythingChangedForRenderTarget = true;
 	bPrevAnythingChangedForRenderTarget = true;
+	bRenderTargetNeedFullRedraw = true;
+	bPrevRenderTargetFullRedraw = true;
 
 	bIsViewProjectionMatrixDirty = true;
 
@@ -216,12 +221,19 @@ void ULGUICanvas::UpdateRootCanvas()
 					if (!renderTarget->GameThread_GetRenderTargetResource())
 					{
 						renderTarget->InitCustomFormat(renderTarget->SizeX, renderTarget->SizeY, EPixelFormat::PF_B8G8R8A8, false);
+						bRenderTargetNeedFullRedraw = true;
 					}
 				}
 #endif
-				if (RenderTargetViewExtension.IsValid())
+				if (RenderTargetUpdateMode != ELGUICanvasRenderTargetUpdateMode::Automatic)
 				{
-					RenderTargetViewExtension->UpdateRenderTargetRenderer(renderTarget);
+					bRenderTargetNeedFullRedraw = true;//user or material may change something that is not tracked
+				}
+				//only redraw changed region, skip if nothing changed
+				FIntRect DirtyRect;
+				if (CalculateRenderTargetDirtyRect(DirtyRect) && RenderTargetViewExtension.IsValid())
+				{
+					RenderTargetViewExtension->UpdateRenderTargetRenderer(renderTarget, DirtyRect);
 				}
 			}
 		}
@@ -246,6 +258,7 @@ void ULGUICanvas::UpdateRenderTarget(bool CallEvent)
 		renderTarget->AddressY = TextureAddress::TA_Clamp;
 		renderTarget->ClearColor = FLinearColor::Transparent;
 		renderTarget->InitCustomFormat(DesiredRenderTargetSize.X, DesiredRenderTargetSize.Y, EPixelFormat::PF_B8G8R8A8, false);
+		bRenderTargetNeedFullRedraw = true;
 		if (CallEvent)
 		{
 			OnRenderTargetCreatedOrChanged.Broadcast(renderTarget, true);
@@ -271,6 +284,7 @@ void ULGUICanvas::UpdateRenderTarget(bool CallEvent)
 			renderTarget->ClearColor = FLinearColor::Transparent;
 			renderTarget->InitCustomFormat(DesiredRenderTargetSize.X, DesiredRenderTargetSize.Y, EPixelFormat::PF_B8G8R8A8, false);
 			renderTarget->UpdateResourceImmediate();
+			bRenderTargetNeedFullRedraw = true;
 #if WITH_EDITOR
 			renderTarget->Modify();
 #endif
@@ -282,6 +296,103 @@ void ULGUICanvas::UpdateRenderTarget(bool CallEvent)
 	}
 }
 
+bool ULGUICanvas::CalculateRenderTargetDirtyRect(FIntRect& OutDirtyRect)
+{
+	bool bRedrawWhole = bRenderTargetNeedFullRedraw;
+	bRenderTargetNeedFullRedraw = false;
+	FBox DirtyBox = FBox(EForceInit::ForceInit);
+	CollectRenderTargetDirtyRegion_Recursive(DirtyBox, bRedrawWhole);//always collect, so UIMesh's dirty region is reset
+
+	FIntRect DirtyRect;
+	if (!bRedrawWhole && DirtyBox.IsValid)
+	{
+		//project dirty box to render target's pixel rect
+		const auto ViewProjectionMatrix = GetViewProjectionMatrix();
+		const FVector2D RenderTargetSize(renderTarget->SizeX, renderTarget->SizeY);
+		FVector2D MinPixel(MAX_flt, MAX_flt), MaxPixel(-MAX_flt, -MAX_flt);
+		FVector Corners[8];
+		DirtyBox.GetVertices(Corners);
+		for (auto& Corner : Corners)
+		{
+			auto ClipPosition = ViewProjectionMatrix.TransformFVector4(FVector4(Corner, 1.0f));
+			if (ClipPosition.W <= 0)//behind view, can't project
+			{
+				bRedrawWhole = true;
+				break;
+			}
+			auto Pixel = FVector2D(ClipPosition.X / ClipPosition.W * 0.5f + 0.5f, 0.5f - ClipPosition.Y / ClipPosition.W * 0.5f) * RenderTargetSize;
+			MinPixel = FVector2D::Min(MinPixel, Pixel);
+			MaxPixel = FVector2D::Max(MaxPixel, Pixel);
+		}
+		if (!bRedrawWhole)
+		{
+			//expand 1 pixel for antialiasing edge
+			DirtyRect.Min.X = FMath::Clamp(FMath::FloorToInt(MinPixel.X) - 1, 0, renderTarget->SizeX);
+			DirtyRect.Min.Y = FMath::Clamp(FMath::FloorToInt(MinPixel.Y) - 1, 0, renderTarget->SizeY);
+			DirtyRect.Max.X = FMath::Clamp(FMath::CeilToInt(MaxPixel.X) + 1, 0, renderTarget->SizeX);
+			DirtyRect.Max.Y = FMath::Clamp(FMath::CeilToInt(MaxPixel.Y) + 1, 0, renderTarget->SizeY);
+			if (DirtyRect.Area() <= 0)
+			{
+				DirtyRect = FIntRect();
+			}
+		}
+	}
+
+	auto ResultRect = DirtyRect;
+	if (PrevRenderTargetDirtyRect.Area() > 0)
+	{
+		if (ResultRect.Area() > 0)
+		{
+			ResultRect.Union(PrevRenderTargetDirtyRect);
+		}
+		else
+		{
+			ResultRect = PrevRenderTargetDirtyRect;
+		}
+	}
+	const bool bResultRedrawWhole = bRedrawWhole || bPrevRenderTargetFullRedraw;
+	bPrevRenderTargetFullRedraw = bRedrawWhole;
+	PrevRenderTargetDirtyRect = bRedrawWhole ? FIntRect() : DirtyRect;
+
+	if (bResultRedrawWhole)
+	{
+		OutDirtyRect = FIntRect();
+		return true;
+	}
+	OutDirtyRect = ResultRect;
+	return ResultRect.Area() > 0;
+}
+void ULGUICanvas::CollectRenderTargetDirtyRegion_Recursive(FBox& InOutDirtyBox, bool& InOutRedrawWhole)
+{
+	if (UIMesh.IsValid())
+	{
+		FBox MeshDirtyBox;
+		if (UIMesh->ConsumeDirtyRegion(MeshDirtyBox))
+		{
+			InOutDirtyBox += MeshDirtyBox;
+		}
+		else
+		{
+			InOutRedrawWhole = true;
+		}
+	}
+	for (auto& DrawcallItem : UIDrawcallList)
+	{
+		if (DrawcallItem->Type == EUIDrawcallType::PostProcess)//post process read and write outside of dirty rect, so it need whole render target
+		{
+			InOutRedrawWhole = true;
+			break;
+		}
+	}
+	for (auto& ChildCanvas : ChildrenCanvasArray)
+	{
+		if (ChildCanvas.IsValid())
+		{
+			ChildCanvas->CollectRenderTargetDirtyRegion_Recursive(InOutDirtyBox, InOutRedrawWhole);
+		}
+	}
+}
+
 void ULGUICanvas::EnsureDrawcallObjectReference()
 {
 	for (int i = 0; i < UIRenderableList.Num(); i++)
@@ -352,6 +463,10 @@ void ULGUICanvas::OnComponentDestroyed(bool bDestroyingHierarchy)
 	Super::OnComponentDestroyed(bDestroyingHierarchy);
 	if (UIMesh.IsValid())
 	{
+		if (RootCanvas.IsValid())
+		{
+			RootCanvas->bRenderTargetNeedFullRedraw = true;
+		}
 		UIMesh->DestroyComponent();
 		UIMesh = nullptr;
 	}
@@ -445,6 +560,10 @@ void ULGUICanvas::SetParentCanvas(ULGUICanvas* InParentCanvas)
 {
 	if (ParentCanvas != InParentCanvas)
 	{
+		if (RootCanvas.IsValid())
+		{
+			RootCanvas->bRenderTargetNeedFullRedraw = true;//this canvas is leaving prev hierarchy
+		}
 		this->ClearDrawcall();
 		this->MarkCanvasUpdate(false, false, true, true);
 		if (ParentCanvas.IsValid())
@@ -468,6 +587,7 @@ void ULGUICanvas::SetParentCanvas(ULGUICanvas* InParentCanvas)
 			ParentCanvas->ChildrenCanvasArray.AddUnique(this);
 			ParentCanvas->MarkCanvasUpdate(false, false, true, true);
 		}
+		UpdateActualRenderOffset_Recursive();//parent's render offset may change
 	}
 }
 
@@ -897,6 +1017,7 @@ bool ULGUICanvas::Is2DUITransform(const FTransform& Transform)
 
 void ULGUICanvas::UpdateGeometry_Implement()
 {
+	LGUI_PROFILER_SCOPE(Geometry);
 	//hierarchy change, need to sort it
 	if (bShouldSortRenderableOrder)
 	{
@@ -935,6 +1056,7 @@ DECLARE_CYCLE_STAT(TEXT("Canvas BatchDrawcall"), STAT_BatchDrawcall, STATGROUP_L
 void ULGUICanvas::BatchDrawcall_Implement(const FVector2D& InCanvasLeftBottom, const FVector2D& InCanvasRightTop, TArray<TSharedPtr<UUIDrawcall>>& InUIDrawcallList, TArray<TSharedPtr<UUIDrawcall>>& InCacheUIDrawcallList, bool& OutNeedToSortRenderPriority)
 {
 	SCOPE_CYCLE_COUNTER(STAT_BatchDrawcall);
+	LGUI_PROFILER_SCOPE(Batch);
 	
 	auto CanvasRect = UIQuadTree::Rectangle(InCanvasLeftBottom, InCanvasRightTop);
 
@@ -1411,6 +1533,10 @@ void ULGUICanvas::SetDefaultMeshType(TSubclassOf<ULGUIMeshComponent> InValue)
 		//clear mesh
 		if (UIMesh.IsValid())
 		{
+			if (RootCanvas.IsValid())
+			{
+				RootCanvas->bRenderTargetNeedFullRedraw = true;
+			}
 			UIMesh->DestroyComponent();
 			UIMesh = nullptr;
 			//if render as child, then delete render section
@@ -1455,6 +1581,10 @@ bool ULGUICanvas::UpdateCanvasDrawcallRecursive()
 	if (bNowUIItemIsActive || bPrevUIItemIsActive)
 	{
 		bResult = true;
+		if (bNowUIItemIsActive != bPrevUIItemIsActive)
+		{
+			RootCanvas->bRenderTargetNeedFullRedraw = true;
+		}
 		bPrevUIItemIsActive = bNowUIItemIsActive;
 		//update children canvas
 		for (auto& item : ChildrenCanvasArray)
@@ -1469,6 +1599,7 @@ bool ULGUICanvas::UpdateCanvasDrawcallRecursive()
 	//update drawcall
 	if (bCanTickUpdate)
 	{
+		FLGUIProfilerCanvasScope ProfilerCanvasScope(this);
 		bCanTickUpdate = false;
 		RootCanvas->bAnythingChangedForRenderTarget = true;
 
@@ -1580,6 +1711,7 @@ DECLARE_CYCLE_STAT(TEXT("Canvas UpdateDrawcallMesh"), STAT_UpdateDrawcallMesh, S
 void ULGUICanvas::UpdateDrawcallMesh_Implement()
 {
 	SCOPE_CYCLE_COUNTER(STAT_UpdateDrawcallMesh);
+	LGUI_PROFILER_SCOPE(MeshUpload);
 
 	CheckUIMesh();
 	auto MarkRootCanvasNeedToUpdateChildrenCanvasBounds = [this] {
@@ -1642,6 +1774,8 @@ void ULGUICanvas::UpdateDrawcallMesh_Implement()
 				MeshSectionPtr->vertices.Reset();
 				MeshSectionPtr->triangles.Reset();
 				DrawcallItem->GetCombined(MeshSectionPtr->vertices, MeshSectionPtr->triangles);
+				FLGUIProfiler::AddRebuiltDrawcall(MeshSectionPtr->vertices.Num()
+					, (int64)MeshSectionPtr->vertices.Num() * MeshSectionPtr->vertices.GetTypeSize() + (int64)MeshSectionPtr->triangles.Num() * MeshSectionPtr->triangles.GetTypeSize());
 				if (MeshSectionPtr->prevVertexCount != MeshSectionPtr->vertices.Num() || MeshSectionPtr->prevIndexCount != MeshSectionPtr->triangles.Num())
 				{
 					MeshSectionPtr->prevVertexCount = MeshSectionPtr->vertices.Num();
@@ -1749,8 +1883,12 @@ void ULGUICanvas::CheckUIMesh()const
 		UIMesh = NewObject<ULGUIMeshComponent>(this->GetOwner(), MeshType, ObjectName, RF_Transient);
 		UIMesh->RegisterComponent();
 		UIMesh->AttachToComponent(this->GetOwner()->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
-		UIMesh->SetRelativeTransform(FTransform::Identity);
+		UIMesh->SetRelativeTransform(FTransform(FVector(0, ActualRenderOffset.X, ActualRenderOffset.Y)));
 		UIMesh->SetRenderCanvas((ULGUICanvas*)this);
+		if (RenderInstances.Num() > 0)
+		{
+			UpdateUIMeshInstanceData();
+		}
 		bUIMeshNeedToSetInitialParameters = true;
 	}
 
@@ -1899,8 +2037,16 @@ bool ULGUICanvas::IsMaterialContainsLGUIParameter(UMaterialInterface* InMaterial
 }
 void ULGUICanvas::UpdateDrawcallMaterial_Implement()
 {
+	if (bClipTypeChanged || bRectClipParameterChanged || bTextureClipParameterChanged || bNeedToUpdateCustomClipParameter)
+	{
+		RootCanvas->bRenderTargetNeedFullRedraw = true;//clip affect every drawcall of this and children canvas
+	}
 	bool bNeedToSetClipParameter = false;
 	auto TempClipType = this->GetActualClipType();
+	if (TempClipType == ELGUICanvasClipType::Texture && (bClipTypeChanged || bTextureClipParameterChanged))
+	{
+		GetClipTextureHitTestMask();//prepare hit test mask when clip texture is assigned, so read back from gpu is done before raycast
+	}
 	ULGUICanvasCustomClip* TempCustomClip = nullptr;
 	if (TempClipType == ELGUICanvasClipType::Custom)
 	{
@@ -1994,6 +2140,7 @@ void ULGUICanvas::UpdateDrawcallMaterial_Implement()
 				if (RenderMat.IsValid() && DrawcallItem->bMaterialContainsLGUIParameter)
 				{
 					((UMaterialInstanceDynamic*)RenderMat.Get())->SetTextureParameterValue(LGUI_MainTextureMaterialParameterName, DrawcallItem->Texture.Get());
+					UIMesh->MarkRenderSectionDirtyRegion(DrawcallItem->DrawcallRenderSection.Pin());
 				}
 			}
 			if (DrawcallItem->bMaterialNeedToReassign)
@@ -2235,9 +2382,210 @@ void ULGUICanvas::AddUIMaterialToPool(UMaterialInstanceDynamic* UIMat)
 	}
 }
 
+/**
+ * Cpu side alpha values of clip texture's red channel, downsampled if texture is too large.
+ * Build once per texture, so hit test don't need to lock texture's bulk data.
+ * Pixels are read from: platform data if it is loaded (eg. texture without streaming), then source data in editor, then render resource.
+ * Read from render resource is async, hit test ignore the clip texture until pixels arrive on game thread.
+ * If none works then the mask is kept with empty AlphaValues, so failed texture will not try again on every raycast.
+ */
+struct FLGUIClipTextureHitTestMask
+{
+	static constexpr int32 MaxSize = 512;
+
+	TWeakObjectPtr<UTexture2D> Texture;
+	/** Texture's platform data when build the mask, if platform data change (eg. reimport texture in editor) then need to rebuild the mask */
+	const FTexturePlatformData* SourcePlatformData = nullptr;
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	/** Empty if texture's pixel data is not accessible */
+	TArray<uint8> AlphaValues;
+
+	bool HasPixelData()const { return AlphaValues.Num() > 0; }
+	float GetAlpha01(float InU01, float InV01)const
+	{
+		auto X = FMath::Clamp((int32)(InU01 * SizeX), 0, SizeX - 1);
+		auto Y = FMath::Clamp((int32)(InV01 * SizeY), 0, SizeY - 1);
+		return LGUIUtils::Color255To1_Table[AlphaValues[X + Y * SizeX]];
+	}
+	bool IsValidFor(UTexture2D* InTexture)const
+	{
+		return Texture.Get() == InTexture && InTexture->GetPlatformData() == SourcePlatformData;
+	}
+
+	static TSharedPtr<FLGUIClipTextureHitTestMask> Create(UTexture2D* InTexture)
+	{
+		auto Result = MakeShared<FLGUIClipTextureHitTestMask>();
+		Result->Texture = InTexture;
+		Result->SourcePlatformData = InTexture->GetPlatformData();
+		if (!Result->ReadFromPlatformData(InTexture)
+#if WITH_EDITORONLY_DATA
+			&& !Result->ReadFromSourceData(InTexture)
+#endif
+			&& !ReadFromRenderResourceAsync(Result, InTexture)
+			)
+		{
+			LogReadFailed(InTexture->GetPathName());
+		}
+		return Result;
+	}
+	static void LogReadFailed(const FString& InTexturePath)
+	{
+		UE_LOG(LGUI, Warning, TEXT("[%s].%d Can't read pixels of clip texture: '%s', hit test will ignore the clip texture. Use an uncompressed texture (eg. TC_VectorDisplacementmap) with NeverStream checked, so the pixels are accessible on cpu side.")
+			, ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *InTexturePath);
+	}
+private:
+	/** Downsample and store red channel. InGetRed(X, Y) returns red value of source pixel. */
+	template<typename GetRedFunc>
+	void Fill(int32 SrcSizeX, int32 SrcSizeY, GetRedFunc InGetRed)
+	{
+		SizeX = FMath::Min(SrcSizeX, MaxSize);
+		SizeY = FMath::Min(SrcSizeY, MaxSize);
+		AlphaValues.SetNumUninitialized(SizeX * SizeY);
+		for (int32 Y = 0; Y < SizeY; Y++)
+		{
+			auto SrcY = (int32)((int64)Y * SrcSizeY / SizeY);
+			for (int32 X = 0; X < SizeX; X++)
+			{
+				auto SrcX = (int32)((int64)X * SrcSizeX / SizeX);
+				AlphaValues[X + Y * SizeX] = InGetRed(SrcX, SrcY);
+			}
+		}
+	}
+	bool ReadFromPlatformData(UTexture2D* InTexture)
+	{
+		auto PlatformData = InTexture->GetPlatformData();
+		if (PlatformData == nullptr || PlatformData->Mips.Num() == 0)return false;
+		if (PlatformData->PixelFormat != PF_B8G8R8A8)return false;
+		auto& Mip = PlatformData->Mips[0];
+		auto SrcSizeX = Mip.SizeX, SrcSizeY = Mip.SizeY;
+		if (SrcSizeX <= 0 || SrcSizeY <= 0)return false;
+		//streamed mip in cooked build is not loaded, lock it will fail
+		if (!Mip.BulkData.IsBulkDataLoaded())return false;
+		if (Mip.BulkData.GetBulkDataSize() < (int64)SrcSizeX * SrcSizeY * sizeof(FColor))return false;
+
+		auto Pixels = (const FColor*)(Mip.BulkData.LockReadOnly());
+		if (Pixels != nullptr)
+		{
+			Fill(SrcSizeX, SrcSizeY, [Pixels, SrcSizeX](int32 X, int32 Y) { return Pixels[X + Y * SrcSizeX].R; });
+		}
+		Mip.BulkData.Unlock();
+		return Pixels != nullptr;
+	}
+#if WITH_EDITORONLY_DATA
+	bool ReadFromSourceData(UTexture2D* InTexture)
+	{
+		auto& Source = InTexture->Source;
+		if (!Source.IsValid())return false;
+		auto SrcSizeX = (int32)Source.GetSizeX(), SrcSizeY = (int32)Source.GetSizeY();
+		if (SrcSizeX <= 0 || SrcSizeY <= 0)return false;
+		auto SrcFormat = Source.GetFormat();
+		if (SrcFormat != TSF_BGRA8 && SrcFormat != TSF_G8)return false;
+		TArray64<uint8> MipData;
+		if (!Source.GetMipData(MipData, 0))return false;
+		auto BytesPerPixel = Source.GetBytesPerPixel();
+		if (MipData.Num() < (int64)SrcSizeX * SrcSizeY * BytesPerPixel)return false;
+
+		auto Pixels = MipData.GetData();
+		if (SrcFormat == TSF_BGRA8)
+		{
+			Fill(SrcSizeX, SrcSizeY, [Pixels, SrcSizeX](int32 X, int32 Y) { return ((const FColor*)Pixels)[X + Y * SrcSizeX].R; });
+		}
+		else
+		{
+			Fill(SrcSizeX, SrcSizeY, [Pixels, SrcSizeX](int32 X, int32 Y) { return Pixels[X + Y * SrcSizeX]; });
+		}
+		return true;
+	}
+#endif
+	/**
+	 * Read back from gpu without flush rendering commands, pixels are filled on game thread when ready. Only happens once per texture.
+	 * Block compressed format (eg. DXT/BC) can't read by ReadSurfaceData, so only uncompressed format is supported.
+	 */
+	static bool ReadFromRenderResourceAsync(const TSharedPtr<FLGUIClipTextureHitTestMask>& InMask, UTexture2D* InTexture)
+	{
+		auto Resource = InTexture->GetResource();
+		if (Resource == nullptr)return false;
+		if (auto PlatformData = InTexture->GetPlatformData())
+		{
+			if (GPixelFormats[PlatformData->PixelFormat].BlockSizeX != 1)return false;
+		}
+		TWeakPtr<FLGUIClipTextureHitTestMask> WeakMask = InMask;
+		ENQUEUE_RENDER_COMMAND(FLGUIClipTextureHitTestMask_ReadSurface)(
+			[Resource, WeakMask, TexturePath = InTexture->GetPathName()](FRHICommandListImmediate& RHICmdList)
+			{
+				auto TextureRHI = Resource->GetTexture2DRHI();
+				if (!TextureRHI || GPixelFormats[TextureRHI->GetFormat()].BlockSizeX != 1)
+				{
+					LogReadFailed(TexturePath);
+					return;
+				}
+				TArray<FColor> Pixels;
+				auto PixelsSize = TextureRHI->GetSizeXY();
+				RHICmdList.ReadSurfaceData(TextureRHI, FIntRect(0, 0, PixelsSize.X, PixelsSize.Y), Pixels, FReadSurfaceDataFlags());
+				if (PixelsSize.X <= 0 || PixelsSize.Y <= 0 || Pixels.Num() < PixelsSize.X * PixelsSize.Y)
+				{
+					LogReadFailed(TexturePath);
+					return;
+				}
+				//downsample on render thread, so game thread only need to take the result
+				FLGUIClipTextureHitTestMask TempMask;
+				auto SrcSizeX = PixelsSize.X;
+				TempMask.Fill(PixelsSize.X, PixelsSize.Y, [&Pixels, SrcSizeX](int32 X, int32 Y) { return Pixels[X + Y * SrcSizeX].R; });
+				AsyncTask(ENamedThreads::GameThread, [WeakMask, SizeX = TempMask.SizeX, SizeY = TempMask.SizeY, AlphaValues = MoveTemp(TempMask.AlphaValues)]() mutable {
+					if (auto Mask = WeakMask.Pin())
+					{
+						Mask->SizeX = SizeX;
+						Mask->SizeY = SizeY;
+						Mask->AlphaValues = MoveTemp(AlphaValues);
+					}
+					});
+			});
+		return true;
+	}
+};
+
+const FLGUIClipTextureHitTestMask* ULGUICanvas::GetClipTextureHitTestMask()
+{
+	if (!IsValid(clipTexture))
+	{
+		ClipTextureHitTestMask.Reset();
+		return nullptr;
+	}
+	if (!ClipTextureHitTestMask.IsValid() || !ClipTextureHitTestMask->IsValidFor(clipTexture))
+	{
+		ClipTextureHitTestMask.Reset();
+
+		//share mask between canvas, mask will be released when no canvas use it
+		static TMap<TWeakObjectPtr<UTexture2D>, TWeakPtr<FLGUIClipTextureHitTestMask>> SharedMaskMap;
+		if (auto FoundPtr = SharedMaskMap.Find(clipTexture))
+		{
+			auto FoundMask = FoundPtr->Pin();
+			if (FoundMask.IsValid() && FoundMask->IsValidFor(clipTexture))
+			{
+				ClipTextureHitTestMask = FoundMask;
+			}
+		}
+		if (!ClipTextureHitTestMask.IsValid())
+		{
+			for (auto Itr = SharedMaskMap.CreateIterator(); Itr; ++Itr)
+			{
+				if (!Itr->Key.IsValid() || !Itr->Value.IsValid())
+				{
+					Itr.RemoveCurrent();
+				}
+			}
+			//failed mask is also cached, so we only try once for a texture
+			ClipTextureHitTestMask = FLGUIClipTextureHitTestMask::Create(clipTexture);
+			SharedMaskMap.Add(clipTexture, ClipTextureHitTestMask);
+		}
+	}
+	return ClipTextureHitTestMask->HasPixelData() ? ClipTextureHitTestMask.Get() : nullptr;
+}
+
 bool ULGUICanvas::CalculatePointVisibilityOnClip(const FVector& InWorldPoint)
 {
-	//if not use clip or use texture clip, then point is visible. texture clip not support this calculation yet.
+	//if not use clip, then point is visible.
 	switch (GetActualClipType())
 	{
 	case ELGUICanvasClipType::None:
@@ -2257,31 +2605,14 @@ bool ULGUICanvas::CalculatePointVisibilityOnClip(const FVector& InWorldPoint)
 	break;
 	case ELGUICanvasClipType::Texture:
 	{
-		if (IsValid(clipTexture))
+		if (auto Mask = GetClipTextureHitTestMask())
 		{
-			auto PlatformData = clipTexture->GetPlatformData();
-			if(PlatformData && PlatformData->Mips.Num() > 0)
-			{
-				//calcualte pixel position on hit point
-				auto LocalPoint = this->UIItem->GetComponentTransform().InverseTransformPosition(InWorldPoint);
-				auto LocalLeftBottomPoint = UIItem->GetLocalSpaceLeftBottomPoint();
-				auto UVX01 = (LocalPoint.Y - UIItem->GetLocalSpaceLeft()) / UIItem->GetWidth();
-				auto UVY01 = (LocalPoint.Z - UIItem->GetLocalSpaceBottom()) / UIItem->GetHeight();
-				UVY01 = 1.0f - UVY01;
-				auto TexPosX = (int)(UVX01 * PlatformData->SizeX);
-				auto TexPosY = (int)(UVY01 * PlatformData->SizeY);
-				auto TexPos = TexPosX + TexPosY * PlatformData->SizeX;
-
-				bool Result = true;
-				if (auto Pixels = (FColor*)(PlatformData->Mips[0].BulkData.Lock(LOCK_READ_ONLY)))
-				{
-					auto AlphaValueValue = Pixels[TexPos].R;
-					auto AlphaValueValue01 = LGUIUtils::Color255To1_Table[AlphaValueValue];
-					Result = AlphaValueValue01 > clipTextureHitTestThreshold;
-				}
-				PlatformData->Mips[0].BulkData.Unlock();
-				return Result;
-			}
+			//calcualte pixel position on hit point
+			auto LocalPoint = this->UIItem->GetComponentTransform().InverseTransformPosition(InWorldPoint);
+			auto UVX01 = (LocalPoint.Y - UIItem->GetLocalSpaceLeft()) / UIItem->GetWidth();
+			auto UVY01 = (LocalPoint.Z - UIItem->GetLocalSpaceBottom()) / UIItem->GetHeight();
+			UVY01 = 1.0f - UVY01;
+			return Mask->GetAlpha01(UVX01, UVY01) > clipTextureHitTestThreshold;
 		}
 		return true;
 	}
@@ -2325,11 +2656,13 @@ void ULGUICanvas::ConditionalCalculateRectRange()
 				ParentCanvas->ConditionalCalculateRectRange();
 				auto parentRectMin = FVector(0, ParentCanvas->clipRectMin.X, ParentCanvas->clipRectMin.Y);
 				auto parentRectMax = FVector(0, ParentCanvas->clipRectMax.X, ParentCanvas->clipRectMax.Y);
-				//transform ParentCanvas's rect to this space
+				//transform ParentCanvas's rect to this space, rect is in UIMesh's space so take render offset
 				auto& parentCanvasTf = ParentCanvas->UIItem->GetComponentTransform();
 				auto thisTfInv = this->UIItem->GetComponentTransform().Inverse();
-				parentRectMin = thisTfInv.TransformPosition(parentCanvasTf.TransformPosition(parentRectMin));
-				parentRectMax = thisTfInv.TransformPosition(parentCanvasTf.TransformPosition(parentRectMax));
+				const auto parentRenderOffset = FVector(0, ParentCanvas->ActualRenderOffset.X, ParentCanvas->ActualRenderOffset.Y);
+				const auto thisRenderOffset = FVector(0, ActualRenderOffset.X, ActualRenderOffset.Y);
+				parentRectMin = thisTfInv.TransformPosition(parentCanvasTf.TransformPosition(parentRectMin + parentRenderOffset)) - thisRenderOffset;
+				parentRectMax = thisTfInv.TransformPosition(parentCanvasTf.TransformPosition(parentRectMax + parentRenderOffset)) - thisRenderOffset;
 				//inherit
 				if (clipRectMin.X < parentRectMin.Y)clipRectMin.X = parentRectMin.Y;
 				if (clipRectMin.Y < parentRectMin.Z)clipRectMin.Y = parentRectMin.Z;
@@ -2344,11 +2677,13 @@ void ULGUICanvas::ConditionalCalculateRectRange()
 				ParentCanvas->ConditionalCalculateRectRange();
 				auto parentRectMin = FVector(0, ParentCanvas->clipRectMin.X, ParentCanvas->clipRectMin.Y);
 				auto parentRectMax = FVector(0, ParentCanvas->clipRectMax.X, ParentCanvas->clipRectMax.Y);
-				//transform ParentCanvas's rect to this space
+				//transform ParentCanvas's rect to this space, rect is in UIMesh's space so take render offset
 				auto& parentCanvasTf = ParentCanvas->UIItem->GetComponentTransform();
 				auto thisTfInv = this->UIItem->GetComponentTransform().Inverse();
-				parentRectMin = thisTfInv.TransformPosition(parentCanvasTf.TransformPosition(parentRectMin));
-				parentRectMax = thisTfInv.TransformPosition(parentCanvasTf.TransformPosition(parentRectMax));
+				const auto parentRenderOffset = FVector(0, ParentCanvas->ActualRenderOffset.X, ParentCanvas->ActualRenderOffset.Y);
+				const auto thisRenderOffset = FVector(0, ActualRenderOffset.X, ActualRenderOffset.Y);
+				parentRectMin = thisTfInv.TransformPosition(parentCanvasTf.TransformPosition(parentRectMin + parentRenderOffset)) - thisRenderOffset;
+				parentRectMax = thisTfInv.TransformPosition(parentCanvasTf.TransformPosition(parentRectMax + parentRenderOffset)) - thisRenderOffset;
 
 				clipRectMin.X = parentRectMin.Y;
 				clipRectMin.Y = parentRectMin.Z;
@@ -2380,6 +2715,81 @@ void ULGUICanvas::ConditionalCalculateRectRange()
 	}
 }
 
+void ULGUICanvas::SetRenderOffset(const FVector2D& InOffset)
+{
+	if (RenderOffset != InOffset)
+	{
+		RenderOffset = InOffset;
+		UpdateActualRenderOffset_Recursive();
+		if (GetActualClipType() == ELGUICanvasClipType::Rect)
+		{
+			MarkRectClipParameterChanged_Recursive();
+		}
+	}
+}
+FVector ULGUICanvas::GetWorldRenderOffset()const
+{
+	if (ActualRenderOffset == FVector2D::ZeroVector || !UIItem.IsValid())return FVector::ZeroVector;
+	return UIItem->GetComponentTransform().TransformVector(FVector(0, ActualRenderOffset.X, ActualRenderOffset.Y));
+}
+void ULGUICanvas::SetRenderInstances(const TArray<FLGUICanvasRenderInstance>& InInstances)
+{
+	if (InInstances.Num() > 0 && GetActualRenderMode() != ELGUIRenderMode::WorldSpace_LGUI)
+	{
+		UE_LOG(LGUI, Warning, TEXT("[%s].%d Render instances only work with WorldSpace_LGUI render mode, canvas: %s"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *this->GetPathName());
+	}
+	RenderInstances = InInstances;
+	if (UIMesh.IsValid())
+	{
+		UpdateUIMeshInstanceData();
+	}
+}
+void ULGUICanvas::UpdateUIMeshInstanceData()const
+{
+	TArray<FLGUIMeshInstanceData> InstanceDataArray;
+	InstanceDataArray.Reserve(RenderInstances.Num());
+	for (auto& Instance : RenderInstances)
+	{
+		InstanceDataArray.Add(FLGUIMeshInstanceData(Instance.Transform, Instance.Color));
+	}
+	UIMesh->SetInstanceData(InstanceDataArray);
+}
+void ULGUICanvas::UpdateActualRenderOffset_Recursive()
+{
+	auto NewOffset = RenderOffset;
+	if (ParentCanvas.IsValid() && ParentCanvas->ActualRenderOffset != FVector2D::ZeroVector && UIItem.IsValid() && ParentCanvas->UIItem.IsValid())
+	{
+		//convert parent's offset to this canvas's space
+		auto WorldOffset = ParentCanvas->UIItem->GetComponentTransform().TransformVector(FVector(0, ParentCanvas->ActualRenderOffset.X, ParentCanvas->ActualRenderOffset.Y));
+		auto LocalOffset = UIItem->GetComponentTransform().InverseTransformVector(WorldOffset);
+		NewOffset.X += LocalOffset.Y;
+		NewOffset.Y += LocalOffset.Z;
+	}
+	if (ActualRenderOffset != NewOffset)
+	{
+		ActualRenderOffset = NewOffset;
+		if (UIMesh.IsValid())
+		{
+			UIMesh->SetRelativeLocation(FVector(0, ActualRenderOffset.X, ActualRenderOffset.Y));
+			if (!this->GetOverrideSorting())//render as child canvas, need to update the section box in root canvas's UIMesh
+			{
+				if (RootCanvas.IsValid())
+				{
+					RootCanvas->bRootCanvasNeedToUpdateChildrenCanvasBounds = true;
+					RootCanvas->bCanTickUpdate = true;
+				}
+			}
+		}
+	}
+	for (auto ChildCanvas : ChildrenCanvasArray)
+	{
+		if (ChildCanvas.IsValid())
+		{
+			ChildCanvas->UpdateActualRenderOffset_Recursive();
+		}
+	}
+}
+
 void ULGUICanvas::MarkRectClipParameterChanged_Recursive()
 {
 	bCanTickUpdate = true;
@@ -2442,6 +2852,7 @@ void ULGUICanvas::SetRenderTargetResolutionScale(float value)
 	{
 		RenderTargetResolutionScale = value;
 		bAnythingChangedForRenderTarget = true;
+		bRenderTargetNeedFullRedraw = true;
 	}
 }
 
@@ -2451,6 +2862,7 @@ void ULGUICanvas::SetRenderTargetSizeMode(ELGUICanvasRenderTargetSizeMode value)
 	{
 		RenderTargetSizeMode = value;
 		bAnythingChangedForRenderTarget = true;
+		bRenderTargetNeedFullRedraw = true;
 	}
 }
 
@@ -2460,6 +2872,7 @@ void ULGUICanvas::SetRenderTargetUpdateMode(ELGUICanvasRenderTargetUpdateMode va
 	{
 		RenderTargetUpdateMode = value;
 		bAnythingChangedForRenderTarget = true;
+		bRenderTargetNeedFullRedraw = true;
 	}
 }
 
@@ -2468,6 +2881,7 @@ void ULGUICanvas::RequestUpdateForRenderTarget()
 	if (RootCanvas == this)
 	{
 		bRequestUpdateForRenderTarget = true;
+		bRenderTargetNeedFullRedraw = true;
 	}
 }
 
@@ -2504,6 +2918,7 @@ void ULGUICanvas::SetClipTexture(UTexture2D* newTexture)
 	{
 		bTextureClipParameterChanged = true;
 		clipTexture = newTexture;
+		ClipTextureHitTestMask.Reset();
 		MarkCanvasUpdate(true, true, false);
 	}
 }
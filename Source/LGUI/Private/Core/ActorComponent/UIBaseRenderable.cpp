@@ -80,6 +80,7 @@ UUIBaseRenderable::UUIBaseRenderable(const FObjectInitializer& ObjectInitializer
 
 	bColorChanged = true;
 	bTransformChanged = true;
+	bIgnoreCanvasGroupAlpha = false;
 }
 
 void UUIBaseRenderable::BeginPlay()
@@ -302,7 +303,7 @@ void UUIBaseRenderable::SetCustomRaycastObject(UUIRenderableCustomRaycast* Value
 FColor UUIBaseRenderable::GetFinalColor()const
 {
 	FColor ResultColor = Color;
-	if (CanvasGroup.IsValid())
+	if (CanvasGroup.IsValid() && !bIgnoreCanvasGroupAlpha)
 	{
 		ResultColor.A = Color.A * CanvasGroup->GetFinalAlpha();
 	}
@@ -311,7 +312,7 @@ FColor UUIBaseRenderable::GetFinalColor()const
 
 uint8 UUIBaseRenderable::GetFinalAlpha()const
 {
-	if (CanvasGroup.IsValid())
+	if (CanvasGroup.IsValid() && !bIgnoreCanvasGroupAlpha)
 	{
 		return (uint8)(Color.A * CanvasGroup->GetFinalAlpha());
 	}
@@ -8,6 +8,7 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Core/UIDrawcall.h"
 #include "Core/LGUIManager.h"
+#include "Core/LGUIProfiler.h"
 
 DECLARE_CYCLE_STAT(TEXT("UIBatchMeshRenderable GeometryModifier"), STAT_ApplyModifier, STATGROUP_LGUI);
 
@@ -82,6 +83,16 @@ void UUIBatchMeshRenderable::MarkVerticesDirty(bool InTriangleDirty, bool InVert
 	MarkCanvasUpdate(false, bLocalVertexPositionChanged, false);
 }
 
+void UUIBatchMeshRenderable::OnCanvasGroupAlphaChange()
+{
+	//CanvasGroup's alpha is not stored in geometry, drawcall will apply it when combine mesh, so no need to update geometry
+	if (drawcall.IsValid())
+	{
+		drawcall->bNeedToUpdateVertex = true;
+		MarkCanvasUpdate(false, false, false);
+	}
+}
+
 void UUIBatchMeshRenderable::MarkVertexPositionDirty()
 {
 	MarkVerticesDirty(false, true, false, false);
@@ -269,10 +280,12 @@ void UUIBatchMeshRenderable::UpdateGeometry()
 
 	Super::UpdateGeometry();
 
+	bIgnoreCanvasGroupAlpha = true;
 	OnBeforeCreateOrUpdateGeometry();
 	if (!drawcall.IsValid()//not add to render yet
 		)
 	{
+		FLGUIProfiler::AddDirtyItem();
 		geometry->Clear();
 		geometry->texture = GetTextureToCreateGeometry();
 		geometry->material = GetMaterialToCreateGeometry();
@@ -288,6 +301,7 @@ void UUIBatchMeshRenderable::UpdateGeometry()
 		bool pixelPerfectAffectTransform = pixelPerfect && bTransformChanged;
 		if (bTriangleChanged || bLocalVertexPositionChanged || pixelPerfectAffectTransform || bColorChanged || bUVChanged)
 		{
+			FLGUIProfiler::AddDirtyItem();
 			geometry->Clear();
 			//check if GeometryModifier will affect vertex data, if so we need to update these data in OnUpdateGeometry
 			{
@@ -334,6 +348,7 @@ void UUIBatchMeshRenderable::UpdateGeometry()
 	bUVChanged = false;
 	bColorChanged = false;
 	bTransformChanged = false;
+	bIgnoreCanvasGroupAlpha = false;
 }
 
 bool UUIBatchMeshRenderable::LineTraceUI(FHitResult& OutHit, const FVector& Start, const FVector& End)
@@ -11,6 +11,7 @@
 #include "PrefabSystem/LGUIPrefabManager.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "Layout/LGUICanvasScaler.h"
+#include "HAL/IConsoleManager.h"
 #if WITH_EDITOR
 #include "DrawDebugHelpers.h"
 #include "EditorViewportClient.h"
@@ -21,6 +22,16 @@
 UE_DISABLE_OPTIMIZATION
 #endif
 
+static FAutoConsoleCommand CCmdLGUIFlattenHierarchyIndexBenchmark(
+	TEXT("lgui.UIItem.FlattenHierarchyIndexBenchmark"),
+	TEXT("Build a temporary UI tree, randomly reorder/reparent/insert UIItems, and log flatten hierarchy index update time. Parameters: [NodeCount] [ChurnCount], default is 50000 and 1000."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World) {
+		UUIItem::BenchmarkFlattenHierarchyIndex(World
+			, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 50000
+			, Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1000);
+		})
+);
+
 UUIItem::UUIItem(const FObjectInitializer& ObjectInitializer) :Super(ObjectInitializer)
 {
 	PrimaryComponentTick.bCanEverTick = false;
@@ -210,21 +221,120 @@ void UUIItem::CallUILifeCycleBehavioursChildHierarchyIndexChanged(UUIItem* child
 #pragma endregion LGUILifeCycleUIBehaviour
 
 
-void UUIItem::CalculateFlattenHierarchyIndex_Recursive(int& index)const
+void UUIItem::CalculateFlattenHierarchyIndex_Recursive(int64& index, int64 stride)const
 {
-	if (this->flattenHierarchyIndex != index)
+	this->flattenHierarchyIndex = (int32)index;
+	this->bFlattenHierarchyIndexDirty = false;
+	EnsureUIChildrenSorted();
+	for (auto& child : UIChildren)
 	{
-		this->flattenHierarchyIndex = index;
+		if (IsValid(child))
+		{
+			index += stride;
+			child->CalculateFlattenHierarchyIndex_Recursive(index, stride);
+		}
 	}
-	EnsureUIChildrenSorted();
+}
+int32 UUIItem::CountFlattenHierarchyItems_Recursive()const
+{
+	int32 Result = 1;
 	for (auto& child : UIChildren)
 	{
 		if (IsValid(child))
 		{
-			index++;
-			child->CalculateFlattenHierarchyIndex_Recursive(index);
+			Result += child->CountFlattenHierarchyItems_Recursive();
 		}
 	}
+	return Result;
+}
+
+bool UUIItem::IsFlattenHierarchyIndexStale()const
+{
+	for (auto Item = this; Item != nullptr; Item = Item->ParentUIItem.Get())
+	{
+		if (Item->bFlattenHierarchyIndexDirty)return true;
+		if (Item == RootUIItem.Get())break;
+	}
+	return false;
+}
+
+int32 UUIItem::GetValidUIChildIndex(const UUIItem* InChild)const
+{
+	EnsureUIChildrenSorted();
+	//hierarchyIndex is the index in UIChildren if no invalid child, so check it first
+	if (UIChildren.IsValidIndex(InChild->hierarchyIndex) && UIChildren[InChild->hierarchyIndex].Get() == InChild)
+	{
+		return InChild->hierarchyIndex;
+	}
+	return UIChildren.IndexOfByPredicate([InChild](const TObjectPtr<UUIItem>& Item) {return Item.Get() == InChild; });
+}
+
+const UUIItem* UUIItem::GetFlattenHierarchyPrevItem()const
+{
+	auto Parent = ParentUIItem.Get();
+	if (Parent == nullptr || this == RootUIItem.Get())return nullptr;
+	auto Index = Parent->GetValidUIChildIndex(this);
+	//prev sibling's last child is the prev one
+	for (int i = Index - 1; i >= 0; i--)
+	{
+		if (IsValid(Parent->UIChildren[i]))
+		{
+			const UUIItem* Result = Parent->UIChildren[i];
+			while (true)
+			{
+				Result->EnsureUIChildrenSorted();
+				const UUIItem* LastChild = nullptr;
+				for (int j = Result->UIChildren.Num() - 1; j >= 0; j--)
+				{
+					if (IsValid(Result->UIChildren[j]))
+					{
+						LastChild = Result->UIChildren[j];
+						break;
+					}
+				}
+				if (LastChild == nullptr)break;
+				Result = LastChild;
+			}
+			return Result;
+		}
+	}
+	return Parent;
+}
+
+const UUIItem* UUIItem::GetFlattenHierarchyNextItem()const
+{
+	for (auto Item = this; Item != nullptr && Item != RootUIItem.Get(); )
+	{
+		auto Parent = Item->ParentUIItem.Get();
+		if (Parent == nullptr)break;
+		auto Index = Parent->GetValidUIChildIndex(Item);
+		for (int i = Index + 1; i < Parent->UIChildren.Num(); i++)
+		{
+			if (IsValid(Parent->UIChildren[i]))
+			{
+				return Parent->UIChildren[i];
+			}
+		}
+		Item = Parent;
+	}
+	return nullptr;
+}
+
+bool UUIItem::RecalculateFlattenHierarchyIndexInGap()const
+{
+	auto PrevItem = GetFlattenHierarchyPrevItem();
+	if (PrevItem == nullptr)return false;
+	auto NextItem = GetFlattenHierarchyNextItem();
+	if (PrevItem->IsFlattenHierarchyIndexStale())return false;
+	if (NextItem != nullptr && NextItem->IsFlattenHierarchyIndexStale())return false;
+
+	int64 Low = PrevItem->flattenHierarchyIndex;
+	int64 High = NextItem != nullptr ? (int64)NextItem->flattenHierarchyIndex : (int64)MAX_int32 + 1;
+	auto Stride = (High - Low) / ((int64)CountFlattenHierarchyItems_Recursive() + 1);
+	if (Stride < 1)return false;
+	int64 Index = Low + Stride;
+	CalculateFlattenHierarchyIndex_Recursive(Index, Stride);
+	return true;
 }
 
 DECLARE_CYCLE_STAT(TEXT("UIItem CalculateFlattenHierarchyIndex"), STAT_UIItemCalculateFlattenHierarchyIndex, STATGROUP_LGUI);
@@ -232,18 +342,60 @@ void UUIItem::RecalculateFlattenHierarchyIndex()const
 {
 	SCOPE_CYCLE_COUNTER(STAT_UIItemCalculateFlattenHierarchyIndex);
 
-	this->bFlattenHierarchyIndexDirty = false;
-	int tempIndex = this->flattenHierarchyIndex;
-	this->CalculateFlattenHierarchyIndex_Recursive(tempIndex);
+	FlattenHierarchyIndexDirtyItems.Reset();
+	//spread keys in int32 range, leave gaps for later local change
+	const int64 MaxStride = 1 << 16;
+	auto Stride = FMath::Clamp((int64)MAX_int32 / ((int64)CountFlattenHierarchyItems_Recursive() + 1), (int64)1, MaxStride);
+	int64 tempIndex = 0;
+	this->CalculateFlattenHierarchyIndex_Recursive(tempIndex, Stride);
+}
+
+DECLARE_CYCLE_STAT(TEXT("UIItem UpdateFlattenHierarchyIndex"), STAT_UIItemUpdateFlattenHierarchyIndex, STATGROUP_LGUI);
+void UUIItem::UpdateFlattenHierarchyIndex()const
+{
+	if (bFlattenHierarchyIndexDirty)
+	{
+		RecalculateFlattenHierarchyIndex();
+		return;
+	}
+	SCOPE_CYCLE_COUNTER(STAT_UIItemUpdateFlattenHierarchyIndex);
+	for (int i = 0; i < FlattenHierarchyIndexDirtyItems.Num(); i++)
+	{
+		auto Item = FlattenHierarchyIndexDirtyItems[i].Get();
+		if (Item == nullptr || Item->RootUIItem.Get() != this || !Item->bFlattenHierarchyIndexDirty)continue;//already renumbered, or not belong to this hierarchy anymore
+		//find top most dirty one
+		for (auto Parent = Item->ParentUIItem.Get(); Parent != nullptr && Parent != this; Parent = Parent->ParentUIItem.Get())
+		{
+			if (Parent->bFlattenHierarchyIndexDirty)
+			{
+				Item = Parent;
+			}
+		}
+		//if not enough gap, then try parent's gap
+		while (Item != nullptr && Item != this && !Item->RecalculateFlattenHierarchyIndexInGap())
+		{
+			Item = Item->ParentUIItem.Get();
+		}
+		if (Item == nullptr || Item == this)
+		{
+			RecalculateFlattenHierarchyIndex();
+			return;
+		}
+	}
+	FlattenHierarchyIndexDirtyItems.Reset();
 }
 
 int32 UUIItem::GetFlattenHierarchyIndex()const
 {
 	if (RootUIItem.IsValid())
 	{
-		if (RootUIItem->bFlattenHierarchyIndexDirty)
+		if (bFlattenHierarchyIndexDirty && RootUIItem.Get() != this)//dirty but not in list, eg: created and attached before register
+		{
+			RootUIItem->FlattenHierarchyIndexDirtyItems.Add(this);
+		}
+		if (RootUIItem->bFlattenHierarchyIndexDirty || RootUIItem->FlattenHierarchyIndexDirtyItems.Num() > 0)
 		{
-			RootUIItem->RecalculateFlattenHierarchyIndex();
+			RootUIItem->UpdateFlattenHierarchyIndex();
 		}
 	}
 	return this->flattenHierarchyIndex;
@@ -253,7 +405,24 @@ void UUIItem::MarkFlattenHierarchyIndexDirty()
 {
 	if (RootUIItem.IsValid())
 	{
-		RootUIItem->bFlattenHierarchyIndexDirty = true;
+		if (RootUIItem.Get() == this)
+		{
+			bFlattenHierarchyIndexDirty = true;
+		}
+		else
+		{
+			//already dirty means already in list (or an up parent is), no need to add again
+			if (!bFlattenHierarchyIndexDirty)
+			{
+				//if any up parent is dirty then this one will be renumbered together, no need to add to list
+				auto Parent = ParentUIItem.Get();
+				if (Parent == nullptr || !Parent->IsFlattenHierarchyIndexStale())
+				{
+					RootUIItem->FlattenHierarchyIndexDirtyItems.Add(this);
+				}
+				bFlattenHierarchyIndexDirty = true;
+			}
+		}
 	}
 	//tell canvas to update
 	if (RenderCanvas.IsValid()
@@ -321,6 +490,114 @@ void UUIItem::ApplyHierarchyIndex()
 	}
 }
 
+void UUIItem::BenchmarkFlattenHierarchyIndex(UWorld* InWorld, int32 InNodeCount, int32 InChurnCount)
+{
+	if (!IsValid(InWorld))
+	{
+		UE_LOG(LGUI, Error, TEXT("[%s].%d Need a valid world"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__);
+		return;
+	}
+	InNodeCount = FMath::Max(InNodeCount, 2);
+	InChurnCount = FMath::Max(InChurnCount, 0);
+	auto Actor = InWorld->SpawnActor<AActor>();
+	if (Actor == nullptr)return;
+	FRandomStream Random(InNodeCount);
+	TArray<UUIItem*> Items;
+	Items.Reserve(InNodeCount + InChurnCount);
+	auto CreateItem = [&](UUIItem* Parent) {
+		auto Item = NewObject<UUIItem>(Actor);
+		if (Parent != nullptr)
+		{
+			Item->SetupAttachment(Parent);
+		}
+		else
+		{
+			Actor->SetRootComponent(Item);
+		}
+		Item->RegisterComponent();
+		Items.Add(Item);
+		return Item;
+	};
+
+	auto StartTime = FPlatformTime::Seconds();
+	auto Root = CreateItem(nullptr);
+	for (int i = 1; i < InNodeCount; i++)
+	{
+		CreateItem(Items[(i - 1) / 8]);//8 children for each node
+	}
+	auto BuildTime = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	Root->RecalculateFlattenHierarchyIndex();
+	auto FullRecalculateTime = FPlatformTime::Seconds() - StartTime;
+
+	double ChurnTime = 0, QueryTime = 0;
+	for (int i = 0; i < InChurnCount; i++)
+	{
+		auto Item = Items[Random.RandRange(1, Items.Num() - 1)];
+		StartTime = FPlatformTime::Seconds();
+		switch (Random.RandRange(0, 3))
+		{
+		case 0:
+		{
+			Item->SetHierarchyIndex(Random.RandRange(0, Item->ParentUIItem->UIChildren.Num() - 1));
+		}
+		break;
+		case 1:
+		{
+			Item->SetAsLastHierarchy();
+		}
+		break;
+		case 2:
+		{
+			auto NewParent = Items[Random.RandRange(0, Items.Num() - 1)];
+			if (NewParent != Item && !NewParent->IsAttachedTo(Item))
+			{
+				Item->AttachToComponent(NewParent, FAttachmentTransformRules::KeepRelativeTransform);
+			}
+		}
+		break;
+		default:
+		{
+			CreateItem(Item);
+		}
+		break;
+		}
+		auto QueryStartTime = FPlatformTime::Seconds();
+		ChurnTime += QueryStartTime - StartTime;
+		//sort will query the changed one and others
+		Item->GetFlattenHierarchyIndex();
+		Items[Random.RandRange(0, Items.Num() - 1)]->GetFlattenHierarchyIndex();
+		QueryTime += FPlatformTime::Seconds() - QueryStartTime;
+	}
+
+	//verify: index must increase along depth first order
+	int32 ErrorCount = 0;
+	int32 PrevIndex = MIN_int32;
+	TArray<const UUIItem*> Stack;
+	Stack.Add(Root);
+	while (Stack.Num() > 0)
+	{
+		auto Item = Stack.Pop(false);
+		auto Index = Item->GetFlattenHierarchyIndex();
+		if (Index <= PrevIndex)ErrorCount++;
+		PrevIndex = Index;
+		Item->EnsureUIChildrenSorted();
+		for (int i = Item->UIChildren.Num() - 1; i >= 0; i--)
+		{
+			if (IsValid(Item->UIChildren[i]))
+			{
+				Stack.Add(Item->UIChildren[i]);
+			}
+		}
+	}
+
+	UE_LOG(LGUI, Log, TEXT("[%s].%d Node count:%d, build:%fms, full recalculate:%fms, churn count:%d, churn:%fms, flatten hierarchy index query:%fms (%fms per churn), order error count:%d")
+		, ANSI_TO_TCHAR(__FUNCTION__), __LINE__, Items.Num(), BuildTime * 1000, FullRecalculateTime * 1000
+		, InChurnCount, ChurnTime * 1000, QueryTime * 1000, InChurnCount > 0 ? QueryTime * 1000 / InChurnCount : 0, ErrorCount);
+	Actor->Destroy();
+}
+
 void UUIItem::SetAsFirstHierarchy()
 {
 	SetHierarchyIndex(0);
@@ -451,7 +728,10 @@ void UUIItem::MarkAllDirtyRecursive()
 
 void UUIItem::MarkAllDirty()
 {
-	bFlattenHierarchyIndexDirty = true;
+	if (!RootUIItem.IsValid() || RootUIItem.Get() == this)
+	{
+		bFlattenHierarchyIndexDirty = true;
+	}
 	bWidthCached = false;
 	bHeightCached = false;
 	bAnchorLeftCached = false;
@@ -1254,6 +1534,11 @@ void UUIItem::CheckRootUIItem(UUIItem* RootUIItemInParent)
 	{
 		ULGUIManagerWorldSubsystem::AddRootUIItem(this);
 	}
+	else if (bFlattenHierarchyIndexDirty && RootUIItem != oldRootUIItem && RootUIItem != nullptr)
+	{
+		//dirty item is only listed in old root, move it to new root
+		RootUIItem->FlattenHierarchyIndexDirtyItems.Add(this);
+	}
 }
 
 FDelegateHandle UUIItem::RegisterUIHierarchyChanged(const FSimpleDelegate& InCallback)
@@ -644,6 +644,7 @@ void UUIProceduralRect::ApplyAtlasTextureChange_Implementation()
 	if (BodyTextureMode != EUIProceduralBodyTextureMode::Sprite)return;
 	check(BodySpriteTexture);
 	geometry->texture = BodySpriteTexture->GetAtlasTexture();
+	MarkVerticesDirty(false, true, true, false);//sprite may move inside atlas texture
 	if (RenderCanvas.IsValid())
 	{
 		if (drawcall.IsValid())
@@ -42,6 +42,7 @@ void UUISpriteBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 void UUISpriteBase::ApplyAtlasTextureChange_Implementation()
 {
 	geometry->texture = sprite->GetAtlasTexture();
+	MarkUVDirty();//sprite may move inside atlas texture
 	if (RenderCanvas.IsValid())
 	{
 		if (drawcall.IsValid())
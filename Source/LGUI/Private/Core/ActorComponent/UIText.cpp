@@ -13,6 +13,7 @@
 #include "PrefabSystem/LGUIPrefabManager.h"
 #include "Utils/LGUIUtils.h"
 #include "Core/ActorComponent/UICanvasGroup.h"
+#include "HAL/IConsoleManager.h"
 
 #if LGUI_CAN_DISABLE_OPTIMIZATION
 UE_DISABLE_OPTIMIZATION
@@ -20,6 +21,16 @@ UE_DISABLE_OPTIMIZATION
 
 #define LOCTEXT_NAMESPACE "UIText"
 
+static FAutoConsoleCommand CCmdLGUITextLayoutBenchmark(
+	TEXT("lgui.UIText.LayoutBenchmark"),
+	TEXT("Create temporary UITexts, layout many short labels and a long rich text document, log the time. Parameters: [LabelCount] [RichTextDocumentSize], default is 1000 and 65536."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World) {
+		UUIText::BenchmarkTextLayout(World
+			, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000
+			, Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 65536);
+		})
+);
+
 #if WITH_EDITORONLY_DATA
 TWeakObjectPtr<ULGUIFontData_BaseObject> UUIText::CurrentUsingFontData = nullptr;
 #endif
@@ -36,6 +47,8 @@ UUIText::UUIText(const FObjectInitializer& ObjectInitializer):Super(ObjectInitia
 }
 void UUIText::ApplyFontTextureScaleUp()
 {
+	FTextGeometrySharedCache::Clear();//uv in shared cache is not valid anymore
+	CacheTextGeometryData.ApplyFontTextureScaleUp();
 	auto& vertices = geometry->vertices;
 	if (vertices.Num() != 0)
 	{
@@ -61,6 +74,7 @@ void UUIText::ApplyFontTextureScaleUp()
 
 void UUIText::ApplyFontTextureChange()
 {
+	FTextGeometrySharedCache::Clear();
 	if (IsValid(font))
 	{
 		MarkVerticesDirty(true, true, true, true);
@@ -102,6 +116,7 @@ void UUIText::ApplyRecreateText()
 {
 	if (IsValid(font))
 	{
+		FTextGeometrySharedCache::Clear();
 		CacheTextGeometryData.MarkDirty();
 		MarkVertexPositionDirty();
 	}
@@ -128,7 +143,7 @@ void UUIText::BeginPlay()
 	{
 		this->RegisterOnRichTextCustomStyleDataChange();
 	}
-	visibleCharCount = VisibleCharCountInString(text.ToString());
+	visibleCharCount = VisibleCharCountInString(GetText().ToString());
 }
 
 void UUIText::TickComponent( float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction )
@@ -262,6 +277,10 @@ void UUIText::OnAnchorChange(bool InPivotChange, bool InWidthChange, bool InHeig
     Super::OnAnchorChange(InPivotChange, InWidthChange, InHeightChange, InDiscardCache);
     if (InPivotChange || InWidthChange || InHeightChange)
     {
+        if (!InPivotChange && !InWidthChange && CacheTextGeometryData.IsLayoutIndependentOfHeight())//only height change and it not affect text layout
+        {
+            return;
+        }
         MarkVertexPositionDirty();
         MarkUVDirty();
     }
@@ -350,7 +369,7 @@ void UUIText::OnBeforeCreateOrUpdateGeometry()
 			this->RegisterOnRichTextCustomStyleDataChange();
 		}
 	}
-	if (visibleCharCount == -1)visibleCharCount = VisibleCharCountInString(text.ToString());
+	if (visibleCharCount == -1)visibleCharCount = VisibleCharCountInString(GetText().ToString());
 }
 
 bool UUIText::GetShouldAffectByPixelPerfect()const
@@ -383,7 +402,7 @@ void UUIText::UpdateMaterialClipType()
 
 void UUIText::OnCultureChanged_Implementation()
 {
-	auto originText = text;
+	auto originText = GetText();
 	text = FText::GetEmpty();//just make it work, because SetText will compare text value
 	SetText(originText);
 }
@@ -400,7 +419,8 @@ void UUIText::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent
 		auto MemberPropertyName = MemberProperty->GetFName();
 		if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UUIText, text))
 		{
-			
+			bTextPropertyDirty = false;//text is edited, use it
+			PendingAppendText.Reset();
 		}
 		else if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UUIText, font))
 		{
@@ -411,6 +431,11 @@ void UUIText::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent
 			MarkVertexPositionDirty();
 			CacheTextGeometryData.MarkDirty();
 		}
+		else if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UUIText, fixedWidthDigit))
+		{
+			MarkVertexPositionDirty();
+			CacheTextGeometryData.MarkDirty();
+		}
 		else if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UUIText, adjustWidthRange))
 		{
 			if (PropertyName == "X")
@@ -488,7 +513,7 @@ void UUIText::EditorForceUpdate()
 {
 	Super::EditorForceUpdate();
 
-	visibleCharCount = VisibleCharCountInString(text.ToString());
+	visibleCharCount = VisibleCharCountInString(GetText().ToString());
 	if (!IsValid(font))
 	{
 		font = ULGUIFontData_BaseObject::GetDefaultFont();
@@ -597,7 +622,7 @@ void UUIText::SetFont(ULGUIFontData_BaseObject* newFont) {
 	}
 }
 void UUIText::SetText(const FText& newText) {
-	if (!text.EqualTo(newText))
+	if (!GetText().EqualTo(newText))
 	{
 		text = newText;
 
@@ -615,6 +640,243 @@ void UUIText::SetText(const FText& newText) {
 }
 
 
+void UUIText::AppendText(const FString& appendText)
+{
+	if (appendText.Len() == 0)return;
+	auto appendVisibleCharCount = VisibleCharCountInString(appendText);
+	//geometry is ready, try to layout appended text only
+	bool bCanChangeGeometryDirectly = drawcall.IsValid()
+		&& visibleCharCount != -1
+		&& !bTriangleChanged && !bLocalVertexPositionChanged && !bUVChanged && !bColorChanged
+		&& !HaveGeometryModifier(false)
+		&& PendingAppendText.Len() == 0
+		;
+	//layout cache's content is appended in place, text property sync from it when needed, so cost is relative to appended text only
+	if (bCanChangeGeometryDirectly && CacheTextGeometryData.AppendContent(appendText, appendVisibleCharCount, geometry.Get()))
+	{
+		bTextPropertyDirty = true;
+		visibleCharCount += appendVisibleCharCount;
+		CalculateLocalBounds();
+		bTransformChanged = true;//transform new vertices in UpdateGeometry
+		ConditionalMarkTextLayoutDirty();
+		MarkCanvasUpdate(false, true, false);//vertex count changed, drawcall need to collect it again
+	}
+	else
+	{
+		PendingAppendText.Append(appendText);
+		if (visibleCharCount == -1)
+		{
+			MarkVerticesDirty(true, true, true, true);//visible char count is calculated when layout
+		}
+		else if (appendVisibleCharCount != 0)//visible char count change
+		{
+			MarkVerticesDirty(true, true, true, true);
+			visibleCharCount += appendVisibleCharCount;
+		}
+		else//visible char count not change, just mark update vertex and uv
+		{
+			MarkVerticesDirty(false, true, true, false);
+		}
+	}
+}
+
+void UUIText::ReplaceText(int32 startCharIndex, int32 removeCharCount, const FString& insertText)
+{
+	//geometry is ready, try to layout edited paragraphs only
+	bool bCanChangeGeometryDirectly = drawcall.IsValid()
+		&& visibleCharCount != -1
+		&& !bTriangleChanged && !bLocalVertexPositionChanged && !bUVChanged && !bColorChanged
+		&& !HaveGeometryModifier(false)
+		&& PendingAppendText.Len() == 0
+		;
+	//layout cache's content is same as text when geometry is ready, use it so text property not need to sync
+	const auto& currentString = bCanChangeGeometryDirectly ? CacheTextGeometryData.GetContent() : GetText().ToString();
+	startCharIndex = FMath::Clamp(startCharIndex, 0, currentString.Len());
+	removeCharCount = FMath::Clamp(removeCharCount, 0, currentString.Len() - startCharIndex);
+	if (removeCharCount == 0 && insertText.Len() == 0)return;
+	auto visibleCharCountDelta = VisibleCharCountInString(insertText);
+	for (int i = startCharIndex; i < startCharIndex + removeCharCount; i++)
+	{
+		if (IsVisibleChar(currentString[i]))
+		{
+			visibleCharCountDelta--;
+		}
+	}
+	//layout cache's content is edited in place, text property sync from it when needed
+	if (bCanChangeGeometryDirectly && CacheTextGeometryData.ReplaceContent(startCharIndex, removeCharCount, insertText, visibleCharCountDelta, geometry.Get()))
+	{
+		bTextPropertyDirty = true;
+		visibleCharCount += visibleCharCountDelta;
+		CalculateLocalBounds();
+		bTransformChanged = true;//transform moved and new vertices in UpdateGeometry
+		ConditionalMarkTextLayoutDirty();
+		MarkCanvasUpdate(false, true, false);//vertex count changed, drawcall need to collect it again
+	}
+	else
+	{
+		auto newString = GetText().ToString();
+		newString.RemoveAt(startCharIndex, removeCharCount, false);
+		newString.InsertAt(startCharIndex, insertText);
+		text = FText::FromString(MoveTemp(newString));
+		if (visibleCharCount == -1)
+		{
+			MarkVerticesDirty(true, true, true, true);//visible char count is calculated when layout
+		}
+		else if (visibleCharCountDelta != 0)//visible char count change
+		{
+			MarkVerticesDirty(true, true, true, true);
+			visibleCharCount += visibleCharCountDelta;
+		}
+		else//visible char count not change, just mark update vertex and uv
+		{
+			MarkVerticesDirty(false, true, true, false);
+		}
+	}
+}
+
+const FText& UUIText::GetText()const
+{
+	if (bTextPropertyDirty)
+	{
+		bTextPropertyDirty = false;
+		const_cast<UUIText*>(this)->text = FText::FromString(CacheTextGeometryData.GetContent());
+	}
+	if (PendingAppendText.Len() > 0)
+	{
+		const_cast<UUIText*>(this)->text = FText::FromString(text.ToString() + PendingAppendText);
+		PendingAppendText.Reset();
+	}
+	return text;
+}
+
+void UUIText::SetNumericText(const TCHAR* InChars, int32 InLength)
+{
+	//geometry is ready, try to change digits in place
+	bool bCanChangeGeometryDirectly = drawcall.IsValid()
+		&& visibleCharCount != -1
+		&& !bTriangleChanged && !bLocalVertexPositionChanged && !bUVChanged && !bColorChanged
+		&& !HaveGeometryModifier(false)
+		&& !bTextLayoutDirty
+		;
+	bool bAnyChanged = false;
+	if (bCanChangeGeometryDirectly && CacheTextGeometryData.ReplaceDigits(InChars, InLength, geometry.Get(), bAnyChanged))
+	{
+		if (bAnyChanged)
+		{
+			bTextPropertyDirty = true;//sync text property when needed, so no allocation here
+			bTransformChanged = true;//transform changed vertices in UpdateGeometry
+			MarkCanvasUpdate(false, false, false);
+		}
+		return;
+	}
+	const auto& currentString = GetText().ToString();
+	if (currentString.Len() == InLength && FCString::Strncmp(*currentString, InChars, InLength) == 0)return;
+	SetText(FText::FromString(FString(InLength, InChars)));
+}
+
+void UUIText::SetIntegerText(int64 value, int32 minDigitCount)
+{
+	//format from end of buffer
+	TCHAR buffer[32];
+	TCHAR* bufferEnd = buffer + UE_ARRAY_COUNT(buffer);
+	TCHAR* charPtr = bufferEnd;
+	uint64 absValue = value < 0 ? (uint64)(-(value + 1)) + 1 : (uint64)value;
+	minDigitCount = FMath::Clamp(minDigitCount, 1, 20);
+	do
+	{
+		*--charPtr = (TCHAR)('0' + absValue % 10);
+		absValue /= 10;
+	} while (absValue != 0);
+	while (bufferEnd - charPtr < minDigitCount)
+	{
+		*--charPtr = '0';
+	}
+	if (value < 0)
+	{
+		*--charPtr = '-';
+	}
+	SetNumericText(charPtr, bufferEnd - charPtr);
+}
+void UUIText::SetFixedPointText(double value, int32 fractionDigitCount)
+{
+	fractionDigitCount = FMath::Clamp(fractionDigitCount, 0, 9);
+	int64 scale = 1;
+	for (int i = 0; i < fractionDigitCount; i++)scale *= 10;
+	bool bNegative = value < 0;
+	double scaledValue = FMath::RoundHalfFromZero(FMath::Abs(value) * scale);
+	uint64 absValue = scaledValue < (double)MAX_int64 ? (uint64)scaledValue : (uint64)MAX_int64;
+	if (absValue == 0)bNegative = false;//no "-0.00"
+
+	TCHAR buffer[48];
+	TCHAR* bufferEnd = buffer + UE_ARRAY_COUNT(buffer);
+	TCHAR* charPtr = bufferEnd;
+	for (int i = 0; i < fractionDigitCount; i++)
+	{
+		*--charPtr = (TCHAR)('0' + absValue % 10);
+		absValue /= 10;
+	}
+	if (fractionDigitCount > 0)
+	{
+		*--charPtr = '.';
+	}
+	do
+	{
+		*--charPtr = (TCHAR)('0' + absValue % 10);
+		absValue /= 10;
+	} while (absValue != 0);
+	if (bNegative)
+	{
+		*--charPtr = '-';
+	}
+	SetNumericText(charPtr, bufferEnd - charPtr);
+}
+void UUIText::SetTimeText(double seconds, bool showHour, int32 fractionDigitCount)
+{
+	fractionDigitCount = FMath::Clamp(fractionDigitCount, 0, 3);
+	int64 scale = 1;
+	for (int i = 0; i < fractionDigitCount; i++)scale *= 10;
+	//floor so the displayed second not reach next one before it really does
+	double scaledSeconds = FMath::Clamp(FMath::FloorToDouble(FMath::Max(seconds, 0.0) * scale), 0.0, (double)MAX_int64);
+	uint64 totalValue = (uint64)scaledSeconds;
+	uint64 fraction = totalValue % scale;
+	uint64 totalSeconds = totalValue / scale;
+	uint64 second = totalSeconds % 60;
+	uint64 minute = totalSeconds / 60;
+	uint64 hour = 0;
+	if (showHour)
+	{
+		hour = minute / 60;
+		minute = minute % 60;
+	}
+
+	TCHAR buffer[48];
+	TCHAR* bufferEnd = buffer + UE_ARRAY_COUNT(buffer);
+	TCHAR* charPtr = bufferEnd;
+	auto PushNumber = [&charPtr](uint64 number, int32 minDigitCount) {
+		int32 digitCount = 0;
+		do
+		{
+			*--charPtr = (TCHAR)('0' + number % 10);
+			number /= 10;
+			digitCount++;
+		} while (number != 0 || digitCount < minDigitCount);
+	};
+	if (fractionDigitCount > 0)
+	{
+		PushNumber(fraction, fractionDigitCount);
+		*--charPtr = '.';
+	}
+	PushNumber(second, 2);
+	*--charPtr = ':';
+	PushNumber(minute, 2);
+	if (showHour)
+	{
+		*--charPtr = ':';
+		PushNumber(hour, 2);
+	}
+	SetNumericText(charPtr, bufferEnd - charPtr);
+}
+
 void UUIText::SetFontSize(float newSize) {
 	if (size != newSize)
 	{
@@ -630,6 +892,14 @@ void UUIText::SetUseKerning(bool value)
 		MarkVertexPositionDirty();
 	}
 }
+void UUIText::SetFixedWidthDigit(bool value)
+{
+	if (fixedWidthDigit != value)
+	{
+		fixedWidthDigit = value;
+		MarkVertexPositionDirty();
+	}
+}
 void UUIText::SetFontSpace(FVector2D newSpace) {
 	if (space != newSpace)
 	{
@@ -744,6 +1014,32 @@ void UUIText::SetRichTextCustomStyleData(ULGUIRichTextCustomStyleData* value)
 		richTextCustomStyleData = value;
 	}
 }
+void UUIText::SetRevealCharCount(int32 value)
+{
+	value = FMath::Max(value, -1);
+	if (revealCharCount != value)
+	{
+		revealCharCount = value;
+		//if geometry is ready, change revealed glyph's triangle indices directly. GeometryModifier need to process full geometry, so can't do that.
+		bool bCanChangeGeometryDirectly = drawcall.IsValid()
+			&& !bTriangleChanged && !bLocalVertexPositionChanged && !bUVChanged && !bColorChanged
+			&& !HaveGeometryModifier(false);
+		auto GeometryToChange = bCanChangeGeometryDirectly ? geometry.Get() : nullptr;
+		auto PrevIndicesCount = geometry->triangles.Num();
+		if (CacheTextGeometryData.SetRevealCharCount(revealCharCount, GeometryToChange) && GeometryToChange != nullptr)
+		{
+			drawcall->IndicesCount += geometry->triangles.Num() - PrevIndicesCount;
+			drawcall->bNeedToUpdateVertex = true;
+			MarkCanvasUpdate(false, false, false);
+		}
+		else
+		{
+			//text layout not change, only triangle indices change, so use Super's MarkVerticesDirty which will not mark layout dirty
+			Super::MarkVerticesDirty(true, false, false, false);
+			MarkCanvasUpdate(false, false, false, true);//triangle indices count change, drawcall need to collect it again
+		}
+	}
+}
 
 
 void UUIText::ClearCreatedRichTextImageObject()
@@ -911,16 +1207,17 @@ bool UUIText::UpdateCacheTextGeometry()const
 {
 	if (!IsValid(this->GetFont()))return false;
 
-	if (visibleCharCount == -1)visibleCharCount = VisibleCharCountInString(text.ToString());
-	auto CanvasGroupAlpha = (this->GetRichText() && CanvasGroup.IsValid()) ? CanvasGroup->GetFinalAlpha() : 1.0f;
+	if (visibleCharCount == -1)visibleCharCount = VisibleCharCountInString(GetText().ToString());
+	//content is edited in layout cache and text property is not sync yet, so use it directly, no need to copy and compare the whole string
+	const auto& content = (bTextPropertyDirty && PendingAppendText.Len() == 0) ? CacheTextGeometryData.GetContent() : GetText().ToString();
+	//CanvasGroup's alpha is applied by drawcall, so use self color
 	CacheTextGeometryData.SetInputParameters(
-		this->text.ToString()
+		content
 		, this->visibleCharCount
 		, this->GetWidth()
 		, this->GetHeight()
 		, FVector2f(this->GetPivot())
-		, this->GetFinalColor()
-		, CanvasGroupAlpha
+		, this->GetColor()
 		, FVector2f(this->GetFontSpace())
 		, this->GetFontSize()
 		, this->GetParagraphHorizontalAlignment()
@@ -933,9 +1230,13 @@ bool UUIText::UpdateCacheTextGeometry()const
 		, this->GetRichTextTagFilterFlags()
 		, this->GetFont()
 	);
-	if (geometry->vertices.Num() == 0)//@todo: geometry is cleared before OnUpdateGeometry, consider use a cached UIGeometry
+	if (CacheTextGeometryData.GetRevealCharCount() != revealCharCount)
 	{
-		CacheTextGeometryData.MarkDirty();
+		CacheTextGeometryData.SetRevealCharCount(revealCharCount, nullptr);
+	}
+	if (geometry->vertices.Num() == 0)//@todo: geometry is cleared before OnUpdateGeometry, consider use a cached UIGeometry. For now only reveal use cached UIGeometry
+	{
+		CacheTextGeometryData.OnGeometryCleared();
 	}
 	CacheTextGeometryData.ConditaionalCalculateGeometry();
 	return true;
@@ -1021,163 +1322,18 @@ void UUIText::GenerateRichTextImageObject()
 
 bool UUIText::MoveCaret(int32 moveType, int32& inOutCaretPositionIndex, int32& inOutCaretPositionLineIndex, FVector2f& inOutCaretPosition)
 {
-	auto originCaretPositionIndex = inOutCaretPositionIndex;
-	auto originCaretPositionLineIndex = inOutCaretPositionLineIndex;
-
 	UpdateCacheTextGeometry();
-	auto& cacheLinePropertyArray = CacheTextGeometryData.cacheLinePropertyArray;
-	//moveType 0-left, 1-right, 2-up, 3-down, 4-start, 5-end
-	switch (moveType)
-	{
-	case 0:
-	case 1:
-	{
-		if (moveType == 0)
-		{
-			if (inOutCaretPositionIndex > 0)
-			{
-				inOutCaretPositionIndex--;
-			}
-		}
-		else
-		{
-			inOutCaretPositionIndex++;
-		}
-
-		bool foundCaret = false;
-		int totalCaretIndex = 0;
-		for (int lineIndex = 0; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
-		{
-			auto& lineProperty = cacheLinePropertyArray[lineIndex];
-			for (int caretIndex = 0; caretIndex < lineProperty.caretPropertyList.Num(); caretIndex++)
-			{
-				if (totalCaretIndex == inOutCaretPositionIndex)//find caret
-				{
-					inOutCaretPositionLineIndex = lineIndex;
-					inOutCaretPosition = lineProperty.caretPropertyList[caretIndex].caretPosition;
-					//stop loop
-					foundCaret = true;
-					caretIndex = lineProperty.caretPropertyList.Num();
-					lineIndex = cacheLinePropertyArray.Num();
-				}
-				else
-				{
-					totalCaretIndex++;
-				}
-			}
-		}
-		if (!foundCaret)//could be out of range, use last caret
-		{
-			inOutCaretPositionIndex = totalCaretIndex - 1;
-			inOutCaretPositionLineIndex = cacheLinePropertyArray.Num() - 1;
-			auto& lastLineProperty = cacheLinePropertyArray[cacheLinePropertyArray.Num() - 1];
-			inOutCaretPosition = lastLineProperty.caretPropertyList[lastLineProperty.caretPropertyList.Num() - 1].caretPosition;
-		}
-	}
-	break;
-	case 2:
-	case 3:
-	{
-		if (moveType == 2)
-		{
-			if (inOutCaretPositionLineIndex > 0)
-			{
-				inOutCaretPositionLineIndex--;
-			}
-		}
-		else
-		{
-			if (inOutCaretPositionLineIndex < cacheLinePropertyArray.Num() - 1)
-			{
-				inOutCaretPositionLineIndex++;
-			}
-		}
-		auto& lineProperty = cacheLinePropertyArray[inOutCaretPositionLineIndex];
-		float minDistance = MAX_FLT;
-		int accumulatedCaretIndex = 0;
-		for (int lineIndex = 0; lineIndex < inOutCaretPositionLineIndex; lineIndex++)
-		{
-			accumulatedCaretIndex += cacheLinePropertyArray[lineIndex].caretPropertyList.Num();
-		}
-		auto originCaretPosition = inOutCaretPosition;
-		for (int caretIndex = 0; caretIndex < lineProperty.caretPropertyList.Num(); caretIndex++)
-		{
-			auto& caretProperty = lineProperty.caretPropertyList[caretIndex];
-			auto distance = FMath::Abs(originCaretPosition.X - caretProperty.caretPosition.X);
-			if (distance < minDistance)
-			{
-				minDistance = distance;
-				inOutCaretPositionIndex = accumulatedCaretIndex;
-				inOutCaretPosition = caretProperty.caretPosition;
-			}
-			else//found min distance at prev
-			{
-				break;
-			}
-			accumulatedCaretIndex++;
-		}
-	}
-	break;
-	case 4:
-	{
-		inOutCaretPositionIndex = 0;
-		inOutCaretPositionLineIndex = 0;
-		inOutCaretPosition = cacheLinePropertyArray[0].caretPropertyList[0].caretPosition;
-	}
-	break;
-	case 5:
-	{
-		int32 accumulatedCaretIndex = 0;
-		for (int lineIndex = 0; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
-		{
-			accumulatedCaretIndex += cacheLinePropertyArray[lineIndex].caretPropertyList.Num();
-		}
-		inOutCaretPositionIndex = accumulatedCaretIndex - 1;
-		inOutCaretPositionLineIndex = cacheLinePropertyArray.Num() - 1;
-		auto& lastLineProperty = cacheLinePropertyArray[cacheLinePropertyArray.Num() - 1];
-		inOutCaretPosition = lastLineProperty.caretPropertyList[lastLineProperty.caretPropertyList.Num() - 1].caretPosition;
-	}
-	break;
-	}
-	if (originCaretPositionIndex != inOutCaretPositionIndex || originCaretPositionLineIndex != inOutCaretPositionLineIndex)
-	{
-		return true;
-	}
-	return false;
+	return CacheTextGeometryData.MoveCaret(moveType, inOutCaretPositionIndex, inOutCaretPositionLineIndex, inOutCaretPosition);
 }
-
 int UUIText::GetCharIndexByCaretIndex(int32 inCaretPositionIndex)
 {
 	UpdateCacheTextGeometry();
-	auto& cacheLinePropertyArray = CacheTextGeometryData.cacheLinePropertyArray;
-	int accumulatedCaretIndex = 0;
-	for (int lineIndex = 0; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
-	{
-		auto& lineProperty = cacheLinePropertyArray[lineIndex];
-		for (int caretIndex = 0; caretIndex < lineProperty.caretPropertyList.Num(); caretIndex++)
-		{
-			if (accumulatedCaretIndex == inCaretPositionIndex)//find caret
-			{
-				return lineProperty.caretPropertyList[caretIndex].charIndex;
-			}
-			accumulatedCaretIndex++;
-		}
-	}
-	//not found caret, use last one
-	auto& lastLineProperty = cacheLinePropertyArray[cacheLinePropertyArray.Num() - 1];
-	return lastLineProperty.caretPropertyList[lastLineProperty.caretPropertyList.Num() - 1].charIndex;
+	return CacheTextGeometryData.GetCharIndexByCaretIndex(inCaretPositionIndex);
 }
 int UUIText::GetLastCaret()
 {
 	UpdateCacheTextGeometry();
-	auto& cacheLinePropertyArray = CacheTextGeometryData.cacheLinePropertyArray;
-	int totalCaretIndex = 0;
-	for (int lineIndex = 0; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
-	{
-		auto& lineProperty = cacheLinePropertyArray[lineIndex];
-		totalCaretIndex += lineProperty.caretPropertyList.Num();
-	}
-	return totalCaretIndex - 1;
+	return CacheTextGeometryData.GetLastCaret();
 }
 //caret is at left side of char
 void UUIText::FindCaretByIndex(int32& inOutCaretPositionIndex, FVector2f& outCaretPosition, int32& outCaretPositionLineIndex, int32& outVisibleCaretStartIndex)
@@ -1276,7 +1432,7 @@ void UUIText::FindCaretByIndex(int32& inOutCaretPositionIndex, FVector2f& outCar
 }
 void UUIText::FindCaret(FVector2f& inOutCaretPosition, int32 inCaretPositionLineIndex, int32& outCaretPositionIndex)
 {
-	if (text.ToString().Len() == 0)//no text
+	if (GetText().IsEmpty())//no text
 		return;
 	UpdateCacheTextGeometry();
 	auto& cacheTextPropertyArray = CacheTextGeometryData.cacheLinePropertyArray;
@@ -1304,7 +1460,7 @@ void UUIText::FindCaret(FVector2f& inOutCaretPosition, int32 inCaretPositionLine
 //find caret by position, caret is on left side of char
 void UUIText::FindCaretByWorldPosition(FVector inWorldPosition, FVector2f& outCaretPosition, int32& outCaretPositionLineIndex, int32& outCaretPositionIndex)
 {
-	if (text.ToString().Len() == 0)//no text
+	if (GetText().IsEmpty())//no text
 	{
 		outCaretPositionIndex = 0;
 		int tempVisibleCharStartIndex = 0;
@@ -1367,199 +1523,17 @@ void UUIText::FindCaretByWorldPosition(FVector inWorldPosition, FVector2f& outCa
 int UUIText::GetCaretIndexByCharIndex(int32 inCharIndex)
 {
 	UpdateCacheTextGeometry();
-	int accumulatedCaretIndex = 0;
-	auto& cacheLinePropertyArray = CacheTextGeometryData.cacheLinePropertyArray;
-	for (int lineIndex = 0; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
-	{
-		auto& lineProperty = cacheLinePropertyArray[lineIndex];
-		for (int caretIndex = 0; caretIndex < lineProperty.caretPropertyList.Num(); caretIndex++)
-		{
-			if (lineProperty.caretPropertyList[caretIndex].charIndex == inCharIndex)//find char
-			{
-				return accumulatedCaretIndex;
-			}
-			else
-			{
-				accumulatedCaretIndex++;
-			}
-		}
-	}
-	return accumulatedCaretIndex - 1;//not found, return last one
+	return CacheTextGeometryData.GetCaretIndexByCharIndex(inCharIndex);
 }
-
 bool UUIText::GetVisibleCharRangeForMultiLine(int32& inOutCaretPositionIndex, int32& inOutCaretPositionLineIndex, int32& inOutVisibleCaretStartLineIndex, int32& inOutVisibleCaretStartIndex, int inMaxLineCount, int32& outVisibleCharStartIndex, int32& outVisibleCharCount)
 {
 	UpdateCacheTextGeometry();
-	auto& cacheLinePropertyArray = CacheTextGeometryData.cacheLinePropertyArray;
-	int accumulatedCaretIndex = 0;
-	bool foundCaret = false;
-	for (int lineIndex = 0; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
-	{
-		auto& lineProperty = cacheLinePropertyArray[lineIndex];
-		for (int caretIndex = 0; caretIndex < lineProperty.caretPropertyList.Num(); caretIndex++)
-		{
-			if (inOutCaretPositionIndex == accumulatedCaretIndex)//find caret
-			{
-				inOutCaretPositionLineIndex = lineIndex;
-				lineIndex = cacheLinePropertyArray.Num();
-				foundCaret = true;
-				break;
-			}
-			else
-			{
-				accumulatedCaretIndex++;
-			}
-		}
-	}
-	if (!foundCaret)//could be last caret
-	{
-		inOutCaretPositionLineIndex = cacheLinePropertyArray.Num() - 1;
-	}
-
-	inOutCaretPositionLineIndex = FMath::Clamp(inOutCaretPositionLineIndex, 0, cacheLinePropertyArray.Num() - 1);
-
-	if (inOutVisibleCaretStartLineIndex > inOutCaretPositionLineIndex)
-	{
-		inOutVisibleCaretStartLineIndex = inOutCaretPositionLineIndex;
-	}
-	if (inOutVisibleCaretStartLineIndex + (inMaxLineCount - 1) < inOutCaretPositionLineIndex)
-	{
-		inOutVisibleCaretStartLineIndex = inOutCaretPositionLineIndex - (inMaxLineCount - 1);
-	}
-
-	int calculatedLineCount = 0;
-	bool outOfRange = false;
-	int VisibleCaretEndLineIndex = inOutCaretPositionLineIndex;
-	//check from CaretLineIndex to VisibleCaretStartLineIndex
-	for (int lineIndex = inOutCaretPositionLineIndex; lineIndex >= 0 && lineIndex >= inOutVisibleCaretStartLineIndex; lineIndex--)
-	{
-		auto& lineProperty = cacheLinePropertyArray[lineIndex];
-		calculatedLineCount++;
-		if (calculatedLineCount >= inMaxLineCount)
-		{
-			outOfRange = true;
-			inOutVisibleCaretStartLineIndex = lineIndex;
-			break;
-		}
-	}
-	if (!outOfRange)
-	{
-		//check from CaretLineIndex to bottom end
-		for (int lineIndex = inOutCaretPositionLineIndex + 1; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
-		{
-			auto& lineProperty = cacheLinePropertyArray[lineIndex];
-			calculatedLineCount++;
-			VisibleCaretEndLineIndex++;
-			if (calculatedLineCount >= inMaxLineCount)
-			{
-				outOfRange = true;
-				break;
-			}
-		}
-
-		if (!outOfRange)
-		{
-			//check from VisibleCaretStartLineIndex to top
-			for (int lineIndex = inOutVisibleCaretStartLineIndex - 1; lineIndex >= 0 && lineIndex < cacheLinePropertyArray.Num(); lineIndex--)
-			{
-				auto& lineProperty = cacheLinePropertyArray[lineIndex];
-				calculatedLineCount++;
-				if (calculatedLineCount >= inMaxLineCount)
-				{
-					outOfRange = true;
-					break;
-				}
-				inOutVisibleCaretStartLineIndex--;
-			}
-		}
-	}
-	inOutVisibleCaretStartIndex = 0;
-	for (int lineIndex = 0; lineIndex < inOutVisibleCaretStartLineIndex; lineIndex++)
-	{
-		auto& lineProperty = cacheLinePropertyArray[lineIndex];
-		inOutVisibleCaretStartIndex += lineProperty.caretPropertyList.Num();
-	}
-	auto& startLineProperty = cacheLinePropertyArray[inOutVisibleCaretStartLineIndex];
-	auto& endLineProperty = cacheLinePropertyArray[VisibleCaretEndLineIndex];
-	outVisibleCharStartIndex = startLineProperty.caretPropertyList[0].charIndex;
-	auto lastIndex = endLineProperty.caretPropertyList.Num() - 1;
-	auto lastCharIndex = endLineProperty.caretPropertyList[lastIndex].charIndex;
-	if (lastCharIndex == -1)//-1 means newline break, so use next caret's char index
-	{
-		lastCharIndex = endLineProperty.caretPropertyList[lastIndex - 1].charIndex + 1;
-	}
-	outVisibleCharCount = lastCharIndex - outVisibleCharStartIndex;
-	return outOfRange;
+	return CacheTextGeometryData.GetVisibleCharRangeForMultiLine(inOutCaretPositionIndex, inOutCaretPositionLineIndex, inOutVisibleCaretStartLineIndex, inOutVisibleCaretStartIndex, inMaxLineCount, outVisibleCharStartIndex, outVisibleCharCount);
 }
-
 bool UUIText::GetVisibleCharRangeForSingleLine(int32& inOutCaretPositionIndex, int32& inOutVisibleCaretStartIndex, float inMaxWidth, int32& outVisibleCharStartIndex, int32& outVisibleCharCount)
 {
 	UpdateCacheTextGeometry();
-	auto& cacheTextPropertyArray = CacheTextGeometryData.cacheLinePropertyArray;
-	auto& lineProperty = cacheTextPropertyArray[0];//just single line
-	inOutCaretPositionIndex = FMath::Clamp(inOutCaretPositionIndex, 0, lineProperty.caretPropertyList.Num() - 1);
-
-	if (inOutVisibleCaretStartIndex > inOutCaretPositionIndex)
-	{
-		inOutVisibleCaretStartIndex = inOutCaretPositionIndex;
-	}
-
-	float calculatedSize = 0;
-	bool outOfRange = false;
-	int VisibleCaretEndIndex = inOutCaretPositionIndex;
-	auto caretPosition = lineProperty.caretPropertyList[inOutCaretPositionIndex].caretPosition;
-	//check from caret to VisibleCaretStartIndex
-	for (int caretIndex = inOutCaretPositionIndex; caretIndex >= 0 && caretIndex >= inOutVisibleCaretStartIndex; caretIndex--)
-	{
-		auto& caretProperty = lineProperty.caretPropertyList[caretIndex];
-		calculatedSize = caretPosition.X - caretProperty.caretPosition.X;
-		if (calculatedSize >= inMaxWidth)
-		{
-			outOfRange = true;
-			inOutVisibleCaretStartIndex = caretIndex + 1;
-			break;
-		}
-	}
-	if (!outOfRange)
-	{
-		//check from caret to right end
-		float tempWidth = calculatedSize;
-		for (int caretIndex = inOutCaretPositionIndex; caretIndex < lineProperty.caretPropertyList.Num(); caretIndex++)
-		{
-			auto& caretProperty = lineProperty.caretPropertyList[caretIndex];
-			auto dist = caretProperty.caretPosition.X - caretPosition.X;
-			tempWidth = calculatedSize + dist;
-			if (tempWidth > inMaxWidth)
-			{
-				outOfRange = true;
-				break;
-			}
-			VisibleCaretEndIndex++;
-		}
-		VisibleCaretEndIndex--;
-		calculatedSize = tempWidth;
-
-		if (!outOfRange)
-		{
-			//check from VisibleCaretStartIndex to left
-			for (int caretIndex = inOutVisibleCaretStartIndex - 1; caretIndex >= 0; caretIndex--)
-			{
-				auto& caretProperty = lineProperty.caretPropertyList[caretIndex];
-				auto dist = caretPosition.X - caretProperty.caretPosition.X;
-				tempWidth = calculatedSize + dist;
-				if (tempWidth >= inMaxWidth)
-				{
-					outOfRange = true;
-					break;
-				}
-				inOutVisibleCaretStartIndex--;
-			}
-			calculatedSize = tempWidth;
-		}
-	}
-	outVisibleCharStartIndex = lineProperty.caretPropertyList[inOutVisibleCaretStartIndex].charIndex;
-	outVisibleCharCount = lineProperty.caretPropertyList[VisibleCaretEndIndex].charIndex - outVisibleCharStartIndex;
-	return outOfRange;
+	return CacheTextGeometryData.GetVisibleCharRangeForSingleLine(inOutCaretPositionIndex, inOutVisibleCaretStartIndex, inMaxWidth, outVisibleCharStartIndex, outVisibleCharCount);
 }
 
 void UUIText::GetSelectionProperty(int32 InSelectionStartCaretIndex, int32 InSelectionEndCaretIndex, TArray<FUITextSelectionProperty>& OutSelectionProeprtyArray)
@@ -1623,6 +1597,96 @@ void UUIText::GetSelectionProperty(int32 InSelectionStartCaretIndex, int32 InSel
 	}
 }
 
+void UUIText::BenchmarkTextLayout(UWorld* InWorld, int32 InLabelCount, int32 InRichTextDocumentSize)
+{
+	if (!IsValid(InWorld))
+	{
+		UE_LOG(LGUI, Error, TEXT("[%s].%d Need a valid world"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__);
+		return;
+	}
+	auto Font = ULGUIFontData_BaseObject::GetDefaultFont();
+	if (!IsValid(Font))return;
+	Font->InitFont();
+	InLabelCount = FMath::Max(InLabelCount, 1);
+	InRichTextDocumentSize = FMath::Max(InRichTextDocumentSize, 1);
+	auto Actor = InWorld->SpawnActor<AActor>();
+	if (Actor == nullptr)return;
+	auto Root = NewObject<UUIItem>(Actor);
+	Actor->SetRootComponent(Root);
+	Root->RegisterComponent();
+	auto CreateText = [&](float Width) {
+		auto Text = NewObject<UUIText>(Actor);
+		Text->SetupAttachment(Root);
+		Text->RegisterComponent();
+		Text->SetFont(Font);
+		Text->SetWidth(Width);
+		return Text;
+	};
+
+	//labels: all share the font, so only the first label should fill the font's char data fast table
+	TArray<UUIText*> Labels;
+	Labels.Reserve(InLabelCount);
+	for (int i = 0; i < InLabelCount; i++)
+	{
+		Labels.Add(CreateText(200));
+	}
+	auto LayoutLabels = [&](int32 Pass) {
+		auto StartTime = FPlatformTime::Seconds();
+		for (int i = 0; i < Labels.Num(); i++)
+		{
+			Labels[i]->SetText(FText::FromString(FString::Printf(TEXT("Label %d value %d"), i, Pass * 7919 + i)));
+			Labels[i]->GetTextRealSize();
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	};
+	auto FirstLabelTime = LayoutLabels(0);
+	auto LabelTime = LayoutLabels(1);
+
+	//document: long rich text with style tags and many lines
+	auto BuildDocument = [=](int32 Seed) {
+		static const TCHAR* Words[] = { TEXT("lorem"), TEXT("ipsum"), TEXT("dolor"), TEXT("sit"), TEXT("amet"), TEXT("consectetur"), TEXT("adipiscing"), TEXT("elit") };
+		static const TCHAR* Tags[][2] = { { TEXT("<b>"), TEXT("</b>") }, { TEXT("<i>"), TEXT("</i>") }, { TEXT("<color=#ff0000>"), TEXT("</color>") }, { TEXT("<size=20>"), TEXT("</size>") } };
+		FRandomStream Random(Seed);
+		FString Document;
+		Document.Reserve(InRichTextDocumentSize + 32);
+		int32 WordCount = 0;
+		while (Document.Len() < InRichTextDocumentSize)
+		{
+			auto Word = Words[Random.RandRange(0, UE_ARRAY_COUNT(Words) - 1)];
+			if (Random.RandRange(0, 7) == 0)
+			{
+				auto& Tag = Tags[Random.RandRange(0, UE_ARRAY_COUNT(Tags) - 1)];
+				Document.Append(Tag[0]).Append(Word).Append(Tag[1]);
+			}
+			else
+			{
+				Document.Append(Word);
+			}
+			Document.AppendChar(++WordCount % 12 == 0 ? TEXT('\n') : TEXT(' '));
+		}
+		return Document;
+	};
+	FText Documents[2] = { FText::FromString(BuildDocument(1)), FText::FromString(BuildDocument(2)) };
+	auto DocumentText = CreateText(1024);
+	DocumentText->SetRichText(true);
+	DocumentText->SetOverflowType(EUITextOverflowType::VerticalOverflow);
+	DocumentText->SetText(Documents[1]);
+	DocumentText->GetTextRealSize();
+	const int32 DocumentIteration = 8;
+	auto StartTime = FPlatformTime::Seconds();
+	for (int i = 0; i < DocumentIteration; i++)
+	{
+		DocumentText->SetText(Documents[i % 2]);
+		DocumentText->GetTextRealSize();
+	}
+	auto DocumentTime = (FPlatformTime::Seconds() - StartTime) / DocumentIteration;
+
+	UE_LOG(LGUI, Log, TEXT("[%s].%d Label count:%d, first layout:%fms, layout:%fms (%fms per label), rich text document length:%d, layout:%fms")
+		, ANSI_TO_TCHAR(__FUNCTION__), __LINE__, InLabelCount, FirstLabelTime * 1000, LabelTime * 1000, LabelTime * 1000 / InLabelCount
+		, Documents[0].ToString().Len(), DocumentTime * 1000);
+	Actor->Destroy();
+}
+
 #undef LOCTEXT_NAMESPACE
 
 #if LGUI_CAN_DISABLE_OPTIMIZATION
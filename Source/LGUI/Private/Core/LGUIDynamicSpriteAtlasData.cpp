@@ -11,30 +11,43 @@
 #include "Rendering/Texture2DResource.h"
 #include "Core/IUISpriteRenderableInterface.h"
 #include "RenderingThread.h"
+#include "HAL/IConsoleManager.h"
 
 
+static int32 GLGUIDynamicSpriteAtlasBackgroundDefragment = 1;
+static FAutoConsoleVariableRef CVarLGUIDynamicSpriteAtlasBackgroundDefragment(
+	TEXT("lgui.DynamicSpriteAtlas.BackgroundDefragment"),
+	GLGUIDynamicSpriteAtlasBackgroundDefragment,
+	TEXT("Defragment one dynamic sprite atlas page per frame after sprites are removed from it."),
+	ECVF_Default);
+
 void FLGUIDynamicSpriteAtlasData::EnsureAtlasTexture(const FName& packingTag)
 {
-	if (!IsValid(atlasTexture))
+	if (pages.Num() == 0)
 	{
-#if WITH_EDITOR
-		int32 defaultAtlasTextureSize = ULGUISettings::GetAtlasTextureInitialSize(packingTag);
-#else
-		static int32 defaultAtlasTextureSize = ULGUISettings::GetAtlasTextureInitialSize(packingTag);
-#endif
-		atlasBinPack.Init(defaultAtlasTextureSize, defaultAtlasTextureSize);
-		CreateAtlasTexture(packingTag, 0, defaultAtlasTextureSize);
+		AddPage(packingTag);
 	}
 }
-void FLGUIDynamicSpriteAtlasData::CreateAtlasTexture(const FName& packingTag, int oldTextureSize, int newTextureSize)
+int32 FLGUIDynamicSpriteAtlasData::AddPage(const FName& packingTag)
+{
+	int32 defaultAtlasTextureSize = ULGUISettings::GetAtlasTextureInitialSize(packingTag);
+	int32 pageIndex = pages.AddDefaulted();
+	pages[pageIndex].atlasBinPack = rbp::RectPacker::Create(ULGUISettings::GetAtlasRectPacker(packingTag));
+	pages[pageIndex].atlasBinPack->Init(defaultAtlasTextureSize, defaultAtlasTextureSize);
+	CreateAtlasTexture(packingTag, pageIndex, 0, defaultAtlasTextureSize);
+	return pageIndex;
+}
+int32 FLGUIDynamicSpriteAtlasData::FindPageIndex(const UTexture2D* InAtlasTexture)const
+{
+	if (InAtlasTexture == nullptr)return INDEX_NONE;
+	return pages.IndexOfByPredicate([InAtlasTexture](const FLGUIDynamicSpriteAtlasPage& Item) {
+		return Item.atlasTexture == InAtlasTexture;
+		});
+}
+void FLGUIDynamicSpriteAtlasData::CreateAtlasTexture(const FName& packingTag, int32 pageIndex, int oldTextureSize, int newTextureSize)
 {
-#if WITH_EDITOR
 	bool atlasSRGB = ULGUISettings::GetAtlasTextureSRGB(packingTag);
 	auto filter = ULGUISettings::GetAtlasTextureFilter(packingTag);
-#else
-	static bool atlasSRGB = ULGUISettings::GetAtlasTextureSRGB(packingTag);
-	static auto filter = ULGUISettings::GetAtlasTextureFilter(packingTag);
-#endif
 	auto texture = LGUIUtils::CreateTexture(newTextureSize, FColor::Transparent
 		, GetTransientPackage()
 		, FName(*FString::Printf(TEXT("LGUIDynamicSpriteAtlasData_Texture_%d"), LGUIUtils::LGUITextureNameSuffix++))
@@ -46,8 +59,9 @@ void FLGUIDynamicSpriteAtlasData::CreateAtlasTexture(const FName& packingTag, in
 	texture->Filter = filter;
 	texture->UpdateResource();
 	texture->AddToRoot();//@todo: is this really need to AddToRoot?
-	auto OldTexture = this->atlasTexture;
-	this->atlasTexture = texture;
+	auto& page = this->pages[pageIndex];
+	auto OldTexture = page.atlasTexture;
+	page.atlasTexture = texture;
 
 	//copy old texture to new one
 	if (IsValid(OldTexture) && oldTextureSize > 0)
@@ -76,67 +90,87 @@ void FLGUIDynamicSpriteAtlasData::CreateAtlasTexture(const FName& packingTag, in
 		}
 	}
 }
-int32 FLGUIDynamicSpriteAtlasData::ExpendTextureSize(const FName& packingTag)
+int32 FLGUIDynamicSpriteAtlasData::ExpendTextureSize(const FName& packingTag, int32 pageIndex)
 {
-	int32 oldTextureSize = this->atlasBinPack.GetBinWidth();
+	auto& page = this->pages[pageIndex];
+	int32 oldTextureSize = page.atlasBinPack->GetBinWidth();
 	int32 newTextureSize = oldTextureSize + oldTextureSize;
 
-	this->atlasBinPack.ExpendSize(newTextureSize, newTextureSize);
+	page.atlasBinPack->ExpendSize(newTextureSize, newTextureSize);
 	//create new texture
-	this->CreateAtlasTexture(packingTag, oldTextureSize, newTextureSize);
+	this->CreateAtlasTexture(packingTag, pageIndex, oldTextureSize, newTextureSize);
 	//scale down sprite uv
-	for (ULGUISpriteData* spriteItem : this->spriteDataArray)
+	for (ULGUISpriteData* spriteItem : page.spriteDataArray)
 	{
 		if (IsValid(spriteItem))
 		{
-			spriteItem->atlasTexture = this->atlasTexture;
+			spriteItem->atlasTexture = page.atlasTexture;
 			spriteItem->spriteInfo.ScaleUV(0.5f);
 		}
 	}
 	//tell UISprite to scale down uv
-	for (auto itemSprite : this->renderSpriteArray)
-	{
-		if (itemSprite.IsValid())
-		{
-			IUISpriteRenderableInterface::Execute_ApplyAtlasTextureScaleUp(itemSprite.Get());
-		}
-	}
+	NotifyRenderSprites(page.atlasTexture, true);
 	//callback function
 	if (OnTextureSizeExpanded.IsBound())
 	{
-		OnTextureSizeExpanded.Broadcast(this->atlasTexture, newTextureSize);
+		OnTextureSizeExpanded.Broadcast(page.atlasTexture, newTextureSize);
 	}
 
 	return newTextureSize;
 }
-int32 FLGUIDynamicSpriteAtlasData::GetWillExpendTextureSize()const
+int32 FLGUIDynamicSpriteAtlasData::GetWillExpendTextureSize(int32 pageIndex)const
 {
-	int32 oldTextureSize = this->atlasBinPack.GetBinWidth();
+	int32 oldTextureSize = this->pages[pageIndex].atlasBinPack->GetBinWidth();
 	return oldTextureSize + oldTextureSize;
 }
+void FLGUIDynamicSpriteAtlasData::NotifyRenderSprites(const UTexture2D* InPageTexture, bool InIsScaleUp)
+{
+	for (auto itemSprite : this->renderSpriteArray)
+	{
+		if (itemSprite.IsValid())
+		{
+			//only objects that render sprite in this page
+			auto spriteData = Cast<ULGUISpriteData>(IUISpriteRenderableInterface::Execute_SpriteRenderableGetSprite(itemSprite.Get()));
+			if (spriteData == nullptr || spriteData->atlasTexture != InPageTexture)continue;
+			if (InIsScaleUp)
+			{
+				IUISpriteRenderableInterface::Execute_ApplyAtlasTextureScaleUp(itemSprite.Get());
+			}
+			else
+			{
+				IUISpriteRenderableInterface::Execute_ApplyAtlasTextureChange(itemSprite.Get());
+			}
+		}
+	}
+}
 void FLGUIDynamicSpriteAtlasData::CheckSprite(const FName& packingTag)
 {
-	for (int i = this->spriteDataArray.Num() - 1; i >= 0; i--)
+	for (auto& page : this->pages)
 	{
-		auto itemSprite = this->spriteDataArray[i];
-		if (IsValid(itemSprite))
+		for (int i = page.spriteDataArray.Num() - 1; i >= 0; i--)
 		{
-			if (IsValid(itemSprite->GetPackingAtlas()))
+			auto itemSprite = page.spriteDataArray[i];
+			if (IsValid(itemSprite))
 			{
-				this->spriteDataArray.RemoveAt(i);
+				if (IsValid(itemSprite->GetPackingAtlas()) || itemSprite->GetPackingTag() != packingTag)
+				{
+					page.atlasBinPack->Free(itemSprite->atlasPackedRect);
+					page.bNeedDefragment = true;
+					page.spriteDataArray.RemoveAt(i);
+					this->unusedSpriteArray.RemoveSingle(itemSprite);
+				}
 			}
 			else
 			{
-				if (itemSprite->GetPackingTag() != packingTag)
+				//sprite is destroyed, free it's space. If already collected then rect is unknown, defragment will reclaim it
+				if (itemSprite != nullptr)
 				{
-					this->spriteDataArray.RemoveAt(i);
+					page.atlasBinPack->Free(itemSprite->atlasPackedRect);
 				}
+				page.bNeedDefragment = true;
+				page.spriteDataArray.RemoveAt(i);
 			}
 		}
-		else
-		{
-			this->spriteDataArray.RemoveAt(i);
-		}
 	}
 	for (int i = this->renderSpriteArray.Num() - 1; i >= 0; i--)
 	{
@@ -167,6 +201,226 @@ void FLGUIDynamicSpriteAtlasData::CheckSprite(const FName& packingTag)
 			this->renderSpriteArray.RemoveAt(i);
 		}
 	}
+	//count render reference again, because render object may be destroyed without remove from sprite
+	for (auto& page : this->pages)
+	{
+		for (auto& itemSprite : page.spriteDataArray)
+		{
+			itemSprite->atlasRenderRefCount = 0;
+		}
+	}
+	for (auto& itemSprite : this->renderSpriteArray)
+	{
+		if (auto spriteData = Cast<ULGUISpriteData>(IUISpriteRenderableInterface::Execute_SpriteRenderableGetSprite(itemSprite.Get())))
+		{
+			spriteData->atlasRenderRefCount++;
+		}
+	}
+	this->unusedSpriteArray.RemoveAll([](const TWeakObjectPtr<ULGUISpriteData>& Item) {
+		return !Item.IsValid() || Item->atlasRenderRefCount > 0;
+		});
+	for (auto& page : this->pages)
+	{
+		for (auto& itemSprite : page.spriteDataArray)
+		{
+			if (itemSprite->atlasRenderRefCount == 0)
+			{
+				this->unusedSpriteArray.AddUnique(itemSprite.Get());
+			}
+		}
+	}
+}
+
+void FLGUIDynamicSpriteAtlasData::AddRenderSprite(ULGUISpriteData* InSpriteData, UObject* InRenderSprite)
+{
+	auto prevCount = this->renderSpriteArray.Num();
+	this->renderSpriteArray.AddUnique(InRenderSprite);
+	if (this->renderSpriteArray.Num() != prevCount)
+	{
+		if (InSpriteData->atlasRenderRefCount++ == 0)
+		{
+			this->unusedSpriteArray.RemoveSingle(InSpriteData);
+		}
+	}
+}
+void FLGUIDynamicSpriteAtlasData::RemoveRenderSprite(ULGUISpriteData* InSpriteData, UObject* InRenderSprite)
+{
+	if (this->renderSpriteArray.RemoveSingle(InRenderSprite) > 0 && InSpriteData->atlasRenderRefCount > 0)
+	{
+		if (--InSpriteData->atlasRenderRefCount == 0 && FindPageIndex(InSpriteData->atlasTexture) != INDEX_NONE)
+		{
+			this->unusedSpriteArray.Add(InSpriteData);//most recently used at end
+		}
+	}
+}
+void FLGUIDynamicSpriteAtlasData::EvictSprite(ULGUISpriteData* InSpriteData)
+{
+	auto pageIndex = FindPageIndex(InSpriteData->atlasTexture);
+	if (pageIndex != INDEX_NONE)
+	{
+		auto& page = this->pages[pageIndex];
+		page.atlasBinPack->Free(InSpriteData->atlasPackedRect);
+		page.spriteDataArray.RemoveSingle(InSpriteData);
+		page.bNeedDefragment = true;
+	}
+	this->unusedSpriteArray.RemoveSingle(InSpriteData);
+	InSpriteData->isInitialized = false;
+	InSpriteData->atlasTexture = nullptr;
+}
+bool FLGUIDynamicSpriteAtlasData::EvictUnusedSpritesForSpace(const FName& packingTag, int32 InWidth, int32 InHeight)
+{
+	if (this->unusedSpriteArray.Num() == 0)return false;
+	TArray<int64, TInlineAllocator<8>> pageFreeArea;
+	pageFreeArea.SetNumZeroed(this->pages.Num());
+	for (int pageIndex = 0; pageIndex < this->pages.Num(); pageIndex++)
+	{
+		auto& binPack = *this->pages[pageIndex].atlasBinPack;
+		int64 binArea = (int64)binPack.GetBinWidth() * binPack.GetBinHeight();
+		pageFreeArea[pageIndex] = binArea - (int64)(binPack.Occupancy() * binArea);
+	}
+	int64 needArea = (int64)InWidth * InHeight;
+	int32 targetPageIndex = INDEX_NONE;
+	while (this->unusedSpriteArray.Num() > 0)
+	{
+		auto spriteData = this->unusedSpriteArray[0].Get();
+		if (spriteData == nullptr)//sprite is destroyed
+		{
+			this->unusedSpriteArray.RemoveAt(0);
+			continue;
+		}
+		auto pageIndex = FindPageIndex(spriteData->atlasTexture);
+		EvictSprite(spriteData);
+		if (pageIndex == INDEX_NONE)continue;
+		pageFreeArea[pageIndex] += (int64)spriteData->atlasPackedRect.width * spriteData->atlasPackedRect.height;
+		auto& binPack = *this->pages[pageIndex].atlasBinPack;
+		if (pageFreeArea[pageIndex] >= needArea && binPack.GetBinWidth() >= InWidth && binPack.GetBinHeight() >= InHeight)
+		{
+			targetPageIndex = pageIndex;
+			break;
+		}
+	}
+	//free space is fragmented after remove, so defragment it now
+	if (targetPageIndex != INDEX_NONE)
+	{
+		DefragmentPage(packingTag, targetPageIndex);
+	}
+	return true;
+}
+int32 FLGUIDynamicSpriteAtlasData::EvictAllUnusedSprites()
+{
+	int32 count = 0;
+	while (this->unusedSpriteArray.Num() > 0)
+	{
+		if (auto spriteData = this->unusedSpriteArray.Last().Get())
+		{
+			EvictSprite(spriteData);
+			count++;
+		}
+		else//sprite is destroyed
+		{
+			this->unusedSpriteArray.RemoveAt(this->unusedSpriteArray.Num() - 1);
+		}
+	}
+	return count;
+}
+bool FLGUIDynamicSpriteAtlasData::DefragmentPage(const FName& packingTag, int32 pageIndex)
+{
+	auto& page = this->pages[pageIndex];
+	page.bNeedDefragment = false;
+	page.spriteDataArray.RemoveAll([](const TObjectPtr<ULGUISpriteData>& Item) {
+		return !IsValid(Item);
+		});
+	int32 textureSize = page.atlasBinPack->GetBinWidth();
+	//pack large sprite first, so packed result is more compact
+	auto sortedSpriteArray = page.spriteDataArray;
+	sortedSpriteArray.Sort([](const TObjectPtr<ULGUISpriteData>& A, const TObjectPtr<ULGUISpriteData>& B) {
+		return A->atlasPackedRect.width * A->atlasPackedRect.height > B->atlasPackedRect.width * B->atlasPackedRect.height;
+		});
+	auto newBinPack = rbp::RectPacker::Create(ULGUISettings::GetAtlasRectPacker(packingTag));
+	newBinPack->Init(textureSize, textureSize);
+	TArray<rbp::Rect> newPackedRectArray;
+	newPackedRectArray.Reserve(sortedSpriteArray.Num());
+	for (auto& spriteItem : sortedSpriteArray)
+	{
+		auto packedRect = newBinPack->Insert(spriteItem->atlasPackedRect.width, spriteItem->atlasPackedRect.height);
+		if (packedRect.height <= 0)
+		{
+			UE_LOG(LGUI, Log, TEXT("[%s].%d Defragment atlas page fail, sprites can't fit after repack. packingTag: %s, page: %d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *packingTag.ToString(), pageIndex);
+			return false;
+		}
+		newPackedRectArray.Add(packedRect);
+	}
+
+	//copy sprite pixels (include edge padding) from old texture to new one
+	auto OldTexture = page.atlasTexture;
+	this->CreateAtlasTexture(packingTag, pageIndex, 0, textureSize);
+	auto NewTexture = page.atlasTexture;
+	TArray<FRHICopyTextureInfo> CopyInfoArray;
+	CopyInfoArray.Reserve(sortedSpriteArray.Num());
+	float atlasTextureSizeInv = 1.0f / textureSize;
+	for (int i = 0; i < sortedSpriteArray.Num(); i++)
+	{
+		auto spriteItem = sortedSpriteArray[i];
+		auto& oldRect = spriteItem->atlasPackedRect;
+		auto& newRect = newPackedRectArray[i];
+		FRHICopyTextureInfo CopyInfo;
+		CopyInfo.SourcePosition = FIntVector(oldRect.x, oldRect.y, 0);
+		CopyInfo.Size = FIntVector(oldRect.width, oldRect.height, 0);
+		CopyInfo.DestPosition = FIntVector(newRect.x, newRect.y, 0);
+		CopyInfoArray.Add(CopyInfo);
+
+		auto& spriteInfo = spriteItem->spriteInfo;
+		int32 spaceBetweenSprites = (newRect.width - spriteInfo.width) / 2;
+		spriteInfo.ApplyUV(newRect.x + spaceBetweenSprites, newRect.y + spaceBetweenSprites, spriteInfo.width, spriteInfo.height, atlasTextureSizeInv, atlasTextureSizeInv);
+		spriteInfo.ApplyBorderUV(atlasTextureSizeInv, atlasTextureSizeInv);
+		spriteItem->atlasPackedRect = newRect;
+		spriteItem->atlasTexture = NewTexture;
+	}
+	page.atlasBinPack = newBinPack;
+	if (IsValid(OldTexture))
+	{
+		if (OldTexture->GetResource() != nullptr && NewTexture->GetResource() != nullptr)
+		{
+			ENQUEUE_RENDER_COMMAND(FLGUIDynamicSpriteAtlas_DefragmentAtlasTexture)(
+				[OldTexture, NewTexture, CopyInfoArray = MoveTemp(CopyInfoArray)](FRHICommandListImmediate& RHICmdList)
+			{
+				auto OldTextureRHI = ((FTexture2DResource*)OldTexture->GetResource())->GetTexture2DRHI();
+				auto NewTextureRHI = ((FTexture2DResource*)NewTexture->GetResource())->GetTexture2DRHI();
+				for (auto& CopyInfo : CopyInfoArray)
+				{
+					RHICmdList.CopyTexture(OldTextureRHI, NewTextureRHI, CopyInfo);
+				}
+				OldTexture->RemoveFromRoot();//ready for gc
+			});
+		}
+		else
+		{
+			OldTexture->RemoveFromRoot();//ready for gc
+		}
+	}
+	//tell UISprite to use new texture and uv
+	NotifyRenderSprites(NewTexture, false);
+	return true;
+}
+bool FLGUIDynamicSpriteAtlasData::ConditionalDefragmentOnePage(const FName& packingTag)
+{
+	for (int pageIndex = this->pages.Num() - 1; pageIndex >= 0; pageIndex--)
+	{
+		auto& page = this->pages[pageIndex];
+		if (!page.bNeedDefragment)continue;
+		if (page.spriteDataArray.Num() == 0 && this->pages.Num() > 1)//empty page, release it
+		{
+			if (IsValid(page.atlasTexture))
+			{
+				page.atlasTexture->RemoveFromRoot();
+			}
+			this->pages.RemoveAt(pageIndex);
+			return true;
+		}
+		DefragmentPage(packingTag, pageIndex);
+		return true;
+	}
+	return false;
 }
 
 ULGUIDynamicSpriteAtlasManager* ULGUIDynamicSpriteAtlasManager::Instance = nullptr;
@@ -179,6 +433,21 @@ bool ULGUIDynamicSpriteAtlasManager::InitCheck()
 	}
 	return true;
 }
+void ULGUIDynamicSpriteAtlasManager::Tick(float DeltaTime)
+{
+	if (GLGUIDynamicSpriteAtlasBackgroundDefragment == 0)return;
+	for (auto& KeyValue : atlasMap)
+	{
+		if (KeyValue.Value.ConditionalDefragmentOnePage(KeyValue.Key))
+		{
+			break;//one page per frame
+		}
+	}
+}
+TStatId ULGUIDynamicSpriteAtlasManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULGUIDynamicSpriteAtlasManager, STATGROUP_Tickables);
+}
 void ULGUIDynamicSpriteAtlasManager::BeginDestroy()
 {
 	ResetAtlasMap();
@@ -220,10 +489,13 @@ void ULGUIDynamicSpriteAtlasManager::ResetAtlasMap()
 	{
 		for (auto& item : Instance->atlasMap)
 		{
-			if (IsValid(item.Value.atlasTexture))
+			for (auto& page : item.Value.pages)
 			{
-				item.Value.atlasTexture->RemoveFromRoot();
-				item.Value.atlasTexture->ConditionalBeginDestroy();
+				if (IsValid(page.atlasTexture))
+				{
+					page.atlasTexture->RemoveFromRoot();
+					page.atlasTexture->ConditionalBeginDestroy();
+				}
 			}
 		}
 		Instance->atlasMap.Empty();
@@ -240,8 +512,22 @@ void ULGUIDynamicSpriteAtlasManager::DisposeAtlasByPackingTag(FName inPackingTag
 	{
 		if (auto atlasData = Find(inPackingTag))
 		{
-			atlasData->atlasTexture->RemoveFromRoot();
+			for (auto& page : atlasData->pages)
+			{
+				if (IsValid(page.atlasTexture))
+				{
+					page.atlasTexture->RemoveFromRoot();
+				}
+			}
 			Instance->atlasMap.Remove(inPackingTag);
 		}
 	}
 }
+int32 ULGUIDynamicSpriteAtlasManager::EvictUnusedSprites(FName inPackingTag)
+{
+	if (auto atlasData = Find(inPackingTag))
+	{
+		return atlasData->EvictAllUnusedSprites();
+	}
+	return 0;
+}
@@ -13,7 +13,7 @@
 
 void ULGUIFontData::PushCharData(
 	TCHAR charCode, const FVector2f& inLineOffset, const FVector2f& fontSpace, const FLGUICharData_HighPrecision& charData,
-	const LGUIRichTextParser::RichTextParseResult& richTextProperty,
+	const LGUIRichTextParser::RichTextParseResult& richTextProperty, const FLGUIFontPushCharDataParams& params,
 	int verticesStartIndex, int indicesStartIndex,
 	int& outAdditionalVerticesCount, int& outAdditionalIndicesCount,
 	TArray<FLGUIOriginVertexData>& originVertices, TArray<FLGUIMeshVertex>& vertices, TArray<FLGUIMeshIndexBufferType>& triangleIndices
@@ -91,33 +91,33 @@ void ULGUIFontData::PushCharData(
 			auto vert3 = FVector3f(0, x, y);
 			if (richTextProperty.italic)
 			{
-				auto vert01ItalicOffset = (charData.height - charData.yoffset) * italicSlop;
+				auto vert01ItalicOffset = (charData.height - charData.yoffset) * params.ItalicSlop;
 				vert0.Y -= vert01ItalicOffset;
 				vert1.Y -= vert01ItalicOffset;
-				auto vert23ItalicOffset = charData.yoffset * italicSlop;
+				auto vert23ItalicOffset = charData.yoffset * params.ItalicSlop;
 				vert2.Y += vert23ItalicOffset;
 				vert3.Y += vert23ItalicOffset;
 			}
 			//bold left
-			originVertices[verticesStartIndex].Position = vert0 + FVector3f(0, -boldSize, 0);
-			originVertices[verticesStartIndex + 1].Position = vert1 + FVector3f(0, -boldSize, 0);
-			originVertices[verticesStartIndex + 2].Position = vert2 + FVector3f(0, -boldSize, 0);
-			originVertices[verticesStartIndex + 3].Position = vert3 + FVector3f(0, -boldSize, 0);
+			originVertices[verticesStartIndex].Position = vert0 + FVector3f(0, -params.BoldSize, 0);
+			originVertices[verticesStartIndex + 1].Position = vert1 + FVector3f(0, -params.BoldSize, 0);
+			originVertices[verticesStartIndex + 2].Position = vert2 + FVector3f(0, -params.BoldSize, 0);
+			originVertices[verticesStartIndex + 3].Position = vert3 + FVector3f(0, -params.BoldSize, 0);
 			//bold right
-			originVertices[verticesStartIndex + 4].Position = vert0 + FVector3f(0, boldSize, 0);
-			originVertices[verticesStartIndex + 5].Position = vert1 + FVector3f(0, boldSize, 0);
-			originVertices[verticesStartIndex + 6].Position = vert2 + FVector3f(0, boldSize, 0);
-			originVertices[verticesStartIndex + 7].Position = vert3 + FVector3f(0, boldSize, 0);
+			originVertices[verticesStartIndex + 4].Position = vert0 + FVector3f(0, params.BoldSize, 0);
+			originVertices[verticesStartIndex + 5].Position = vert1 + FVector3f(0, params.BoldSize, 0);
+			originVertices[verticesStartIndex + 6].Position = vert2 + FVector3f(0, params.BoldSize, 0);
+			originVertices[verticesStartIndex + 7].Position = vert3 + FVector3f(0, params.BoldSize, 0);
 			//bold top
-			originVertices[verticesStartIndex + 8].Position = vert0 + FVector3f(0, 0, boldSize);
-			originVertices[verticesStartIndex + 9].Position = vert1 + FVector3f(0, 0, boldSize);
-			originVertices[verticesStartIndex + 10].Position = vert2 + FVector3f(0, 0, boldSize);
-			originVertices[verticesStartIndex + 11].Position = vert3 + FVector3f(0, 0, boldSize);
+			originVertices[verticesStartIndex + 8].Position = vert0 + FVector3f(0, 0, params.BoldSize);
+			originVertices[verticesStartIndex + 9].Position = vert1 + FVector3f(0, 0, params.BoldSize);
+			originVertices[verticesStartIndex + 10].Position = vert2 + FVector3f(0, 0, params.BoldSize);
+			originVertices[verticesStartIndex + 11].Position = vert3 + FVector3f(0, 0, params.BoldSize);
 			//bold bottom
-			originVertices[verticesStartIndex + 12].Position = vert0 + FVector3f(0, 0, -boldSize);
-			originVertices[verticesStartIndex + 13].Position = vert1 + FVector3f(0, 0, -boldSize);
-			originVertices[verticesStartIndex + 14].Position = vert2 + FVector3f(0, 0, -boldSize);
-			originVertices[verticesStartIndex + 15].Position = vert3 + FVector3f(0, 0, -boldSize);
+			originVertices[verticesStartIndex + 12].Position = vert0 + FVector3f(0, 0, -params.BoldSize);
+			originVertices[verticesStartIndex + 13].Position = vert1 + FVector3f(0, 0, -params.BoldSize);
+			originVertices[verticesStartIndex + 14].Position = vert2 + FVector3f(0, 0, -params.BoldSize);
+			originVertices[verticesStartIndex + 15].Position = vert3 + FVector3f(0, 0, -params.BoldSize);
 
 			addVertCount = 16;
 		}
@@ -139,10 +139,10 @@ void ULGUIFontData::PushCharData(
 			vert3 = FVector3f(0, x, y);
 			if (richTextProperty.italic)
 			{
-				auto vert01ItalicOffset = (charData.height - charData.yoffset) * italicSlop;
+				auto vert01ItalicOffset = (charData.height - charData.yoffset) * params.ItalicSlop;
 				vert0.Y -= vert01ItalicOffset;
 				vert1.Y -= vert01ItalicOffset;
-				auto vert23ItalicOffset = charData.yoffset * italicSlop;
+				auto vert23ItalicOffset = charData.yoffset * params.ItalicSlop;
 				vert2.Y += vert23ItalicOffset;
 				vert3.Y += vert23ItalicOffset;
 			}
@@ -389,6 +389,10 @@ void ULGUIFontData::AddCharDataToCache(const TCHAR& charCode, const float& charS
 {
 	charDataMap.Add(FLGUIFontKeyData(charCode, charSize), charData);
 }
+void ULGUIFontData::GetCachedCharDataArray(TArray<FLGUICharData>& OutCharDataArray)const
+{
+	charDataMap.GenerateValueArray(OutCharDataArray);
+}
 void ULGUIFontData::ScaleDownUVofCachedChars()
 {
 	for (auto& charDataItem : charDataMap)
@@ -488,10 +492,10 @@ void ULGUIFontData::ApplyPackingAtlasTextureExpand(UTexture2D* newTexture, int n
 	}
 }
 
-void ULGUIFontData::PrepareForPushCharData(UUIText* InText)
+void ULGUIFontData::PrepareForPushCharData(UUIText* InText, FLGUIFontPushCharDataParams& OutParams)
 {
-	boldSize = InText->GetFontSize() * boldRatio;
-	italicSlop = FMath::Tan(FMath::DegreesToRadians(italicAngle));
+	OutParams.BoldSize = InText->GetFontSize() * boldRatio;
+	OutParams.ItalicSlop = FMath::Tan(FMath::DegreesToRadians(italicAngle));
 }
 
 #if WITH_EDITOR
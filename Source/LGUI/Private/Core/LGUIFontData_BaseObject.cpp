@@ -22,4 +22,57 @@ ULGUIFontData_BaseObject* ULGUIFontData_BaseObject::GetDefaultFont()
 	return defaultFont;
 }
 
+ULGUIFontData_BaseObject::FCharDataFastTable& ULGUIFontData_BaseObject::FindOrAddFastTable(float charSize)
+{
+	//most text use one font size, so check last used table first
+	if (CharDataFastTables.IsValidIndex(LastFastTableIndex) && CharDataFastTables[LastFastTableIndex]->CharSize == charSize)
+	{
+		return *CharDataFastTables[LastFastTableIndex];
+	}
+	for (int i = 0; i < CharDataFastTables.Num(); i++)
+	{
+		if (CharDataFastTables[i]->CharSize == charSize)
+		{
+			LastFastTableIndex = i;
+			return *CharDataFastTables[i];
+		}
+	}
+	if (CharDataFastTables.Num() < MaxFastTableCount)
+	{
+		LastFastTableIndex = CharDataFastTables.Add(MakeUnique<FCharDataFastTable>());
+	}
+	else
+	{
+		LastFastTableIndex = NextReplaceFastTableIndex;
+		NextReplaceFastTableIndex = (NextReplaceFastTableIndex + 1) % MaxFastTableCount;
+	}
+	auto& Table = *CharDataFastTables[LastFastTableIndex];
+	Table.CharSize = charSize;
+	Table.ClearValidBits();
+	return Table;
+}
+FLGUICharData_HighPrecision ULGUIFontData_BaseObject::GetCharDataFast(TCHAR charCode, float charSize)
+{
+	if ((uint32)charCode < (uint32)FastTableCharCount)
+	{
+		auto& Table = FindOrAddFastTable(charSize);
+		const uint64 Bit = 1ull << (charCode & 63);
+		if ((Table.ValidBits[charCode >> 6] & Bit) == 0)
+		{
+			//table could be cleared inside GetCharData (eg. texture expand), but table itself is kept, and the result is new data
+			Table.CharDataArray[charCode] = GetCharData(charCode, charSize);
+			Table.ValidBits[charCode >> 6] |= Bit;
+		}
+		return Table.CharDataArray[charCode];
+	}
+	return GetCharData(charCode, charSize);
+}
+void ULGUIFontData_BaseObject::MarkCharDataChanged()
+{
+	for (auto& Table : CharDataFastTables)
+	{
+		Table->ClearValidBits();
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -11,11 +11,32 @@
 #include "Engine/Texture2D.h"
 #include "Engine/FontFace.h"
 #include "Rendering/Texture2DResource.h"
+#include "Core/LGUIProfiler.h"
+#include "HAL/IConsoleManager.h"
 #if WITH_FREETYPE
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #endif
 
+static FAutoConsoleCommand CCmdLGUIFontRectPackerBenchmark(
+	TEXT("lgui.Font.RectPackerBenchmark"),
+	TEXT("Pack cached glyphs of a font with every rect packer type, and log insert time and occupancy. Parameters: FontAssetPath [TextureSize], default TextureSize is 2048."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		if (Args.Num() == 0)
+		{
+			UE_LOG(LGUI, Error, TEXT("[%s].%d Need font asset path"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__);
+			return;
+		}
+		auto Font = LoadObject<ULGUIFreeTypeRenderFontData>(nullptr, *Args[0]);
+		if (Font == nullptr)
+		{
+			UE_LOG(LGUI, Error, TEXT("[%s].%d Can't load font: %s"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *Args[0]);
+			return;
+		}
+		Font->BenchmarkRectPackers(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 2048);
+		})
+);
+
 void ULGUIFreeTypeRenderFontData::FinishDestroy()
 {
 #if WITH_FREETYPE
@@ -190,15 +211,20 @@ void ULGUIFreeTypeRenderFontData::InitFreeType()
 
 		texture = nullptr;
 		textureSize = ULGUISettings::ConvertAtlasTextureSizeTypeToSize(initialSize);
-		binPack = rbp::MaxRectsBinPack(rectPackCellSize, rectPackCellSize);
-		if (initialSize != ELGUIAtlasTextureSizeType::SIZE_256x256)
+		if (rectPackerType == ELGUIRectPackerType::MaxRects)
+		{
+			rectPacker = MakeShared<rbp::MaxRectsPacker>(rectPackCellSize);
+		}
+		else
 		{
-			binPack.PrepareExpendSizeForText(textureSize, textureSize, freeRects, rectPackCellSize, false);
+			rectPacker = rbp::RectPacker::Create(rectPackerType);
 		}
+		rectPacker->Init(textureSize, textureSize);
 		RenewFontTexture(0, textureSize);
 		oneDivideTextureSize = 1.0f / textureSize;
 
 		ClearCharDataCache();
+		MarkCharDataChanged();
 	}
 }
 
@@ -219,14 +245,14 @@ void ULGUIFreeTypeRenderFontData::DeinitFreeType()
 	}
 	face = nullptr;
 	library = nullptr;
-	freeRects.Empty();
-	binPack = rbp::MaxRectsBinPack(256, 256);
+	rectPacker.Reset();
 #if WITH_EDITORONLY_DATA
 	subFaces.Reset();
 #endif
 	fontFace = 0;
 	hasKerning = false;
 	ClearCharDataCache();
+	MarkCharDataChanged();
 }
 #endif
 
@@ -366,44 +392,35 @@ FLGUICharData_HighPrecision ULGUIFreeTypeRenderFontData::GetCharData(const TCHAR
 			return Result;
 		}
 
-		auto& calcBinpack = this->binPack;
+		auto& calcRectPacker = *this->rectPacker;
 		auto& calcTexture = this->texture;
 		FLGUICharData uiCharData;
 	PACK_AND_INSERT:
-		if (PackRectAndInsertChar(glyphBitmap, calcBinpack, calcTexture, uiCharData))
+		if (PackRectAndInsertChar(glyphBitmap, calcRectPacker, calcTexture, uiCharData))
 		{
 
 		}
-		else
+		else//current texture is full, expend texture size
 		{
-			int32 newTextureSize = 0;
-			if (freeRects.Num() > 0)
-			{
-				calcBinpack.DoExpendSizeForText(freeRects[freeRects.Num() - 1]);
-				freeRects.RemoveAt(freeRects.Num() - 1, 1, false);
-			}
-			else
+			int32 newTextureSize = textureSize + textureSize;
+			UE_LOG(LGUI, Log, TEXT("[%s].%d Expend font texture size to:%d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, newTextureSize);
+			//expend by multiply 2
+			calcRectPacker.ExpendSize(newTextureSize, newTextureSize);
+
+			RenewFontTexture(textureSize, newTextureSize);
+			FLGUIProfiler::AddFontTextureExpand();
+			textureSize = newTextureSize;
+			oneDivideTextureSize = 1.0f / textureSize;
+
+			//scale down uv of prev chars
+			ScaleDownUVofCachedChars();
+			MarkCharDataChanged();
+			//tell UIText to scale down uv
+			for (auto textItem : renderTextArray)
 			{
-				newTextureSize = textureSize + textureSize;
-				UE_LOG(LGUI, Log, TEXT("[%s].%d Expend font texture size to:%d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, newTextureSize);
-				//expend by multiply 2
-				calcBinpack.PrepareExpendSizeForText(newTextureSize, newTextureSize, freeRects, rectPackCellSize);
-				calcBinpack.DoExpendSizeForText(freeRects[freeRects.Num() - 1]);
-				freeRects.RemoveAt(freeRects.Num() - 1, 1, false);
-
-				RenewFontTexture(textureSize, newTextureSize);
-				textureSize = newTextureSize;
-				oneDivideTextureSize = 1.0f / textureSize;
-
-				//scale down uv of prev chars
-				ScaleDownUVofCachedChars();
-				//tell UIText to scale down uv
-				for (auto textItem : renderTextArray)
+				if (textItem.IsValid())
 				{
-					if (textItem.IsValid())
-					{
-						textItem->ApplyFontTextureScaleUp();
-					}
+					textItem->ApplyFontTextureScaleUp();
 				}
 			}
 
@@ -412,11 +429,12 @@ FLGUICharData_HighPrecision ULGUIFreeTypeRenderFontData::GetCharData(const TCHAR
 
 		AddCharDataToCache(charCode, charSize, uiCharData);
 		GetCharDataFromCache(charCode, charSize, Result);
+		FLGUIProfiler::AddNewGlyph();
 	}
 	return Result;
 }
 
-bool ULGUIFreeTypeRenderFontData::PackRectAndInsertChar(const FGlyphBitmap& InGlyphBitmap, rbp::MaxRectsBinPack& InOutBinpack, UTexture2D* InTexture, FLGUICharData& OutResult)
+bool ULGUIFreeTypeRenderFontData::PackRectAndInsertChar(const FGlyphBitmap& InGlyphBitmap, rbp::RectPacker& InOutRectPacker, UTexture2D* InTexture, FLGUICharData& OutResult)
 {
 	if (InGlyphBitmap.width <= 0 || InGlyphBitmap.height <= 0)//glyph no need to display, could be space
 	{
@@ -435,9 +453,7 @@ bool ULGUIFreeTypeRenderFontData::PackRectAndInsertChar(const FGlyphBitmap& InGl
 
 	int charRectWidth = InGlyphBitmap.width + SPACE_BETWEEN_GLYPH_RECTx2;
 	int charRectHeight = InGlyphBitmap.height + SPACE_BETWEEN_GLYPH_RECTx2;
-	auto method = rbp::MaxRectsBinPack::RectBestAreaFit;
-
-	auto packedRect = InOutBinpack.Insert(charRectWidth, charRectHeight, method);
+	auto packedRect = InOutRectPacker.Insert(charRectWidth, charRectHeight);
 	if (packedRect.height <= 0)//means this area cannot fit the char
 	{
 		return false;
@@ -466,11 +482,44 @@ bool ULGUIFreeTypeRenderFontData::PackRectAndInsertChar(const FGlyphBitmap& InGl
 	}
 	return false;
 }
+void ULGUIFreeTypeRenderFontData::BenchmarkRectPackers(int32 InTextureSize)
+{
+	TArray<FLGUICharData> CharDataArray;
+	GetCachedCharDataArray(CharDataArray);
+	const auto SPACE_NEED_EXPENDx2 = this->Get_SPACE_NEED_EXPEND() * 2;
+	const auto SPACE_BETWEEN_GLYPHx2 = this->Get_SPACE_BETWEEN_GLYPH() * 2;
+	TArray<rbp::RectSize> RectSizeArray;
+	RectSizeArray.Reserve(CharDataArray.Num());
+	for (auto& CharData : CharDataArray)
+	{
+		if (CharData.width <= SPACE_NEED_EXPENDx2 || CharData.height <= SPACE_NEED_EXPENDx2)continue;//glyph that no need to display
+		//same size as PackRectAndInsertChar
+		rbp::RectSize RectSize;
+		RectSize.width = CharData.width + SPACE_BETWEEN_GLYPHx2;
+		RectSize.height = CharData.height + SPACE_BETWEEN_GLYPHx2;
+		RectSizeArray.Add(RectSize);
+	}
+	if (RectSizeArray.Num() == 0)
+	{
+		UE_LOG(LGUI, Warning, TEXT("[%s].%d Font:%s have no cached glyph, display some text with this font first."), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *(this->GetName()));
+		return;
+	}
+	TArray<rbp::RectPackerBenchmarkResult> Results;
+	rbp::BenchmarkRectPackers(RectSizeArray, InTextureSize, Results);
+	UE_LOG(LGUI, Log, TEXT("[%s].%d Font:%s, glyph count:%d, texture size:%d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *(this->GetName()), RectSizeArray.Num(), InTextureSize);
+	for (auto& Result : Results)
+	{
+		UE_LOG(LGUI, Log, TEXT("	%s: inserted:%d, time:%fms, occupancy:%f")
+			, *StaticEnum<ELGUIRectPackerType>()->GetNameStringByValue((int64)Result.type)
+			, Result.insertedCount, Result.insertTime, Result.occupancy);
+	}
+}
 void ULGUIFreeTypeRenderFontData::ApplyPackingAtlasTextureExpand(UTexture2D* newTexture, int newTextureSize)
 {
 	this->texture = newTexture;
 	textureSize = newTextureSize;
 	oneDivideTextureSize = 1.0f / textureSize;
+	MarkCharDataChanged();//sub class scale down uv of cached chars
 	//tell UIText to scale down uv
 	for (auto textItem : renderTextArray)
 	{
@@ -580,6 +629,7 @@ void ULGUIFreeTypeRenderFontData::PostEditChangeProperty(FPropertyChangedEvent&
 			|| PropertyName == GET_MEMBER_NAME_CHECKED(ULGUIFreeTypeRenderFontData, fontType)
 			|| PropertyName == GET_MEMBER_NAME_CHECKED(ULGUIFreeTypeRenderFontData, lineHeightType)
 			|| PropertyName == GET_MEMBER_NAME_CHECKED(ULGUIFreeTypeRenderFontData, unrealFont)
+			|| PropertyName == GET_MEMBER_NAME_CHECKED(ULGUIFreeTypeRenderFontData, rectPackerType)
 			)
 		{
 			if (PropertyName == GET_MEMBER_NAME_CHECKED(ULGUIFreeTypeRenderFontData, fontType))
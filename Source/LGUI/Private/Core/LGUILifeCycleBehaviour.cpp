@@ -21,6 +21,22 @@ ULGUILifeCycleBehaviour::ULGUILifeCycleBehaviour()
 	bPrevIsRootComponentVisible = false;
 
 	bCanExecuteBlueprintEvent = GetClass()->HasAnyClassFlags(CLASS_CompiledFromBlueprint) || !GetClass()->HasAnyClassFlags(CLASS_Native);
+	bHasNativeUpdate = true;
+	bHasBlueprintUpdate = false;
+	bIsRootUIItem = false;
+	MarkUpdateNotOverriddenBy(ULGUILifeCycleBehaviour::StaticClass());
+}
+void ULGUILifeCycleBehaviour::MarkUpdateNotOverriddenBy(UClass* InNativeClass)
+{
+	auto NativeClass = GetClass();
+	while (NativeClass != nullptr && !NativeClass->HasAnyClassFlags(CLASS_Native))
+	{
+		NativeClass = NativeClass->GetSuperClass();
+	}
+	if (NativeClass == InNativeClass)
+	{
+		bHasNativeUpdate = false;
+	}
 }
 
 void ULGUILifeCycleBehaviour::BeginPlay()
@@ -73,6 +89,8 @@ void ULGUILifeCycleBehaviour::EndPlay(const EEndPlayReason::Type EndPlayReason)
 void ULGUILifeCycleBehaviour::OnRegister()
 {
 	Super::OnRegister();
+	//check once here, so Update no need to call blueprint event if not implemented
+	bHasBlueprintUpdate = bCanExecuteBlueprintEvent && GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ULGUILifeCycleBehaviour, ReceiveUpdate));
 #if WITH_EDITOR
 	if (GetWorld() && !GetWorld()->IsGameWorld())
 	{
@@ -336,6 +354,75 @@ void ULGUILifeCycleBehaviour::SetCanExecuteUpdate(bool value)
 		bCanExecuteUpdate = value;
 	}
 }
+void ULGUILifeCycleBehaviour::SetUpdateRate(ELGUILifeCycleBehaviourUpdateRate value)
+{
+	if (updateRate != value)
+	{
+		updateRate = value;
+		ResetUpdateRateState(UpdateSlotIndex == INDEX_NONE ? 0 : UpdateSlotIndex);
+	}
+}
+void ULGUILifeCycleBehaviour::SetUpdateFrameInterval(int32 value)
+{
+	value = FMath::Max(value, 1);
+	if (updateFrameInterval != value)
+	{
+		updateFrameInterval = value;
+		ResetUpdateRateState(UpdateSlotIndex == INDEX_NONE ? 0 : UpdateSlotIndex);
+	}
+}
+void ULGUILifeCycleBehaviour::SetUpdateTimeInterval(float value)
+{
+	value = FMath::Max(value, 0.0f);
+	if (updateTimeInterval != value)
+	{
+		updateTimeInterval = value;
+		ResetUpdateRateState(UpdateSlotIndex == INDEX_NONE ? 0 : UpdateSlotIndex);
+	}
+}
+void ULGUILifeCycleBehaviour::ResetUpdateRateState(uint32 InStaggerIndex)
+{
+	static constexpr uint32 TimePhaseCount = 16;
+	UpdateDeltaTimeAccumulator = 0;
+	UpdateFrameCounter = updateFrameInterval > 1 ? (int32)(InStaggerIndex % (uint32)updateFrameInterval) : 0;
+	UpdateTimePhase = updateTimeInterval * (InStaggerIndex % TimePhaseCount) / TimePhaseCount;
+}
+void ULGUILifeCycleBehaviour::Call_Update(float DeltaTime)
+{
+	switch (updateRate)
+	{
+	default:
+	case ELGUILifeCycleBehaviourUpdateRate::EveryFrame:
+	{
+		Update(DeltaTime);
+	}
+	break;
+	case ELGUILifeCycleBehaviourUpdateRate::EveryNFrames:
+	{
+		UpdateDeltaTimeAccumulator += DeltaTime;
+		if (++UpdateFrameCounter >= updateFrameInterval)
+		{
+			auto UpdateDeltaTime = UpdateDeltaTimeAccumulator;
+			UpdateFrameCounter = 0;
+			UpdateDeltaTimeAccumulator = 0;
+			Update(UpdateDeltaTime);
+		}
+	}
+	break;
+	case ELGUILifeCycleBehaviourUpdateRate::TimeInterval:
+	{
+		UpdateDeltaTimeAccumulator += DeltaTime;
+		if (UpdateDeltaTimeAccumulator + UpdateTimePhase >= updateTimeInterval)
+		{
+			auto UpdateDeltaTime = UpdateDeltaTimeAccumulator;
+			UpdateTimePhase = 0;//phase only affect first Update
+			UpdateDeltaTimeAccumulator = 0;
+			Update(UpdateDeltaTime);
+		}
+	}
+	break;
+	}
+}
 
 void ULGUILifeCycleBehaviour::Awake()
 {
@@ -353,7 +440,7 @@ void ULGUILifeCycleBehaviour::Start()
 }
 void ULGUILifeCycleBehaviour::Update(float DeltaTime)
 {
-	if (bCanExecuteBlueprintEvent)
+	if (bHasBlueprintUpdate)
 	{
 		ReceiveUpdate(DeltaTime);
 	}
@@ -455,7 +542,7 @@ void ULGUILifeCycleBehaviour::Call_OnEnable()
 	}
 	else
 	{
-		if (bCanExecuteUpdate && !bIsAddedToUpdate)
+		if (NeedUpdate() && !bIsAddedToUpdate)
 		{
 			bIsAddedToUpdate = true;
 			ULGUIManagerWorldSubsystem::AddLGUILifeCycleBehavioursForUpdate(this);
@@ -10,6 +10,7 @@ ULGUILifeCycleUIBehaviour::ULGUILifeCycleUIBehaviour()
 	PrimaryComponentTick.bCanEverTick = false;
 	PrimaryComponentTick.bStartWithTickEnabled = false;
 	CallbacksBeforeAwake.SetNumZeroed((int)ECallbackFunctionType::COUNT);
+	MarkUpdateNotOverriddenBy(ULGUILifeCycleUIBehaviour::StaticClass());
 }
 
 void ULGUILifeCycleUIBehaviour::OnRegister()
@@ -20,6 +20,8 @@
 #include "Core/ILGUICultureChangedInterface.h"
 #include "Core/LGUILifeCycleBehaviour.h"
 #include "Layout/ILGUILayoutInterface.h"
+#include "Algo/StableSort.h"
+#include "Core/LGUIProfiler.h"
 #include "PrefabSystem/LGUIPrefabManager.h"
 #include "PrefabSystem/LGUIPrefabHelperObject.h"
 #if WITH_EDITOR
@@ -1010,6 +1012,7 @@ DECLARE_CYCLE_STAT(TEXT("LGUILifeCycleBehaviour Update"), STAT_LGUILifeCycleBeha
 DECLARE_CYCLE_STAT(TEXT("LGUILifeCycleBehaviour Start"), STAT_LGUILifeCycleBehaviourStart, STATGROUP_LGUI);
 DECLARE_CYCLE_STAT(TEXT("UpdateLayoutInterface"), STAT_UpdateLayoutInterface, STATGROUP_LGUI);
 DECLARE_CYCLE_STAT(TEXT("Canvas Update"), STAT_UpdateCanvas, STATGROUP_LGUI);
+DECLARE_CYCLE_STAT(TEXT("Canvas Sort"), STAT_SortCanvas, STATGROUP_LGUI);
 void ULGUIManagerWorldSubsystem::Tick(float DeltaTime)
 {
 	//editor draw helper frame
@@ -1084,10 +1087,10 @@ void ULGUIManagerWorldSubsystem::Tick(float DeltaTime)
 				if (item.IsValid())
 				{
 					item->Call_Start();
-					if (item->bCanExecuteUpdate && !item->bIsAddedToUpdate)
+					if (item->NeedUpdate() && !item->bIsAddedToUpdate)
 					{
 						item->bIsAddedToUpdate = true;
-						LGUILifeCycleBehavioursForUpdate.Add(item);
+						AddToUpdateArray(item.Get());
 					}
 				}
 			}
@@ -1101,49 +1104,40 @@ void ULGUIManagerWorldSubsystem::Tick(float DeltaTime)
 		bIsExecutingUpdate = true;
 		auto bIsGamePaused = GetWorld()->IsPaused();
 		auto Settings = GetDefault<ULGUISettings>();
+		auto bScreenSpaceUIAffectByGamePause = Settings->bScreenSpaceUIAffectByGamePause;
+		auto bWorldSpaceUIAffectByGamePause = Settings->bWorldSpaceUIAffectByGamePause;
 		SCOPE_CYCLE_COUNTER(STAT_LGUILifeCycleBehaviourUpdate);
 		for (int i = 0; i < LGUILifeCycleBehavioursForUpdate.Num(); i++)
 		{
 			CurrentExecutingUpdateIndex = i;
 			auto item = LGUILifeCycleBehavioursForUpdate[i];
-			if (item.IsValid())
+			if (!item.IsValid())
 			{
-				if (item->GetRootSceneComponent() && item->GetRootSceneComponent()->IsA(UUIItem::StaticClass()))
+				bNeedToCompactUpdateArray = true;//slot cleared or object destroyed
+				continue;
+			}
+			if (bIsGamePaused)//only check pause eligibility when game is paused
+			{
+				bool bAffectByGamePause;
+				if (item->bIsRootUIItem && item->RootComp.IsValid())
 				{
-					auto uiItem = (UUIItem*)item->GetRootSceneComponent();
-					bool bAffectByGamePause;
-					if (uiItem->IsScreenSpaceOverlayUI())
-					{
-						bAffectByGamePause = Settings->bScreenSpaceUIAffectByGamePause;
-					}
-					else
-					{
-						bAffectByGamePause = Settings->bWorldSpaceUIAffectByGamePause;
-					}
-					if (!bIsGamePaused || (bIsGamePaused && !bAffectByGamePause))
-					{
-						item->Update(DeltaTime);
-					}
+					auto uiItem = (UUIItem*)item->RootComp.Get();
+					bAffectByGamePause = uiItem->IsScreenSpaceOverlayUI() ? bScreenSpaceUIAffectByGamePause : bWorldSpaceUIAffectByGamePause;
 				}
 				else
 				{
-					if (!bIsGamePaused || (bIsGamePaused && item->PrimaryComponentTick.bTickEvenWhenPaused))
-					{
-						item->Update(DeltaTime);
-					}
+					bAffectByGamePause = !item->PrimaryComponentTick.bTickEvenWhenPaused;
 				}
+				if (bAffectByGamePause)continue;
 			}
+			item->Call_Update(DeltaTime);
 		}
 		bIsExecutingUpdate = false;
 		CurrentExecutingUpdateIndex = -1;
 		//remove these padding things
-		if (LGUILifeCycleBehavioursNeedToRemoveFromUpdate.Num() > 0)
+		if (bNeedToCompactUpdateArray)
 		{
-			for (auto& item : LGUILifeCycleBehavioursNeedToRemoveFromUpdate)
-			{
-				LGUILifeCycleBehavioursForUpdate.Remove(item);
-			}
-			LGUILifeCycleBehavioursNeedToRemoveFromUpdate.Reset();
+			CompactUpdateArray();
 		}
 	}
 
@@ -1202,20 +1196,56 @@ void ULGUIManagerWorldSubsystem::Tick(float DeltaTime)
 
 	//sort render order
 	{
-		auto SortCanvas = [](TArray<TWeakObjectPtr<ULGUICanvas>>& InCanvasArray) {
-			InCanvasArray.Sort([](const TWeakObjectPtr<ULGUICanvas>& A, const TWeakObjectPtr<ULGUICanvas>& B)
+		auto SortCanvas = [this](TArray<TWeakObjectPtr<ULGUICanvas>>& InCanvasArray) {
+			SCOPE_CYCLE_COUNTER(STAT_SortCanvas);
+			//calculate sort key once for each canvas, so comparison don't need to access canvas
+			CanvasSortKeyArray.SetNumUninitialized(InCanvasArray.Num(), false);
+			int32 OutOfOrderCount = 0;
+			for (int i = 0; i < InCanvasArray.Num(); i++)
+			{
+				auto& Canvas = InCanvasArray[i];
+				auto& KeyItem = CanvasSortKeyArray[i];
+				KeyItem.Canvas = Canvas;
+				if (Canvas.IsValid())
+				{
+					auto UIItem = Canvas->GetUIItem();
+					KeyItem.Key = ((int64)Canvas->GetActualSortOrder() << 32)
+						+ ((int64)(UIItem != nullptr ? UIItem->GetFlattenHierarchyIndex() : 0) - MIN_int32);
+				}
+				else
+				{
+					KeyItem.Key = MAX_int64;
+				}
+				if (i > 0 && KeyItem.Key < CanvasSortKeyArray[i - 1].Key)
+				{
+					OutOfOrderCount++;
+				}
+			}
+			if (OutOfOrderCount == 0)return;//already in order
+			if (OutOfOrderCount <= 8)//only few canvas's order changed, reinsert them
+			{
+				for (int i = 1; i < CanvasSortKeyArray.Num(); i++)
 				{
-					auto ASortOrder = A->GetActualSortOrder();
-					auto BSortOrder = B->GetActualSortOrder();
-					if (ASortOrder == BSortOrder)
+					if (CanvasSortKeyArray[i].Key < CanvasSortKeyArray[i - 1].Key)
 					{
-						if (A->GetUIItem() != nullptr && B->GetUIItem() != nullptr)
+						auto Item = CanvasSortKeyArray[i];
+						int j = i - 1;
+						for (; j >= 0 && Item.Key < CanvasSortKeyArray[j].Key; j--)
 						{
-							return A->GetUIItem()->GetFlattenHierarchyIndex() < B->GetUIItem()->GetFlattenHierarchyIndex();
+							CanvasSortKeyArray[j + 1] = CanvasSortKeyArray[j];
 						}
+						CanvasSortKeyArray[j + 1] = Item;
 					}
-					return ASortOrder < BSortOrder;
-				});
+				}
+			}
+			else
+			{
+				Algo::StableSortBy(CanvasSortKeyArray, &FLGUICanvasSortKey::Key);
+			}
+			for (int i = 0; i < InCanvasArray.Num(); i++)
+			{
+				InCanvasArray[i] = CanvasSortKeyArray[i].Canvas;
+			}
 		};
 		if (bShouldSortScreenSpaceCanvas)
 		{
@@ -1304,13 +1334,7 @@ void ULGUIManagerWorldSubsystem::AddLGUILifeCycleBehavioursForUpdate(ULGUILifeCy
 	{
 		if (auto Instance = GetInstance(InComp->GetWorld()))
 		{
-			int32 index = INDEX_NONE;
-			if (!Instance->LGUILifeCycleBehavioursForUpdate.Find(InComp, index))
-			{
-				Instance->LGUILifeCycleBehavioursForUpdate.Add(InComp);
-				return;
-			}
-			UE_LOG(LGUI, Warning, TEXT("[ULGUIManagerWorldSubsystem::AddLGUILifeCycleBehavioursForUpdate]Already exist, comp:%s"), *(InComp->GetPathName()));
+			Instance->AddToUpdateArray(InComp);
 		}
 	}
 }
@@ -1320,47 +1344,64 @@ void ULGUIManagerWorldSubsystem::RemoveLGUILifeCycleBehavioursFromUpdate(ULGUILi
 	{
 		if (auto Instance = GetInstance(InComp->GetWorld()))
 		{
-			auto& updateArray = Instance->LGUILifeCycleBehavioursForUpdate;
-			int32 index = INDEX_NONE;
-			if (updateArray.Find(InComp, index))
-			{
-				if (Instance->bIsExecutingUpdate)
-				{
-					if (index > Instance->CurrentExecutingUpdateIndex)//not execute it yet, safe to remove
-					{
-						updateArray.RemoveAt(index);
-					}
-					else//already execute or current execute it, not safe to remove. should remove it after execute process complete
-					{
-						Instance->LGUILifeCycleBehavioursNeedToRemoveFromUpdate.Add(InComp);
-					}
-				}
-				else//not executing update, safe to remove
-				{
-					updateArray.RemoveAt(index);
-				}
-			}
-			else
-			{
-				UE_LOG(LGUI, Warning, TEXT("[ULGUIManagerWorldSubsystem::RemoveLGUILifeCycleBehavioursFromUpdate]Not exist, comp:%s"), *(InComp->GetPathName()));
-			}
-
-			//cleanup array
-			int inValidCount = 0;
-			for (int i = updateArray.Num() - 1; i >= 0; i--)
-			{
-				if (!updateArray[i].IsValid())
-				{
-					updateArray.RemoveAt(i);
-					inValidCount++;
-				}
-			}
-			if (inValidCount > 0)
-			{
-				UE_LOG(LGUI, Warning, TEXT("[ULGUIManagerWorldSubsystem::RemoveLGUILifeCycleBehavioursFromUpdate]Cleanup %d invalid LGUILifeCycleBehaviour"), inValidCount);
-			}
+			Instance->RemoveFromUpdateArray(InComp);
+		}
+	}
+}
+void ULGUIManagerWorldSubsystem::AddToUpdateArray(ULGUILifeCycleBehaviour* InComp)
+{
+	if (InComp->UpdateSlotIndex != INDEX_NONE)
+	{
+		UE_LOG(LGUI, Warning, TEXT("[ULGUIManagerWorldSubsystem::AddLGUILifeCycleBehavioursForUpdate]Already exist, comp:%s"), *(InComp->GetPathName()));
+		return;
+	}
+	InComp->UpdateSlotIndex = LGUILifeCycleBehavioursForUpdate.Add(InComp);
+	InComp->ResetUpdateRateState(UpdateStaggerIndex++);
+	auto RootComp = InComp->GetRootSceneComponent();
+	InComp->bIsRootUIItem = RootComp != nullptr && RootComp->IsA(UUIItem::StaticClass());
+}
+void ULGUIManagerWorldSubsystem::RemoveFromUpdateArray(ULGUILifeCycleBehaviour* InComp)
+{
+	auto& updateArray = LGUILifeCycleBehavioursForUpdate;
+	auto index = InComp->UpdateSlotIndex;
+	if (!updateArray.IsValidIndex(index) || updateArray[index].Get() != InComp)
+	{
+		UE_LOG(LGUI, Warning, TEXT("[ULGUIManagerWorldSubsystem::RemoveLGUILifeCycleBehavioursFromUpdate]Not exist, comp:%s"), *(InComp->GetPathName()));
+		return;
+	}
+	InComp->UpdateSlotIndex = INDEX_NONE;
+	if (bIsExecutingUpdate && index <= CurrentExecutingUpdateIndex)//already execute or current execute it, not safe to move. clear the slot and remove it after execute process complete
+	{
+		updateArray[index] = nullptr;
+		bNeedToCompactUpdateArray = true;
+		return;
+	}
+	//swap with last one. if executing update, the last one is not executed yet (index > CurrentExecutingUpdateIndex), so it is still safe
+	auto lastIndex = updateArray.Num() - 1;
+	if (index != lastIndex)
+	{
+		updateArray[index] = updateArray[lastIndex];
+		if (auto movedComp = updateArray[index].Get())
+		{
+			movedComp->UpdateSlotIndex = index;
+		}
+	}
+	updateArray.RemoveAt(lastIndex, 1, false);
+}
+void ULGUIManagerWorldSubsystem::CompactUpdateArray()
+{
+	bNeedToCompactUpdateArray = false;
+	auto& updateArray = LGUILifeCycleBehavioursForUpdate;
+	int32 validCount = 0;
+	for (int i = 0; i < updateArray.Num(); i++)
+	{
+		if (auto comp = updateArray[i].Get())
+		{
+			comp->UpdateSlotIndex = validCount;
+			updateArray[validCount++] = updateArray[i];
 		}
 	}
+	updateArray.SetNum(validCount, false);
 }
 
 void ULGUIManagerWorldSubsystem::AddLGUILifeCycleBehavioursForStart(ULGUILifeCycleBehaviour* InComp)
@@ -1442,6 +1483,7 @@ void ULGUIManagerWorldSubsystem::UnregisterLGUICultureChangedEvent(TScriptInterf
 void ULGUIManagerWorldSubsystem::UpdateLayout()
 {
 	SCOPE_CYCLE_COUNTER(STAT_UpdateLayoutInterface);
+	LGUI_PROFILER_SCOPE(Layout);
 
 	//update Layout
 	if (bNeedUpdateLayout)
@@ -56,6 +56,26 @@ public:
 		VertexBufferRHI = RHICreateVertexBuffer(SizeInBytes, BUF_Dynamic, CreateInfo);
 	}
 };
+class FLGUIInstanceBuffer : public FVertexBuffer
+{
+public:
+	TArray<FLGUIMeshInstanceData> Instances;
+	/** unique across all buffers, change when Instances change */
+	uint32 Version = 0;
+	void MarkInstancesChanged()
+	{
+		static int32 VersionCounter = 0;
+		Version = (uint32)FPlatformAtomics::InterlockedIncrement(&VersionCounter);
+	}
+	virtual void InitRHI()override
+	{
+		const uint32 SizeInBytes = Instances.Num() * sizeof(FLGUIMeshInstanceData);
+
+		FLGUIMeshVertexResourceArray ResourceArray(Instances.GetData(), SizeInBytes);
+		FRHIResourceCreateInfo CreateInfo(TEXT("LGUIInstanceBuffer"), &ResourceArray);
+		VertexBufferRHI = RHICreateVertexBuffer(SizeInBytes, BUF_Dynamic, CreateInfo);
+	}
+};
 
 
 struct FLGUIRenderSectionProxy
@@ -244,6 +264,13 @@ public:
 			Sections[SectionIndex] = CreateSectionData(SrcSections[SectionIndex].Get());
 		}
 		bNeedToSortRenderSections = true;
+
+		InstanceBuffer.Instances = InComponent->InstanceDataArray;
+		InstanceBuffer.MarkInstancesChanged();
+		if (InstanceBuffer.Instances.Num() > 0)
+		{
+			BeginInitResource(&InstanceBuffer);
+		}
 	}
 
 	void AddSectionData(FLGUIRenderSection* SrcSection)
@@ -264,6 +291,7 @@ public:
 	void AddSectionData_RenderThread(FLGUIRenderSectionProxy* Section)
 	{
 		Sections.Add(Section);
+		MarkRenderDataDirty_RenderThread();
 	}
 
 	FLGUIRenderSectionProxy* CreateSectionData(FLGUIRenderSection* InSrcSection)
@@ -372,6 +400,7 @@ public:
 					)
 				{
 					ChildCanvasSection->ChildCanvasSceneProxy = SceneProxy;
+					MarkRenderDataDirty_RenderThread();
 				}
 			}
 		}
@@ -388,6 +417,7 @@ public:
 				if (ChildCanvasSection->ChildCanvasSceneProxy == SceneProxy)//child could already get new proxy, so need to check it
 				{
 					ChildCanvasSection->ChildCanvasSceneProxy = nullptr;
+					MarkRenderDataDirty_RenderThread();
 					return;
 				}
 			}
@@ -401,6 +431,7 @@ public:
 			Sections.Remove(Section);
 		}
 		delete Section;
+		MarkRenderDataDirty_RenderThread();
 	}
 
 	void RecreateSectionData(FLGUIRenderSection* SrcSection)
@@ -425,11 +456,25 @@ public:
 	{
 		RenderPriority = NewPriority;
 	}
+	void SetInstanceData_RenderThread(TArray<FLGUIMeshInstanceData>&& InInstanceDataArray)
+	{
+		InstanceBuffer.Instances = MoveTemp(InInstanceDataArray);
+		InstanceBuffer.MarkInstancesChanged();
+		if (InstanceBuffer.Instances.Num() > 0)
+		{
+			FLGUIMeshSectionProxy::InitOrUpdateResource(&InstanceBuffer);
+		}
+		else
+		{
+			InstanceBuffer.ReleaseResource();
+		}
+	}
 
 	void SetRenderSectionRenderPriority_RenderThread(FLGUIRenderSectionProxy* Section, int32 NewPriority)
 	{
 		Section->SectionRenderPriority = NewPriority;
 		bNeedToSortRenderSections = true;
+		MarkRenderDataDirty_RenderThread();
 	}
 
 	void SortMeshSectionRenderPriority_RenderThread()
@@ -474,6 +519,8 @@ public:
 			}
 		}
 		Sections.Empty();
+		InstanceBuffer.ReleaseResource();
+		InheritedInstanceBuffer.ReleaseResource();
 		if (ParentSceneProxy)
 		{
 			ParentSceneProxy->ClearChildCanvasSectionData_RenderThread(this);
@@ -688,6 +735,27 @@ public:
 		if (ParentSceneProxy != nullptr)return;
 		CollectRenderData_Implement(OutRenderData, CurrentWorldTime);
 	}
+	virtual const TArray<FLGUIPrimitiveDataContainer>& GetCachedRenderData(float CurrentWorldTime) override
+	{
+		if (bRenderDataDirty)
+		{
+			bRenderDataDirty = false;
+			CachedRenderDataArray.Reset();
+			CachedRenderProxyArray.Reset();
+			if (ParentSceneProxy == nullptr)
+			{
+				CollectRenderData_Implement(CachedRenderDataArray, CurrentWorldTime, &CachedRenderProxyArray);
+			}
+		}
+		else
+		{
+			for (auto RenderProxy : CachedRenderProxyArray)
+			{
+				*RenderProxy->CanvasLastRenderTime = CurrentWorldTime;
+			}
+		}
+		return CachedRenderDataArray;
+	}
 	virtual void GetMeshElements(const FSceneViewFamily& ViewFamily, FMeshElementCollector* Collector, const FLGUIPrimitiveDataContainer& PrimitiveData, TArray<FLGUIMeshBatchContainer>& ResultArray) override
 	{
 		if (!bIsSupportLGUIRenderer)return;
@@ -700,6 +768,7 @@ public:
 			WireframeMaterialInstance = GEngine->WireframeMaterial->GetRenderProxy();
 		}
 
+		auto ActualInstanceBuffer = GetActualInstanceBuffer_RenderThread();
 		for (int i = 0; i < PrimitiveData.Sections.Num(); i++)
 		{
 			auto SectionData = PrimitiveData.Sections[i];
@@ -734,9 +803,56 @@ public:
 			MeshBatchContainer.Mesh = Mesh;
 			MeshBatchContainer.VertexBufferRHI = Section->LGUIVertexBuffers.VertexBufferRHI;
 			MeshBatchContainer.NumVerts = Section->LGUIVertexBuffers.Vertices.Num();
+			if (ActualInstanceBuffer != nullptr)
+			{
+				MeshBatchContainer.InstanceBufferRHI = ActualInstanceBuffer->VertexBufferRHI;
+				MeshBatchContainer.NumInstances = ActualInstanceBuffer->Instances.Num();
+			}
 			ResultArray.Add(MeshBatchContainer);
 		}
 	}
+	/**
+	 * Instances to draw with: self's instances, or instances of the nearest parent proxy (child canvas that render in parent) converted to this proxy's local space.
+	 * @return nullptr if no instance
+	 */
+	const FLGUIInstanceBuffer* GetActualInstanceBuffer_RenderThread()
+	{
+		if (InstanceBuffer.IsInitialized())return &InstanceBuffer;
+		const FLGUIRenderSceneProxy* Source = ParentSceneProxy;
+		while (Source != nullptr && !Source->InstanceBuffer.IsInitialized())
+		{
+			Source = Source->ParentSceneProxy;
+		}
+		if (Source == nullptr)
+		{
+			if (InheritedInstanceBuffer.IsInitialized())
+			{
+				InheritedInstanceBuffer.ReleaseResource();
+				InheritedInstanceBuffer.Instances.Empty();
+			}
+			return nullptr;
+		}
+		//instance transform is in source's local space: ThisLocal -> SourceLocal -> Instance -> ThisLocal
+		const auto ToSource = GetLocalToWorld() * Source->GetLocalToWorld().Inverse();
+		if (!InheritedInstanceBuffer.IsInitialized()
+			|| Source->InstanceBuffer.Version != InheritedInstanceBuffer.Version
+			|| !ToSource.Equals(InheritedToSourceMatrix)
+			)
+		{
+			InheritedInstanceBuffer.Version = Source->InstanceBuffer.Version;
+			InheritedToSourceMatrix = ToSource;
+			const auto FromSource = ToSource.Inverse();
+			auto& SourceInstances = Source->InstanceBuffer.Instances;
+			InheritedInstanceBuffer.Instances.SetNum(SourceInstances.Num());
+			for (int i = 0; i < SourceInstances.Num(); i++)
+			{
+				InheritedInstanceBuffer.Instances[i].SetMatrix(ToSource * SourceInstances[i].GetMatrix() * FromSource);
+				InheritedInstanceBuffer.Instances[i].Color = SourceInstances[i].Color;
+			}
+			FLGUIMeshSectionProxy::InitOrUpdateResource(&InheritedInstanceBuffer);
+		}
+		return &InheritedInstanceBuffer;
+	}
 
 	virtual FUIPostProcessRenderProxy* GetPostProcessElement(const void* SectionPtr)const override
 	{
@@ -758,8 +874,15 @@ public:
 	}
 	virtual FBoxSphereBounds GetWorldBounds()const override { return FPrimitiveSceneProxy::GetBounds(); }
 	//end ILGUIRendererPrimitive interface
-	void CollectRenderData_Implement(TArray<FLGUIPrimitiveDataContainer>& OutRenderDataArray, float CurrentWorldTime)
+	/**
+	 * @param	OutRenderProxyArray	if not null, then collect for cache: all proxies that collected are added to this array, and all PostProcess sections are included because PostProcess's CanRender could change without notify.
+	 */
+	void CollectRenderData_Implement(TArray<FLGUIPrimitiveDataContainer>& OutRenderDataArray, float CurrentWorldTime, TArray<FLGUIRenderSceneProxy*>* OutRenderProxyArray = nullptr)
 	{
+		if (OutRenderProxyArray != nullptr)
+		{
+			OutRenderProxyArray->Add(this);
+		}
 		if (Sections.Num() <= 0)return;
 		if (bNeedToSortRenderSections)
 		{
@@ -805,7 +928,7 @@ public:
 				{
 					auto Section = (FLGUIPostProcessSectionProxy*)RenderSection;
 					auto PostProcessProxy = Section->PostProcessRenderProxy.Pin();
-					if (PostProcessProxy.IsValid() && PostProcessProxy->CanRender())
+					if (OutRenderProxyArray != nullptr || (PostProcessProxy.IsValid() && PostProcessProxy->CanRender()))
 					{
 						FLGUIPrimitiveSectionDataContainer SectionData;
 						SectionData.SectionPointer = RenderSection;
@@ -819,7 +942,8 @@ public:
 					auto ChildSceneProxy = Section->ChildCanvasSceneProxy;
 					if (ChildSceneProxy != nullptr)
 					{
-						ChildSceneProxy->CollectRenderData_Implement(OutRenderDataArray, CurrentWorldTime);
+						ChildSceneProxy->bRenderDataDirty = true;//render in parent, so self cache is not valid
+						ChildSceneProxy->CollectRenderData_Implement(OutRenderDataArray, CurrentWorldTime, OutRenderProxyArray);
 					}
 				}
 				break;
@@ -875,7 +999,17 @@ public:
 
 	void SetParentSceneProxy_RenderThread(FLGUIRenderSceneProxy* InParentSceneProxy)
 	{
+		MarkRenderDataDirty_RenderThread();
 		ParentSceneProxy = InParentSceneProxy;
+		MarkRenderDataDirty_RenderThread();
+	}
+	/** Render sections changed, need to collect render data again, parent's cache contains this one's render data so mark parent too */
+	void MarkRenderDataDirty_RenderThread()
+	{
+		for (auto RenderProxy = this; RenderProxy != nullptr; RenderProxy = RenderProxy->ParentSceneProxy)
+		{
+			RenderProxy->bRenderDataDirty = true;
+		}
 	}
 private:
 	TArray<FLGUIRenderSectionProxy*> Sections;
@@ -900,6 +1034,17 @@ private:
 	 * Why it is safe to use? Check PrimitiveSceneInfo.h OwnerLastRenderTime
 	 */
 	float* CanvasLastRenderTime = nullptr;
+
+	/** cached render data for GetCachedRenderData */
+	TArray<FLGUIPrimitiveDataContainer> CachedRenderDataArray;
+	/** proxies in CachedRenderDataArray (self and children canvas), for update LastRenderTime */
+	TArray<FLGUIRenderSceneProxy*> CachedRenderProxyArray;
+	bool bRenderDataDirty = true;
+	/** per-instance data, only initialized when have instances */
+	FLGUIInstanceBuffer InstanceBuffer;
+	/** parent's instances in this proxy's local space, for child canvas that render in parent. Version is the source's version */
+	FLGUIInstanceBuffer InheritedInstanceBuffer;
+	FMatrix InheritedToSourceMatrix = FMatrix::Identity;
 };
 #if !UE_BUILD_SHIPPING
 uint32 FLGUIRenderSceneProxy::DebugNameIndex = 0;
@@ -968,7 +1113,9 @@ void ULGUIMeshComponent::CreateRenderSectionRenderData(TSharedPtr<FLGUIRenderSec
 		}
 	}
 #endif
+	DirtyRegionBox += InRenderSection->BoundingBox;//section could be recreated, so include prev box
 	InRenderSection->UpdateSectionBox(GetComponentTransform());
+	DirtyRegionBox += InRenderSection->BoundingBox;
 
 	if (InRenderSection->Type == ELGUIRenderSectionType::ChildCanvas)
 	{
@@ -1008,9 +1155,11 @@ DECLARE_CYCLE_STAT(TEXT("LGUIMesh UpdateMeshSection_GT"), STAT_UpdateMeshSection
 void ULGUIMeshComponent::UpdateMeshSectionRenderData(TSharedPtr<FLGUIRenderSection> InRenderSection, bool InVertexPositionChanged, int8 AdditionalShaderChannelFlags)
 {
 	SCOPE_CYCLE_COUNTER(STAT_UpdateMeshSectionGT);
+	DirtyRegionBox += InRenderSection->BoundingBox;
 	if (InVertexPositionChanged)
 	{
 		InRenderSection->UpdateSectionBox(GetComponentTransform());
+		DirtyRegionBox += InRenderSection->BoundingBox;
 	}
 	if (SceneProxy)
 	{
@@ -1060,6 +1209,7 @@ void ULGUIMeshComponent::UpdateMeshSectionRenderData(TSharedPtr<FLGUIRenderSecti
 
 void ULGUIMeshComponent::DeleteRenderSection(TSharedPtr<FLGUIRenderSection> InRenderSection)
 {
+	DirtyRegionBox += InRenderSection->BoundingBox;
 	if (SceneProxy)
 	{
 		auto LGUIMeshSceneProxy = (FLGUIRenderSceneProxy*)SceneProxy;
@@ -1090,7 +1240,9 @@ void ULGUIMeshComponent::DeleteRenderSection(TSharedPtr<FLGUIRenderSection> InRe
 
 void ULGUIMeshComponent::SetRenderSectionRenderPriority(TSharedPtr<FLGUIRenderSection> InMeshSection, int32 InSortPriority)
 {
+	if (InMeshSection->RenderPriority == InSortPriority)return;//render proxy is created with RenderPriority, so no need to update it
 	InMeshSection->RenderPriority = InSortPriority;
+	DirtyRegionBox += InMeshSection->BoundingBox;
 	if (SceneProxy)
 	{
 		auto LGUIMeshSceneProxy = (FLGUIRenderSceneProxy*)SceneProxy;
@@ -1110,6 +1262,7 @@ void ULGUIMeshComponent::SetMeshSectionMaterial(TSharedPtr<FLGUIRenderSection> I
 {
 	check(InRenderSection->Type == ELGUIRenderSectionType::Mesh);
 	((FLGUIMeshSection*)InRenderSection.Get())->material = InMaterial;
+	DirtyRegionBox += InRenderSection->BoundingBox;
 }
 
 void ULGUIMeshComponent::VerifyMaterials()
@@ -1157,7 +1310,9 @@ void ULGUIMeshComponent::ClearParentCavansMeshComp(ULGUIMeshComponent* InMesh)
 
 void ULGUIMeshComponent::SetUITranslucentSortPriority(int32 NewTranslucentSortPriority)
 {
+	if (TranslucencySortPriority == NewTranslucentSortPriority)return;
 	UPrimitiveComponent::SetTranslucentSortPriority(NewTranslucentSortPriority);
+	bDirtyRegionIsWhole = true;
 	if (SceneProxy)
 	{
 		auto LGUIMeshSceneProxy = (FLGUIRenderSceneProxy*)SceneProxy;
@@ -1170,6 +1325,23 @@ void ULGUIMeshComponent::SetUITranslucentSortPriority(int32 NewTranslucentSortPr
 	}
 }
 
+void ULGUIMeshComponent::SetInstanceData(const TArray<FLGUIMeshInstanceData>& InInstanceDataArray)
+{
+	if (InstanceDataArray.Num() == 0 && InInstanceDataArray.Num() == 0)return;
+	InstanceDataArray = InInstanceDataArray;
+	if (SceneProxy)
+	{
+		auto LGUIMeshSceneProxy = (FLGUIRenderSceneProxy*)SceneProxy;
+		ENQUEUE_RENDER_COMMAND(FLGUIMesh_SetInstanceData)(
+			[LGUIMeshSceneProxy, InstanceData = InInstanceDataArray](FRHICommandListImmediate& RHICmdList) mutable
+		{
+			LGUIMeshSceneProxy->SetInstanceData_RenderThread(MoveTemp(InstanceData));
+		}
+		);
+	}
+	UpdateLocalBounds();
+}
+
 void ULGUIMeshComponent::UpdateChildCanvasSectionBox()
 {
 	struct LOCAL
@@ -1199,6 +1371,27 @@ void ULGUIMeshComponent::UpdateLocalBounds()
 	MarkRenderTransformDirty();// Need to send to render thread
 }
 
+void ULGUIMeshComponent::MarkRenderSectionDirtyRegion(TSharedPtr<FLGUIRenderSection> InRenderSection)
+{
+	if (InRenderSection.IsValid())
+	{
+		DirtyRegionBox += InRenderSection->BoundingBox;
+	}
+}
+bool ULGUIMeshComponent::ConsumeDirtyRegion(FBox& OutDirtyBox)
+{
+	OutDirtyBox = DirtyRegionBox;
+	const bool bResult = !bDirtyRegionIsWhole;
+	DirtyRegionBox = FBox(EForceInit::ForceInit);
+	bDirtyRegionIsWhole = false;
+	return bResult;
+}
+void ULGUIMeshComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+	bDirtyRegionIsWhole = true;//all sections moved, prev location is not recorded
+}
+
 struct FLGUIPrimitiveComponentIdTemporaryModifier
 {
 	ULGUIMeshComponent* Comp = nullptr;
@@ -1260,6 +1453,7 @@ void ULGUIMeshComponent::ClearRenderData()
 {
 	MarkRenderStateDirty();//mark dirty to recreate SceneProxy
 	RenderSections.Reset();
+	bDirtyRegionIsWhole = true;
 	OnSceneProxyCreated.Clear();
 	LGUIRenderer = nullptr;
 }
@@ -1334,6 +1528,17 @@ FBoxSphereBounds ULGUIMeshComponent::CalcBounds(const FTransform& LocalToWorld)
 		break;
 		}
 	}
+	if (InstanceDataArray.Num() > 0 && ResultBox.IsValid)
+	{
+		//section's box is in world space, convert it to local space, then expand by every instance
+		const auto LocalBox = ResultBox.InverseTransformBy(LocalToWorld);
+		FBox InstancedBox = FBox(EForceInit::ForceInit);
+		for (auto& InstanceData : InstanceDataArray)
+		{
+			InstancedBox += LocalBox.TransformBy(InstanceData.GetMatrix());
+		}
+		ResultBox = InstancedBox.TransformBy(LocalToWorld);
+	}
 
 	return FBoxSphereBounds(ResultBox);
 }
@@ -4,11 +4,9 @@
 #include "RHI.h"
 
 
-void FLGUIMeshVertexDeclaration::InitRHI()
+static void AddLGUIMeshVertexElements(FVertexDeclarationElementList& Elements, uint16& Index)
 {
-	FVertexDeclarationElementList Elements;
 	uint32 Stride = sizeof(FLGUIMeshVertex);
-	uint16 Index = 0;
 	Elements.Add(FVertexElement(0, STRUCT_OFFSET(FLGUIMeshVertex, Position), VET_Float3, Index++, Stride));
 	Elements.Add(FVertexElement(0, STRUCT_OFFSET(FLGUIMeshVertex, Color), VET_Color, Index++, Stride));
 	for (int i = 0; i < LGUI_VERTEX_TEXCOORDINATE_COUNT; i++)
@@ -17,6 +15,12 @@ void FLGUIMeshVertexDeclaration::InitRHI()
 	}
 	Elements.Add(FVertexElement(0, STRUCT_OFFSET(FLGUIMeshVertex, TangentX), VET_PackedNormal, Index++, Stride));
 	Elements.Add(FVertexElement(0, STRUCT_OFFSET(FLGUIMeshVertex, TangentZ), VET_PackedNormal, Index++, Stride));
+}
+void FLGUIMeshVertexDeclaration::InitRHI()
+{
+	FVertexDeclarationElementList Elements;
+	uint16 Index = 0;
+	AddLGUIMeshVertexElements(Elements, Index);
 	VertexDeclarationRHI = RHICreateVertexDeclaration(Elements);
 }
 void FLGUIMeshVertexDeclaration::ReleaseRHI()
@@ -28,3 +32,26 @@ FVertexDeclarationRHIRef& GetLGUIMeshVertexDeclaration()
 {
 	return GLGUIVertexDeclaration.VertexDeclarationRHI;
 }
+
+void FLGUIMeshInstancedVertexDeclaration::InitRHI()
+{
+	FVertexDeclarationElementList Elements;
+	uint16 Index = 0;
+	AddLGUIMeshVertexElements(Elements, Index);
+	uint32 Stride = sizeof(FLGUIMeshInstanceData);
+	for (int i = 0; i < 3; i++)
+	{
+		Elements.Add(FVertexElement(1, STRUCT_OFFSET(FLGUIMeshInstanceData, Transform) + i * sizeof(FVector4f), VET_Float4, Index++, Stride, true));
+	}
+	Elements.Add(FVertexElement(1, STRUCT_OFFSET(FLGUIMeshInstanceData, Color), VET_Color, Index++, Stride, true));
+	VertexDeclarationRHI = RHICreateVertexDeclaration(Elements);
+}
+void FLGUIMeshInstancedVertexDeclaration::ReleaseRHI()
+{
+	VertexDeclarationRHI.SafeRelease();
+}
+TGlobalResource<FLGUIMeshInstancedVertexDeclaration> GLGUIInstancedVertexDeclaration;
+FVertexDeclarationRHIRef& GetLGUIMeshInstancedVertexDeclaration()
+{
+	return GLGUIInstancedVertexDeclaration.VertexDeclarationRHI;
+}
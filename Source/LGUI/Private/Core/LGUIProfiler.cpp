@@ -0,0 +1,216 @@
+﻿// Copyright 2019-Present LexLiu. All Rights Reserved.
+
+#include "Core/LGUIProfiler.h"
+#include "LGUI.h"
+#include "Core/ActorComponent/LGUICanvas.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if LGUI_CAN_DISABLE_OPTIMIZATION
+UE_DISABLE_OPTIMIZATION
+#endif
+
+bool FLGUIProfiler::bEnabled = false;
+int32 FLGUIProfiler::MaxHistoryFrameCount = 300;
+FLGUIProfilerFrameStats FLGUIProfiler::CurrentFrame;
+TArray<FLGUIProfilerFrameStats> FLGUIProfiler::FrameHistory;
+
+static int32 GLGUIProfilerEnable = 0;
+static FAutoConsoleVariableRef CVarLGUIProfilerEnable(
+	TEXT("lgui.Profiler.Enable"),
+	GLGUIProfilerEnable,
+	TEXT("Enable LGUI profiler to record per-frame work of layout, geometry, batch, mesh upload, raycast and event dispatch."),
+	FConsoleVariableDelegate::CreateLambda([](IConsoleVariable* InVariable) {
+		FLGUIProfiler::SetEnabled(GLGUIProfilerEnable != 0);
+		}),
+	ECVF_Default);
+static FAutoConsoleVariableRef CVarLGUIProfilerMaxHistoryFrameCount(
+	TEXT("lgui.Profiler.MaxHistoryFrameCount"),
+	FLGUIProfiler::MaxHistoryFrameCount,
+	TEXT("Max frame count that LGUI profiler can keep."),
+	ECVF_Default);
+static FAutoConsoleCommand CCmdLGUIProfilerDumpCSV(
+	TEXT("lgui.Profiler.DumpCSV"),
+	TEXT("Write LGUI profiler's recorded frames to csv file. Parameter is file path, default is Saved/Profiling/LGUIProfiler.csv"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args) {
+		auto FilePath = Args.Num() > 0 ? Args[0] : FPaths::ProfilingDir() / TEXT("LGUIProfiler.csv");
+		if (FLGUIProfiler::DumpToCSV(FilePath))
+		{
+			UE_LOG(LGUI, Log, TEXT("[%s].%d LGUI profiler data write to: %s"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *FilePath);
+		}
+		})
+);
+static FAutoConsoleCommand CCmdLGUIProfilerReset(
+	TEXT("lgui.Profiler.Reset"),
+	TEXT("Clear LGUI profiler's recorded frames."),
+	FConsoleCommandDelegate::CreateStatic(&FLGUIProfiler::Reset)
+);
+
+float FLGUIProfilerFrameStats::GetTime(ELGUIProfilerTimer InTimer)const
+{
+	switch (InTimer)
+	{
+	case ELGUIProfilerTimer::Layout: return LayoutTime;
+	case ELGUIProfilerTimer::Geometry: return GeometryTime;
+	case ELGUIProfilerTimer::Batch: return BatchTime;
+	case ELGUIProfilerTimer::MeshUpload: return MeshUploadTime;
+	case ELGUIProfilerTimer::Raycast: return RaycastTime;
+	case ELGUIProfilerTimer::EventDispatch: return EventDispatchTime;
+	}
+	return 0;
+}
+void FLGUIProfilerFrameStats::AddTime(ELGUIProfilerTimer InTimer, float InMilliseconds)
+{
+	switch (InTimer)
+	{
+	case ELGUIProfilerTimer::Layout: LayoutTime += InMilliseconds; break;
+	case ELGUIProfilerTimer::Geometry: GeometryTime += InMilliseconds; break;
+	case ELGUIProfilerTimer::Batch: BatchTime += InMilliseconds; break;
+	case ELGUIProfilerTimer::MeshUpload: MeshUploadTime += InMilliseconds; break;
+	case ELGUIProfilerTimer::Raycast: RaycastTime += InMilliseconds; break;
+	case ELGUIProfilerTimer::EventDispatch: EventDispatchTime += InMilliseconds; break;
+	}
+}
+
+void FLGUIProfiler::SetEnabled(bool InEnabled)
+{
+	if (bEnabled != InEnabled)
+	{
+		bEnabled = InEnabled;
+		GLGUIProfilerEnable = InEnabled ? 1 : 0;
+		Reset();
+	}
+}
+
+void FLGUIProfiler::Reset()
+{
+	CurrentFrame = FLGUIProfilerFrameStats();
+	CurrentFrame.FrameNumber = GFrameCounter;
+	FrameHistory.Reset();
+}
+
+FLGUIProfilerFrameStats& FLGUIProfiler::GetFrame()
+{
+	check(IsInGameThread());
+	if (CurrentFrame.FrameNumber != (int64)GFrameCounter)
+	{
+		if (MaxHistoryFrameCount > 0)
+		{
+			if (FrameHistory.Num() >= MaxHistoryFrameCount)
+			{
+				FrameHistory.RemoveAt(0, FrameHistory.Num() - MaxHistoryFrameCount + 1, false);
+			}
+			FrameHistory.Add(MoveTemp(CurrentFrame));
+		}
+		CurrentFrame = FLGUIProfilerFrameStats();
+		CurrentFrame.FrameNumber = GFrameCounter;
+	}
+	return CurrentFrame;
+}
+
+const FLGUIProfilerFrameStats& FLGUIProfiler::GetCurrentFrameStats()
+{
+	return GetFrame();
+}
+const FLGUIProfilerFrameStats& FLGUIProfiler::GetLastFrameStats()
+{
+	GetFrame();//push current frame to history if frame changed
+	if (FrameHistory.Num() > 0)
+	{
+		return FrameHistory.Last();
+	}
+	static FLGUIProfilerFrameStats EmptyFrame;
+	return EmptyFrame;
+}
+
+void FLGUIProfiler::AddTime(ELGUIProfilerTimer InTimer, double InSeconds)
+{
+	if (!bEnabled)return;
+	GetFrame().AddTime(InTimer, (float)(InSeconds * 1000.0));
+}
+void FLGUIProfiler::AddRebuiltDrawcall(int32 InVertexCount, int64 InBytes)
+{
+	if (!bEnabled)return;
+	auto& Frame = GetFrame();
+	Frame.RebuiltDrawcallCount++;
+	Frame.UploadedVertexCount += InVertexCount;
+	Frame.UploadedBytes += InBytes;
+}
+void FLGUIProfiler::AddCanvasStats(const ULGUICanvas* InCanvas, double InSeconds, int32 InDirtyItemCount, int32 InRebuiltDrawcallCount, int32 InUploadedVertexCount)
+{
+	if (!bEnabled)return;
+	FLGUIProfilerCanvasStats CanvasStats;
+	CanvasStats.CanvasName =
+#if WITH_EDITOR
+		InCanvas->GetOwner() != nullptr ? InCanvas->GetOwner()->GetActorLabel() :
+#endif
+		InCanvas->GetPathName();
+	CanvasStats.UpdateTime = (float)(InSeconds * 1000.0);
+	CanvasStats.DirtyItemCount = InDirtyItemCount;
+	CanvasStats.RebuiltDrawcallCount = InRebuiltDrawcallCount;
+	CanvasStats.UploadedVertexCount = InUploadedVertexCount;
+	GetFrame().CanvasStats.Add(CanvasStats);
+}
+
+bool FLGUIProfiler::DumpToCSV(const FString& InFilePath)
+{
+	GetFrame();//push current frame to history if frame changed
+	FString Content;
+	Content.Append(TEXT("FrameNumber,LayoutTime,GeometryTime,BatchTime,MeshUploadTime,RaycastTime,EventDispatchTime,DirtyItemCount,RebuiltDrawcallCount,UploadedVertexCount,UploadedBytes,NewGlyphCount,FontTextureExpandCount,CanvasCount,SlowestCanvas,SlowestCanvasTime\n"));
+	for (auto& Frame : FrameHistory)
+	{
+		const FLGUIProfilerCanvasStats* SlowestCanvas = nullptr;
+		for (auto& CanvasStats : Frame.CanvasStats)
+		{
+			if (SlowestCanvas == nullptr || CanvasStats.UpdateTime > SlowestCanvas->UpdateTime)
+			{
+				SlowestCanvas = &CanvasStats;
+			}
+		}
+		Content.Append(FString::Printf(TEXT("%lld,%f,%f,%f,%f,%f,%f,%d,%d,%d,%lld,%d,%d,%d,%s,%f\n")
+			, Frame.FrameNumber
+			, Frame.LayoutTime, Frame.GeometryTime, Frame.BatchTime, Frame.MeshUploadTime, Frame.RaycastTime, Frame.EventDispatchTime
+			, Frame.DirtyItemCount, Frame.RebuiltDrawcallCount, Frame.UploadedVertexCount, Frame.UploadedBytes
+			, Frame.NewGlyphCount, Frame.FontTextureExpandCount
+			, Frame.CanvasStats.Num()
+			, SlowestCanvas != nullptr ? *SlowestCanvas->CanvasName.Replace(TEXT(","), TEXT("_")) : TEXT("")
+			, SlowestCanvas != nullptr ? SlowestCanvas->UpdateTime : 0.0f
+		));
+	}
+	if (!FFileHelper::SaveStringToFile(Content, *InFilePath))
+	{
+		UE_LOG(LGUI, Error, TEXT("[%s].%d Failed to write file: %s"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *InFilePath);
+		return false;
+	}
+	return true;
+}
+
+FLGUIProfilerCanvasScope::FLGUIProfilerCanvasScope(const ULGUICanvas* InCanvas)
+	: Canvas(InCanvas)
+{
+	if (FLGUIProfiler::IsEnabled())
+	{
+		auto& Frame = FLGUIProfiler::GetCurrentFrameStats();
+		StartTime = FPlatformTime::Seconds();
+		StartDirtyItemCount = Frame.DirtyItemCount;
+		StartRebuiltDrawcallCount = Frame.RebuiltDrawcallCount;
+		StartUploadedVertexCount = Frame.UploadedVertexCount;
+	}
+}
+FLGUIProfilerCanvasScope::~FLGUIProfilerCanvasScope()
+{
+	if (StartTime > 0 && FLGUIProfiler::IsEnabled())
+	{
+		auto& Frame = FLGUIProfiler::GetCurrentFrameStats();
+		FLGUIProfiler::AddCanvasStats(Canvas, FPlatformTime::Seconds() - StartTime
+			, Frame.DirtyItemCount - StartDirtyItemCount
+			, Frame.RebuiltDrawcallCount - StartRebuiltDrawcallCount
+			, Frame.UploadedVertexCount - StartUploadedVertexCount
+		);
+	}
+}
+
+#if LGUI_CAN_DISABLE_OPTIMIZATION
+UE_ENABLE_OPTIMIZATION
+#endif
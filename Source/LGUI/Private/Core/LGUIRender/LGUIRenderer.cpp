@@ -385,6 +385,9 @@ void FLGUIRenderer::RenderLGUI_RenderThread(
 	FRHICommandListImmediate& RHICmdList = GraphBuilder.RHICmdList;
 	FVector4f DepthTextureScaleOffset;
 	FVector4f ColorTextureScaleOffset;
+	//render target mode can redraw only dirty rect on top of prev content
+	bool bUseScissor = false;
+	FIntRect ScissorRect;
 	if (RendererType == ELGUIRendererType::RenderTarget)//rendertarget mode
 	{
 		if (!bIsMainViewport)//render to scene capture (or other capture)
@@ -395,6 +398,14 @@ void FLGUIRenderer::RenderLGUI_RenderThread(
 		{
 			ScreenColorRenderTargetTexture = RenderTargetResource->GetRenderTargetTexture();
 			if (ScreenColorRenderTargetTexture == nullptr)return;//invalid render target
+			const FIntRect FullRect(0, 0, ScreenColorRenderTargetTexture->GetSizeXYZ().X, ScreenColorRenderTargetTexture->GetSizeXYZ().Y);
+			if (RenderTargetDirtyRect.Area() > 0)
+			{
+				ScissorRect = RenderTargetDirtyRect;
+				ScissorRect.Clip(FullRect);
+				bUseScissor = ScissorRect.Area() > 0 && ScissorRect != FullRect;
+			}
+			RenderTargetDirtyRect = FIntRect();
 
 			if (NumSamples > 1)
 			{
@@ -407,18 +418,26 @@ void FLGUIRenderer::RenderLGUI_RenderThread(
 
 				OrignScreenColorRenderTargetTexture = ScreenColorRenderTargetTexture;
 				ScreenColorRenderTargetTexture = MSAARenderTarget->GetRHI();
+				if (bUseScissor)//msaa render target is from pool, need prev content
+				{
+					CopyRenderTarget(GraphBuilder, GetGlobalShaderMap(InView.GetFeatureLevel()), OrignScreenColorRenderTargetTexture, ScreenColorRenderTargetTexture);
+				}
 			}
 
-			//clear render target
+			//clear render target, only dirty rect if use scissor
 			{
 				auto Parameters = GraphBuilder.AllocParameters<FRenderTargetParameters>();
-				Parameters->RenderTargets[0] = FRenderTargetBinding(RegisterExternalTexture(GraphBuilder, ScreenColorRenderTargetTexture, TEXT("LGUIRender_ClearRenderTarget")), ERenderTargetLoadAction::ENoAction);
+				Parameters->RenderTargets[0] = FRenderTargetBinding(RegisterExternalTexture(GraphBuilder, ScreenColorRenderTargetTexture, TEXT("LGUIRender_ClearRenderTarget")), bUseScissor ? ERenderTargetLoadAction::ELoad : ERenderTargetLoadAction::ENoAction);
 				GraphBuilder.AddPass(
 					RDG_EVENT_NAME("LGUIRender_ClearRenderTarget"),
 					Parameters,
 					ERDGPassFlags::Raster,
-					[](FRHICommandListImmediate& RHICmdList)
+					[bUseScissor, ScissorRect](FRHICommandListImmediate& RHICmdList)
 					{
+						if (bUseScissor)
+						{
+							RHICmdList.SetViewport(ScissorRect.Min.X, ScissorRect.Min.Y, 0.0f, ScissorRect.Max.X, ScissorRect.Max.Y, 1.0f);
+						}
 						DrawClearQuad(RHICmdList, FLinearColor(0, 0, 0, 0));
 					}
 				);
@@ -513,20 +532,17 @@ void FLGUIRenderer::RenderLGUI_RenderThread(
 	//Render world space
 	if (WorldSpaceRenderCanvasParameterArray.Num() > 0)
 	{
+		//parameter array is sorted, so collected sequence is in render order
+		SortWorldSpacePrimitive_RenderThread((FVector3f)InView.ViewMatrices.GetViewOrigin());
+
 		//collect render primitive to a sequence
 		struct FWorldSpaceRenderParameterSequence
 		{
-			TArray<FLGUIPrimitiveDataContainer> RenderDataArray;
+			const TArray<FLGUIPrimitiveDataContainer>* RenderDataArray = nullptr;
 			//blend depth, 0-occlude by depth, 1-all visible
 			float BlendDepth = 0.0f;
 			//depth fade effect
 			int DepthFade = 0;
-
-			//for sort translucent
-			FVector3f WorldPosition;
-			//distance to camera (sqare)
-			float DistToCamera = 0;
-			int RenderPriority = 0;
 		};
 		TArray<FWorldSpaceRenderParameterSequence> RenderSequenceArray;
 		for (auto& WorldRenderParameter : WorldSpaceRenderCanvasParameterArray)
@@ -549,14 +565,13 @@ void FLGUIRenderer::RenderLGUI_RenderThread(
 						|| (bFrustumCulling && InView.CullingFrustum.IntersectBox(WorldBounds.Origin, WorldBounds.BoxExtent))//simple View Frustum Culling
 						)
 					{
-						FWorldSpaceRenderParameterSequence Item;
-						WorldRenderParameter.Primitive->CollectRenderData(Item.RenderDataArray, CurrentWorldTime);
-						if (Item.RenderDataArray.Num() > 0)
+						const auto& RenderDataArray = WorldRenderParameter.Primitive->GetCachedRenderData(CurrentWorldTime);
+						if (RenderDataArray.Num() > 0)
 						{
+							FWorldSpaceRenderParameterSequence Item;
+							Item.RenderDataArray = &RenderDataArray;
 							Item.BlendDepth = WorldRenderParameter.BlendDepth;
 							Item.DepthFade = WorldRenderParameter.DepthFade;
-							Item.WorldPosition = WorldRenderParameter.Primitive->GetWorldPositionForSortTranslucent();
-							Item.RenderPriority = WorldRenderParameter.Primitive->GetRenderPriority();
 							RenderSequenceArray.Add(Item);
 						}
 					}
@@ -592,38 +607,39 @@ void FLGUIRenderer::RenderLGUI_RenderThread(
 
 		RenderView->ViewUniformBuffer = TUniformBufferRef<FViewUniformShaderParameters>::CreateUniformBufferImmediate(ViewUniformShaderParameters, UniformBuffer_SingleFrame);
 
-		//if (bNeedSortWorldSpaceRenderCanvas)//@todo: mark dirty when need to
-		{
-			bNeedSortWorldSpaceRenderCanvas = false;
+		//consecutive meshes which share same depth parameters are rendered in one pass
+		TArray<FLGUIPrimitiveDataContainer> MeshRenderDataArray;
+		float MeshBlendDepth = 0.0f;
+		int MeshDepthFade = 0;
+		auto AddMeshRenderPass = [&] {
+			if (MeshRenderDataArray.Num() == 0)return;
+			auto* PassParameters = GraphBuilder.AllocParameters<FLGUIWorldRenderPSParameter>();
+			PassParameters->SceneDepthTex = SceneTextures.Depth.Resolve;
+			PassParameters->RenderTargets[0] = FRenderTargetBinding(RenderTargetTexture, ERenderTargetLoadAction::ELoad);
 
-			auto InViewPosition = (FVector3f)RenderView->ViewMatrices.GetViewOrigin();
-			for (auto& Item : RenderSequenceArray)
-			{
-				Item.DistToCamera = FVector3f::DistSquared(InViewPosition, Item.WorldPosition);
-			}
-			RenderSequenceArray.Sort([InViewPosition](const FWorldSpaceRenderParameterSequence& A, const FWorldSpaceRenderParameterSequence& B) {
-				if (A.RenderPriority == B.RenderPriority)
-				{
-					return A.DistToCamera > B.DistToCamera;
-				}
-				else
+			GraphBuilder.AddPass(
+				RDG_EVENT_NAME("LGUIRender_WorldSpace"),
+				PassParameters,
+				ERDGPassFlags::Raster,
+				[this, DepthFade = MeshDepthFade, BlendDepth = MeshBlendDepth, RenderDataArray = MoveTemp(MeshRenderDataArray), RenderView, ViewRect, PassParameters, SceneDepthTexST = DepthTextureScaleOffset, NumSamples, GammaValue](FRHICommandListImmediate& RHICmdList)
 				{
-					return A.RenderPriority < B.RenderPriority;
-				}
+					RenderWorldSpaceMeshes_RenderThread(RHICmdList, RenderView, RenderDataArray, BlendDepth, DepthFade, SceneDepthTexST, PassParameters->SceneDepthTex->GetRHI(), ViewRect, NumSamples, GammaValue);
 				});
-		}
-
+			MeshRenderDataArray.Reset();
+		};
 		for (auto& RenderSequenceItem : RenderSequenceArray)
 		{
-			for (auto& RenderPrimitiveItem : RenderSequenceItem.RenderDataArray)
+			for (auto& RenderPrimitiveItem : *RenderSequenceItem.RenderDataArray)
 			{
 				switch (RenderPrimitiveItem.Type)
 				{
 				case ELGUIRendererPrimitiveType::PostProcess://render post process
 				{
+					AddMeshRenderPass();//post process need the meshes before it
 					for (int i = 0; i < RenderPrimitiveItem.Sections.Num(); i++)
 					{
-						if (auto Primitive = RenderPrimitiveItem.Primitive->GetPostProcessElement(RenderPrimitiveItem.Sections[i].SectionPointer))
+						auto Primitive = RenderPrimitiveItem.Primitive->GetPostProcessElement(RenderPrimitiveItem.Sections[i].SectionPointer);
+						if (Primitive != nullptr && Primitive->CanRender())//cached render data include all post process
 						{
 							Primitive->OnRenderPostProcess_RenderThread(
 								GraphBuilder,
@@ -645,106 +661,19 @@ void FLGUIRenderer::RenderLGUI_RenderThread(
 				break;
 				case ELGUIRendererPrimitiveType::Mesh://render mesh
 				{
-					auto* PassParameters = GraphBuilder.AllocParameters<FLGUIWorldRenderPSParameter>();
-					PassParameters->SceneDepthTex = SceneTextures.Depth.Resolve;
-					PassParameters->RenderTargets[0] = FRenderTargetBinding(RenderTargetTexture, ERenderTargetLoadAction::ELoad);
-
-					GraphBuilder.AddPass(
-						RDG_EVENT_NAME("LGUIRender_WorldSpace"),
-						PassParameters,
-						ERDGPassFlags::Raster,
-						[this, DepthFade = RenderSequenceItem.DepthFade, BlendDepth = RenderSequenceItem.BlendDepth, RenderPrimitiveItem, RenderView, ViewRect, PassParameters, SceneDepthTexST = DepthTextureScaleOffset, NumSamples, GammaValue](FRHICommandListImmediate& RHICmdList)
-						{
-							FGraphicsPipelineStateInitializer GraphicsPSOInit;
-							RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
-							RHICmdList.SetViewport(ViewRect.Min.X, ViewRect.Min.Y, 0.0f, ViewRect.Max.X, ViewRect.Max.Y, 1.0f);
-
-							MeshBatchArray.Reset();
-							FSceneRenderingBulkObjectAllocator Allocator;
-							FLGUIMeshElementCollector meshCollector(RenderView->GetFeatureLevel(), Allocator);
-							RenderPrimitiveItem.Primitive->GetMeshElements(*RenderView->Family, (FMeshElementCollector*)&meshCollector, RenderPrimitiveItem, MeshBatchArray);
-							for (int MeshIndex = 0; MeshIndex < MeshBatchArray.Num(); MeshIndex++)
-							{
-								auto& MeshBatchContainer = MeshBatchArray[MeshIndex];
-								const FMeshBatch& Mesh = MeshBatchContainer.Mesh;
-								auto Material = Mesh.MaterialRenderProxy->GetMaterialNoFallback(RenderView->GetFeatureLevel());//why not use "GetIncompleteMaterialWithFallback" here? because fallback material cann't render with LGUIRenderer
-								if (!Material)return;
-#if LGUI_ENABLE_SCENETEXTURES
-								FRHIUniformBuffer* SceneTextureUniformBuffer = GetSceneTextureExtracts().GetUniformBuffer();
-								if (!SceneTextureUniformBuffer)return;
-								const FUniformBufferStaticBindings StaticUniformBuffers(SceneTextureUniformBuffer);
-								SCOPED_UNIFORM_BUFFER_STATIC_BINDINGS(RHICmdList, StaticUniformBuffers);
-#endif
-
-								FLGUIRenderer::SetGraphicPipelineState(RenderView->GetFeatureLevel(), GraphicsPSOInit, Material->GetBlendMode()
-									, Material->IsWireframe(), Material->IsTwoSided(), Material->ShouldDisableDepthTest(), false, Mesh.ReverseCulling
-								);
-
-								if (DepthFade <= 0)
-								{
-									TShaderRef<FLGUIScreenRenderVS> VertexShader;
-									TShaderRef<FLGUIWorldRenderPS> PixelShader;
-									FMaterialShaderTypes ShaderTypes;
-									ShaderTypes.AddShaderType<FLGUIScreenRenderVS>();
-									ShaderTypes.AddShaderType<FLGUIWorldRenderPS>();
-									FMaterialShaders Shaders;
-									if (Material->TryGetShaders(ShaderTypes, nullptr, Shaders))
-									{
-										Shaders.TryGetVertexShader(VertexShader);
-										Shaders.TryGetPixelShader(PixelShader);
-
-										GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GetLGUIMeshVertexDeclaration();
-										GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
-										GraphicsPSOInit.BoundShaderState.PixelShaderRHI = PixelShader.GetPixelShader();
-										GraphicsPSOInit.PrimitiveType = EPrimitiveType::PT_TriangleList;
-										GraphicsPSOInit.NumSamples = NumSamples;
-										SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0, EApplyRendertargetOption::CheckApply);
-
-										VertexShader->SetMaterialShaderParameters(RHICmdList, *RenderView, Mesh.MaterialRenderProxy, Material, Mesh);
-										PixelShader->SetMaterialShaderParameters(RHICmdList, *RenderView, Mesh.MaterialRenderProxy, Material, Mesh);
-										PixelShader->SetDepthBlendParameter(RHICmdList, BlendDepth, SceneDepthTexST, PassParameters->SceneDepthTex->GetRHI());
-										PixelShader->SetGammaValue(RHICmdList, GammaValue);
-
-										RHICmdList.SetStreamSource(0, MeshBatchContainer.VertexBufferRHI, 0);
-										RHICmdList.DrawIndexedPrimitive(Mesh.Elements[0].IndexBuffer->IndexBufferRHI, 0, 0, MeshBatchContainer.NumVerts, 0, Mesh.GetNumPrimitives(), 1);
-									}
-								}
-								else
-								{
-									TShaderRef<FLGUIScreenRenderVS> VertexShader;
-									TShaderRef<FLGUIWorldRenderDepthFadePS> PixelShader;
-									FMaterialShaderTypes ShaderTypes;
-									ShaderTypes.AddShaderType<FLGUIScreenRenderVS>();
-									ShaderTypes.AddShaderType<FLGUIWorldRenderDepthFadePS>();
-									FMaterialShaders Shaders;
-									if (Material->TryGetShaders(ShaderTypes, nullptr, Shaders))
-									{
-										Shaders.TryGetVertexShader(VertexShader);
-										Shaders.TryGetPixelShader(PixelShader);
-
-										GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GetLGUIMeshVertexDeclaration();
-										GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
-										GraphicsPSOInit.BoundShaderState.PixelShaderRHI = PixelShader.GetPixelShader();
-										GraphicsPSOInit.PrimitiveType = EPrimitiveType::PT_TriangleList;
-										GraphicsPSOInit.NumSamples = NumSamples;
-										SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0, EApplyRendertargetOption::CheckApply);
-
-										VertexShader->SetMaterialShaderParameters(RHICmdList, *RenderView, Mesh.MaterialRenderProxy, Material, Mesh);
-										PixelShader->SetMaterialShaderParameters(RHICmdList, *RenderView, Mesh.MaterialRenderProxy, Material, Mesh);
-										PixelShader->SetDepthBlendParameter(RHICmdList, BlendDepth, SceneDepthTexST, PassParameters->SceneDepthTex->GetRHI());
-										PixelShader->SetDepthFadeParameter(RHICmdList, DepthFade);
-										PixelShader->SetGammaValue(RHICmdList, GammaValue);
-
-										RHICmdList.SetStreamSource(0, MeshBatchContainer.VertexBufferRHI, 0);
-										RHICmdList.DrawIndexedPrimitive(Mesh.Elements[0].IndexBuffer->IndexBufferRHI, 0, 0, MeshBatchContainer.NumVerts, 0, Mesh.GetNumPrimitives(), 1);
-									}
-								}
-							}
-						});
+					if (MeshRenderDataArray.Num() > 0
+						&& (MeshBlendDepth != RenderSequenceItem.BlendDepth || MeshDepthFade != RenderSequenceItem.DepthFade))
+					{
+						AddMeshRenderPass();
+					}
+					MeshBlendDepth = RenderSequenceItem.BlendDepth;
+					MeshDepthFade = RenderSequenceItem.DepthFade;
+					MeshRenderDataArray.Add(RenderPrimitiveItem);
 				}break;
 				}
 			}
 		}
+		AddMeshRenderPass();
 		GraphBuilder.AddPass(
 			RDG_EVENT_NAME("LGUI_RenderWorld_Clean"),
 			ERDGPassFlags::None,
@@ -900,7 +829,7 @@ void FLGUIRenderer::RenderLGUI_RenderThread(
 					RDG_EVENT_NAME("LGUIRender_ScreenSpace"),
 					PassParameters,
 					ERDGPassFlags::Raster,
-					[this, RenderSequenceItem, RenderView, ViewRect, SceneDepthTexST = DepthTextureScaleOffset, NumSamples, ValidDepth = LGUIScreenSpaceDepthRDGTexture != nullptr, GammaValue](FRHICommandListImmediate& RHICmdList)
+					[this, RenderSequenceItem, RenderView, ViewRect, SceneDepthTexST = DepthTextureScaleOffset, NumSamples, ValidDepth = LGUIScreenSpaceDepthRDGTexture != nullptr, GammaValue, bUseScissor, ScissorRect](FRHICommandListImmediate& RHICmdList)
 					{
 						MeshBatchArray.Reset();
 						FSceneRenderingBulkObjectAllocator Allocator;
@@ -932,6 +861,10 @@ void FLGUIRenderer::RenderLGUI_RenderThread(
 								Shaders.TryGetPixelShader(PixelShader);
 
 								RHICmdList.SetViewport(ViewRect.Min.X, ViewRect.Min.Y, 0.0f, ViewRect.Max.X, ViewRect.Max.Y, 1.0f);
+								if (bUseScissor)
+								{
+									RHICmdList.SetScissorRect(true, ScissorRect.Min.X, ScissorRect.Min.Y, ScissorRect.Max.X, ScissorRect.Max.Y);
+								}
 
 								FGraphicsPipelineStateInitializer GraphicsPSOInit;
 								RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
@@ -953,6 +886,10 @@ void FLGUIRenderer::RenderLGUI_RenderThread(
 
 								RHICmdList.SetStreamSource(0, MeshBatchContainer.VertexBufferRHI, 0);
 								RHICmdList.DrawIndexedPrimitive(Mesh.Elements[0].IndexBuffer->IndexBufferRHI, 0, 0, MeshBatchContainer.NumVerts, 0, Mesh.Elements[0].NumPrimitives, Mesh.Elements[0].NumInstances);
+								if (bUseScissor)
+								{
+									RHICmdList.SetScissorRect(false, 0, 0, 0, 0);
+								}
 							}
 						}
 					});
@@ -1054,6 +991,138 @@ void FLGUIRenderer::RenderLGUI_RenderThread(
 	}
 }
 
+void FLGUIRenderer::RenderWorldSpaceMeshes_RenderThread(
+	FRHICommandListImmediate& RHICmdList
+	, const FSceneView* RenderView
+	, const TArray<FLGUIPrimitiveDataContainer>& RenderDataArray
+	, float BlendDepth
+	, int DepthFade
+	, const FVector4f& SceneDepthTexST
+	, FRHITexture* SceneDepthTex
+	, const FIntRect& ViewRect
+	, uint8 NumSamples
+	, float GammaValue
+)
+{
+	FGraphicsPipelineStateInitializer GraphicsPSOInit;
+	RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
+	RHICmdList.SetViewport(ViewRect.Min.X, ViewRect.Min.Y, 0.0f, ViewRect.Max.X, ViewRect.Max.Y, 1.0f);
+#if LGUI_ENABLE_SCENETEXTURES
+	FRHIUniformBuffer* SceneTextureUniformBuffer = GetSceneTextureExtracts().GetUniformBuffer();
+	if (!SceneTextureUniformBuffer)return;
+	const FUniformBufferStaticBindings StaticUniformBuffers(SceneTextureUniformBuffer);
+	SCOPED_UNIFORM_BUFFER_STATIC_BINDINGS(RHICmdList, StaticUniformBuffers);
+#endif
+
+	FSceneRenderingBulkObjectAllocator Allocator;
+	FLGUIMeshElementCollector meshCollector(RenderView->GetFeatureLevel(), Allocator);
+	//material with same FMaterial (eg: MaterialInstanceDynamic from same parent) use same shaders, so only query shaders and set pipeline state when FMaterial, culling or instancing change
+	const FMaterial* PrevMaterial = nullptr;
+	bool bPrevReverseCulling = false;
+	bool bPrevInstanced = false;
+	bool bShadersValid = false;
+	TShaderRef<FLGUIScreenRenderVS> VertexShader;
+	TShaderRef<FLGUIWorldRenderPS> PixelShader;
+	TShaderRef<FLGUIWorldRenderDepthFadePS> DepthFadePixelShader;
+	for (auto& RenderPrimitiveItem : RenderDataArray)
+	{
+		MeshBatchArray.Reset();
+		RenderPrimitiveItem.Primitive->GetMeshElements(*RenderView->Family, (FMeshElementCollector*)&meshCollector, RenderPrimitiveItem, MeshBatchArray);
+		for (int MeshIndex = 0; MeshIndex < MeshBatchArray.Num(); MeshIndex++)
+		{
+			auto& MeshBatchContainer = MeshBatchArray[MeshIndex];
+			const FMeshBatch& Mesh = MeshBatchContainer.Mesh;
+			auto Material = Mesh.MaterialRenderProxy->GetMaterialNoFallback(RenderView->GetFeatureLevel());//why not use "GetIncompleteMaterialWithFallback" here? because fallback material cann't render with LGUIRenderer
+			if (!Material)continue;
+			const bool bInstanced = MeshBatchContainer.NumInstances > 0;
+
+			if (Material != PrevMaterial || Mesh.ReverseCulling != bPrevReverseCulling || bInstanced != bPrevInstanced)
+			{
+				PrevMaterial = Material;
+				bPrevReverseCulling = Mesh.ReverseCulling;
+				bPrevInstanced = bInstanced;
+
+				FLGUIRenderer::SetGraphicPipelineState(RenderView->GetFeatureLevel(), GraphicsPSOInit, Material->GetBlendMode()
+					, Material->IsWireframe(), Material->IsTwoSided(), Material->ShouldDisableDepthTest(), false, Mesh.ReverseCulling
+				);
+
+				FMaterialShaderTypes ShaderTypes;
+				if (bInstanced)
+				{
+					ShaderTypes.AddShaderType<FLGUIScreenRenderInstancedVS>();
+				}
+				else
+				{
+					ShaderTypes.AddShaderType<FLGUIScreenRenderVS>();
+				}
+				if (DepthFade <= 0)
+				{
+					ShaderTypes.AddShaderType<FLGUIWorldRenderPS>();
+				}
+				else
+				{
+					ShaderTypes.AddShaderType<FLGUIWorldRenderDepthFadePS>();
+				}
+				FMaterialShaders Shaders;
+				bShadersValid = Material->TryGetShaders(ShaderTypes, nullptr, Shaders);
+				if (bShadersValid)
+				{
+					if (bInstanced)
+					{
+						TShaderRef<FLGUIScreenRenderInstancedVS> InstancedVertexShader;
+						Shaders.TryGetVertexShader(InstancedVertexShader);
+						VertexShader = InstancedVertexShader;
+						GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GetLGUIMeshInstancedVertexDeclaration();
+					}
+					else
+					{
+						Shaders.TryGetVertexShader(VertexShader);
+						GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GetLGUIMeshVertexDeclaration();
+					}
+					GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
+					if (DepthFade <= 0)
+					{
+						Shaders.TryGetPixelShader(PixelShader);
+						GraphicsPSOInit.BoundShaderState.PixelShaderRHI = PixelShader.GetPixelShader();
+					}
+					else
+					{
+						Shaders.TryGetPixelShader(DepthFadePixelShader);
+						GraphicsPSOInit.BoundShaderState.PixelShaderRHI = DepthFadePixelShader.GetPixelShader();
+					}
+					GraphicsPSOInit.PrimitiveType = EPrimitiveType::PT_TriangleList;
+					GraphicsPSOInit.NumSamples = NumSamples;
+					SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0, EApplyRendertargetOption::CheckApply);
+				}
+			}
+			if (!bShadersValid)continue;
+
+			//material parameters and primitive uniform buffer are different for each mesh
+			VertexShader->SetMaterialShaderParameters(RHICmdList, *RenderView, Mesh.MaterialRenderProxy, Material, Mesh);
+			if (DepthFade <= 0)
+			{
+				PixelShader->SetMaterialShaderParameters(RHICmdList, *RenderView, Mesh.MaterialRenderProxy, Material, Mesh);
+				PixelShader->SetDepthBlendParameter(RHICmdList, BlendDepth, SceneDepthTexST, SceneDepthTex);
+				PixelShader->SetGammaValue(RHICmdList, GammaValue);
+			}
+			else
+			{
+				DepthFadePixelShader->SetMaterialShaderParameters(RHICmdList, *RenderView, Mesh.MaterialRenderProxy, Material, Mesh);
+				DepthFadePixelShader->SetDepthBlendParameter(RHICmdList, BlendDepth, SceneDepthTexST, SceneDepthTex);
+				DepthFadePixelShader->SetDepthFadeParameter(RHICmdList, DepthFade);
+				DepthFadePixelShader->SetGammaValue(RHICmdList, GammaValue);
+			}
+
+			RHICmdList.SetStreamSource(0, MeshBatchContainer.VertexBufferRHI, 0);
+			if (bInstanced)
+			{
+				RHICmdList.SetStreamSource(1, MeshBatchContainer.InstanceBufferRHI, 0);
+			}
+			RHICmdList.DrawIndexedPrimitive(Mesh.Elements[0].IndexBuffer->IndexBufferRHI, 0, 0, MeshBatchContainer.NumVerts, 0, Mesh.GetNumPrimitives(), bInstanced ? MeshBatchContainer.NumInstances : 1);
+		}
+	}
+}
+
 
 class FLGUIDummySceneColorResolveBuffer : public FVertexBuffer
 {
@@ -1219,6 +1288,60 @@ void FLGUIRenderer::SortScreenSpacePrimitiveRenderPriority_RenderThread()
 		});
 }
 
+void FLGUIRenderer::SortWorldSpacePrimitive_RenderThread(const FVector3f& InViewPosition)
+{
+	auto& ParameterArray = WorldSpaceRenderCanvasParameterArray;
+	for (auto& Item : ParameterArray)
+	{
+		auto RenderPriority = Item.Primitive->GetRenderPriority();
+		if (Item.RenderPriority != RenderPriority)
+		{
+			Item.RenderPriority = RenderPriority;
+			bNeedSortWorldSpaceRenderCanvas = true;
+		}
+		Item.DistToCamera = FVector3f::DistSquared(InViewPosition, Item.Primitive->GetWorldPositionForSortTranslucent());
+	}
+	auto Compare = [](const FWorldSpaceRenderParameter& A, const FWorldSpaceRenderParameter& B) {
+		if (A.RenderPriority == B.RenderPriority)
+		{
+			return A.DistToCamera > B.DistToCamera;
+		}
+		else
+		{
+			return A.RenderPriority < B.RenderPriority;
+		}
+	};
+	if (!bNeedSortWorldSpaceRenderCanvas)
+	{
+		//only distance to camera change, array is nearly sorted, so insertion sort is almost linear. if too many items need to move then use full sort
+		const int32 MaxMoveCount = ParameterArray.Num();
+		int32 MoveCount = 0;
+		for (int32 i = 1; i < ParameterArray.Num(); i++)
+		{
+			if (!Compare(ParameterArray[i], ParameterArray[i - 1]))continue;
+			auto Item = ParameterArray[i];
+			int32 j = i;
+			do
+			{
+				ParameterArray[j] = ParameterArray[j - 1];
+				j--;
+				MoveCount++;
+			} while (j > 0 && Compare(Item, ParameterArray[j - 1]));
+			ParameterArray[j] = Item;
+			if (MoveCount > MaxMoveCount)
+			{
+				bNeedSortWorldSpaceRenderCanvas = true;
+				break;
+			}
+		}
+	}
+	if (bNeedSortWorldSpaceRenderCanvas)
+	{
+		bNeedSortWorldSpaceRenderCanvas = false;
+		ParameterArray.Sort(Compare);
+	}
+}
+
 void FLGUIRenderer::MarkNeedToSortScreenSpacePrimitiveRenderPriority()
 {
 	auto ViewExtension = this;
@@ -1272,15 +1395,31 @@ void FLGUIRenderer::ClearScreenSpaceRootCanvas()
 	ScreenSpaceRenderParameter.RootCanvas = nullptr;
 }
 
-void FLGUIRenderer::UpdateRenderTargetRenderer(UTextureRenderTarget2D* InRenderTarget)
+void FLGUIRenderer::UpdateRenderTargetRenderer(UTextureRenderTarget2D* InRenderTarget, const FIntRect& InDirtyRect)
 {
 	auto Resource = InRenderTarget->GameThread_GetRenderTargetResource();
 	if (Resource)
 	{
 		auto ViewExtension = this;
 		ENQUEUE_RENDER_COMMAND(FLGUIRender_UpdateRenderTargetRenderer)(
-			[ViewExtension, Resource](FRHICommandListImmediate& RHICmdList)
+			[ViewExtension, Resource, InDirtyRect](FRHICommandListImmediate& RHICmdList)
 			{
+				auto& DirtyRect = ViewExtension->RenderTargetDirtyRect;
+				if (ViewExtension->RenderTargetResource == Resource)//prev update is not rendered yet, merge dirty rect
+				{
+					if (DirtyRect.Area() > 0 && InDirtyRect.Area() > 0)
+					{
+						DirtyRect.Union(InDirtyRect);
+					}
+					else
+					{
+						DirtyRect = FIntRect();
+					}
+				}
+				else
+				{
+					DirtyRect = InDirtyRect;
+				}
 				ViewExtension->RenderTargetResource = Resource;
 			}
 		);
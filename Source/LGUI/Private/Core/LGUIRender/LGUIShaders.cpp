@@ -9,6 +9,7 @@
 #include "MeshBatch.h"
 
 IMPLEMENT_MATERIAL_SHADER_TYPE(, FLGUIScreenRenderVS, TEXT("/Plugin/LGUI/Private/LGUIShader.usf"), TEXT("MainVS"), SF_Vertex);
+IMPLEMENT_MATERIAL_SHADER_TYPE(, FLGUIScreenRenderInstancedVS, TEXT("/Plugin/LGUI/Private/LGUIShader.usf"), TEXT("MainVS"), SF_Vertex);
 IMPLEMENT_MATERIAL_SHADER_TYPE(, FLGUIScreenRenderPS, TEXT("/Plugin/LGUI/Private/LGUIShader.usf"), TEXT("MainPS"), SF_Pixel);
 IMPLEMENT_MATERIAL_SHADER_TYPE(, FLGUIWorldRenderPS, TEXT("/Plugin/LGUI/Private/LGUIShader.usf"), TEXT("MainPS"), SF_Pixel);
 IMPLEMENT_MATERIAL_SHADER_TYPE(, FLGUIWorldRenderDepthFadePS, TEXT("/Plugin/LGUI/Private/LGUIShader.usf"), TEXT("MainPS"), SF_Pixel);
@@ -42,6 +43,18 @@ void FLGUIScreenRenderVS::SetMaterialShaderParameters(FRHICommandList& RHICmdLis
 }
 
 
+FLGUIScreenRenderInstancedVS::FLGUIScreenRenderInstancedVS(const FMaterialShaderType::CompiledShaderInitializerType& Initializer)
+	:FLGUIScreenRenderVS(Initializer)
+{
+
+}
+void FLGUIScreenRenderInstancedVS::ModifyCompilationEnvironment(const FMaterialShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+{
+	OutEnvironment.SetDefine(TEXT("LGUI_INSTANCED"), true);
+	FLGUIScreenRenderVS::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+}
+
+
 
 FLGUIScreenRenderPS::FLGUIScreenRenderPS(const FMaterialShaderType::CompiledShaderInitializerType& Initializer)
 	:FMaterialShader(Initializer)
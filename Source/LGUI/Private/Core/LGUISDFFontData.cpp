@@ -52,6 +52,10 @@ void ULGUISDFFontData::AddCharDataToCache(const TCHAR& charCode, const float& ch
 {
 	charDataMap.Add(charCode, charData);
 }
+void ULGUISDFFontData::GetCachedCharDataArray(TArray<FLGUICharData>& OutCharDataArray)const
+{
+	charDataMap.GenerateValueArray(OutCharDataArray);
+}
 void ULGUISDFFontData::ScaleDownUVofCachedChars()
 {
 	for (auto& charDataItem : charDataMap)
@@ -157,13 +161,17 @@ void ULGUISDFFontData::ApplyPackingAtlasTextureExpand(UTexture2D* newTexture, in
 	}
 }
 
-void ULGUISDFFontData::PrepareForPushCharData(UUIText* InText)
+void ULGUISDFFontData::InitFont()
 {
-	italicSlop = FMath::Tan(FMath::DegreesToRadians(ItalicAngle));
 	oneDivideFontSize = 1.0f / FontSize;
-	auto CompScale = InText->GetComponentScale();
-	objectScale = FMath::Max(CompScale.X, CompScale.Y);
 	SDFRadius = FontSize * 0.25f;//use 1/4 of FontSize can get good result
+	Super::InitFont();
+}
+void ULGUISDFFontData::PrepareForPushCharData(UUIText* InText, FLGUIFontPushCharDataParams& OutParams)
+{
+	OutParams.ItalicSlop = FMath::Tan(FMath::DegreesToRadians(ItalicAngle));
+	auto CompScale = InText->GetComponentScale();
+	OutParams.ObjectScale = FMath::Max(CompScale.X, CompScale.Y);
 }
 
 uint8 ULGUISDFFontData::GetRequireAdditionalShaderChannels()
@@ -211,7 +219,7 @@ UMaterialInterface* ULGUISDFFontData::GetFontMaterial(ELGUICanvasClipType clipTy
 
 void ULGUISDFFontData::PushCharData(
 	TCHAR charCode, const FVector2f& inLineOffset, const FVector2f& fontSpace, const FLGUICharData_HighPrecision& charData,
-	const LGUIRichTextParser::RichTextParseResult& richTextProperty,
+	const LGUIRichTextParser::RichTextParseResult& richTextProperty, const FLGUIFontPushCharDataParams& params,
 	int verticesStartIndex, int indicesStartIndex,
 	int& outAdditionalVerticesCount, int& outAdditionalIndicesCount,
 	TArray<FLGUIOriginVertexData>& originVertices, TArray<FLGUIMeshVertex>& vertices, TArray<FLGUIMeshIndexBufferType>& triangleIndices
@@ -287,10 +295,10 @@ void ULGUISDFFontData::PushCharData(
 			vert3 = FVector3f(0, x, y);
 			if (richTextProperty.italic)
 			{
-				auto vert01ItalicOffset = (charData.height - charData.yoffset) * italicSlop;
+				auto vert01ItalicOffset = (charData.height - charData.yoffset) * params.ItalicSlop;
 				vert0.Y -= vert01ItalicOffset;
 				vert1.Y -= vert01ItalicOffset;
-				auto vert23ItalicOffset = charData.yoffset * italicSlop;
+				auto vert23ItalicOffset = charData.yoffset * params.ItalicSlop;
 				vert2.Y += vert23ItalicOffset;
 				vert3.Y += vert23ItalicOffset;
 			}
@@ -335,7 +343,7 @@ void ULGUISDFFontData::PushCharData(
 	//uv
 	{
 		int addVertCount = 0;
-		auto tempFontScale = richTextProperty.size * objectScale;
+		auto tempFontScale = richTextProperty.size * params.ObjectScale;
 		{
 			vertices[verticesStartIndex].TextureCoordinate[0] = charData.GetUV0();
 			vertices[verticesStartIndex + 1].TextureCoordinate[0] = charData.GetUV1();
@@ -474,8 +482,14 @@ void ULGUISDFFontData::PostEditChangeProperty(FPropertyChangedEvent& PropertyCha
 			|| PropertyName == GET_MEMBER_NAME_CHECKED(ULGUISDFFontData, SDFRadius)
 			)
 		{
+			oneDivideFontSize = 1.0f / FontSize;
+			SDFRadius = FontSize * 0.25f;
 			ReloadFont();
 		}
+		if (PropertyName == GET_MEMBER_NAME_CHECKED(ULGUISDFFontData, BoldRatio))
+		{
+			MarkCharDataChanged();//char size is affected by BoldRatio
+		}
 		if (
 			PropertyName == GET_MEMBER_NAME_CHECKED(ULGUISDFFontData, SDFDefaultMaterials)
 			|| PropertyName == GET_MEMBER_NAME_CHECKED(ULGUISDFFontData, ItalicAngle)
@@ -55,6 +55,18 @@ TextureFilter ULGUISettings::GetAtlasTextureFilter(const FName& InPackingTag)
 {
 	return GetAtlasSettings(InPackingTag).atlasTextureFilter;
 }
+int32 ULGUISettings::GetAtlasPageMaxSize(const FName& InPackingTag)
+{
+	return ConvertAtlasTextureSizeTypeToSize(GetAtlasSettings(InPackingTag).atlasPageMaxSize);
+}
+int32 ULGUISettings::GetAtlasMaxPageCount(const FName& InPackingTag)
+{
+	return GetAtlasSettings(InPackingTag).atlasMaxPageCount;
+}
+ELGUIRectPackerType ULGUISettings::GetAtlasRectPacker(const FName& InPackingTag)
+{
+	return GetAtlasSettings(InPackingTag).atlasRectPacker;
+}
 const TMap<FName, FLGUIAtlasSettings>& ULGUISettings::GetAllAtlasSettings()
 {
 	return GetDefault<ULGUISettings>()->atlasSettingForSpecificPackingTag;
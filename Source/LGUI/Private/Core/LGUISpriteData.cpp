@@ -15,9 +15,24 @@
 #include "TextureCompiler.h"
 #include "Utils/LGUIUtils.h"
 #include "RenderingThread.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "ImageUtils.h"
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "HAL/IConsoleManager.h"
 
 #define LOCTEXT_NAMESPACE "LGUISpriteData"
 
+static int32 GLGUISpriteDataMaxConcurrentAsyncCreate = 2;
+static FAutoConsoleVariableRef CVarLGUISpriteDataMaxConcurrentAsyncCreate(
+	TEXT("lgui.SpriteData.MaxConcurrentAsyncCreate"),
+	GLGUISpriteDataMaxConcurrentAsyncCreate,
+	TEXT("Max count of image that decode at same time for LGUISpriteData's async create functions, other requests will wait in queue."),
+	ECVF_Default);
+
 void FLGUISpriteInfo::ApplyUV(int32 InX, int32 InY, int32 InWidth, int32 InHeight, float texFullWidthReciprocal, float texFullHeightReciprocal)
 {
 	width = InWidth;
@@ -54,43 +69,56 @@ void FLGUISpriteInfo::ApplyBorderUV(float texFullWidthReciprocal, float texFullH
 	buv3Y = uv3Y + borderTop * texFullHeightReciprocal;
 }
 
-bool ULGUISpriteData::InsertTexture(FLGUIDynamicSpriteAtlasData* InAtlasData)
+bool ULGUISpriteData::InsertTexture(FLGUIDynamicSpriteAtlasData* InAtlasData, int32 InPageIndex)
 {
-#if WITH_EDITOR
+	//settings are per packing tag, so not cache them in function static
 	int32 spaceBetweenSprites = ULGUISettings::GetAtlasTexturePadding(packingTag);
-#else
-	static int32 spaceBetweenSprites = ULGUISettings::GetAtlasTexturePadding(packingTag);
-#endif
-	auto SizeX = InAtlasData->atlasTexture->GetSizeX();
+	auto& page = InAtlasData->pages[InPageIndex];
+	auto SizeX = page.atlasBinPack->GetBinWidth();
 	check(SizeX != 0);
 	float atlasTextureSizeInv = 1.0f / SizeX;
 
-	auto method = rbp::MaxRectsBinPack::RectBestAreaFit;
 #if WITH_EDITOR
-	FTextureCompilingManager::Get().FinishCompilation({ spriteTexture });
+	if (spriteTexture != nullptr)
+	{
+		FTextureCompilingManager::Get().FinishCompilation({ spriteTexture });
+	}
 #endif
-	int insertRectWidth = spriteTexture->GetSizeX() + spaceBetweenSprites + spaceBetweenSprites;
-	int insertRectHeight = spriteTexture->GetSizeY() + spaceBetweenSprites + spaceBetweenSprites;
+	auto spriteSourceSize = GetSpriteSourceSize();
+	int insertRectWidth = spriteSourceSize.X + spaceBetweenSprites + spaceBetweenSprites;
+	int insertRectHeight = spriteSourceSize.Y + spaceBetweenSprites + spaceBetweenSprites;
 
-	auto packedRect = InAtlasData->atlasBinPack.Insert(insertRectWidth, insertRectHeight, method);
+	auto packedRect = page.atlasBinPack->Insert(insertRectWidth, insertRectHeight);
 	if (packedRect.height <= 0)//means this area cannot fit the texture
 	{
 		return false;
 	}
 	else//this area can fit the texture, copy pixels
 	{
-		atlasTexture = InAtlasData->atlasTexture;
+		atlasTexture = page.atlasTexture;
+		atlasPackedRect = packedRect;
 		//remove space
 		packedRect.x += spaceBetweenSprites;
 		packedRect.y += spaceBetweenSprites;
 		packedRect.width -= spaceBetweenSprites + spaceBetweenSprites;
 		packedRect.height -= spaceBetweenSprites + spaceBetweenSprites;
 		//pixels
-		CopySpriteTextureToAtlas(packedRect, spaceBetweenSprites);
+		if (spritePixels.IsValid())
+		{
+			CopySpritePixelsToAtlas(packedRect, spaceBetweenSprites);
+		}
+		else
+		{
+			CopySpriteTextureToAtlas(packedRect, spaceBetweenSprites);
+		}
 		//add to sprite
 		spriteInfo.ApplyUV(packedRect.x, packedRect.y, packedRect.width, packedRect.height, atlasTextureSizeInv, atlasTextureSizeInv);
 		spriteInfo.ApplyBorderUV(atlasTextureSizeInv, atlasTextureSizeInv);
-		InAtlasData->spriteDataArray.Add(this);
+		page.spriteDataArray.Add(this);
+		if (atlasRenderRefCount == 0)
+		{
+			InAtlasData->unusedSpriteArray.AddUnique(this);
+		}
 		return true;
 	}
 }
@@ -228,50 +256,143 @@ void ULGUISpriteData::CopySpriteTextureToAtlas(rbp::Rect InPackedRect, int32 InA
 	}
 }
 
+void ULGUISpriteData::CopySpritePixelsToAtlas(rbp::Rect InPackedRect, int32 InAtlasTexturePadding)
+{
+	if (atlasTexture->GetResource() == nullptr)return;
+	auto AtlasTextureResource = (FTexture2DResource*)atlasTexture->GetResource();
+	auto SrcPixels = spritePixels;
+	int32 Padding = useEdgePixelPadding ? InAtlasTexturePadding : 0;
+	ENQUEUE_RENDER_COMMAND(FLGUISpriteCopyPixelsData)(
+		[AtlasTextureResource, SrcPixels, InPackedRect, Padding](FRHICommandListImmediate& RHICmdList)
+	{
+		int32 SrcWidth = InPackedRect.width;
+		int32 SrcHeight = InPackedRect.height;
+		if (Padding <= 0)
+		{
+			FUpdateTextureRegion2D Region(InPackedRect.x, InPackedRect.y, 0, 0, SrcWidth, SrcHeight);
+			RHIUpdateTexture2D(AtlasTextureResource->GetTexture2DRHI(), 0, Region, SrcWidth * sizeof(FColor), (const uint8*)SrcPixels->GetData());
+			return;
+		}
+		//repeat edge pixels into padding, so the whole rect can upload as one region
+		int32 DstWidth = SrcWidth + Padding + Padding;
+		int32 DstHeight = SrcHeight + Padding + Padding;
+		TArray<FColor> DstPixels;
+		DstPixels.SetNumUninitialized(DstWidth * DstHeight);
+		for (int32 y = 0; y < DstHeight; y++)
+		{
+			const FColor* SrcRow = SrcPixels->GetData() + FMath::Clamp(y - Padding, 0, SrcHeight - 1) * SrcWidth;
+			FColor* DstRow = DstPixels.GetData() + y * DstWidth;
+			for (int32 x = 0; x < Padding; x++)
+			{
+				DstRow[x] = SrcRow[0];
+				DstRow[Padding + SrcWidth + x] = SrcRow[SrcWidth - 1];
+			}
+			FMemory::Memcpy(DstRow + Padding, SrcRow, SrcWidth * sizeof(FColor));
+		}
+		FUpdateTextureRegion2D Region(InPackedRect.x - Padding, InPackedRect.y - Padding, 0, 0, DstWidth, DstHeight);
+		RHIUpdateTexture2D(AtlasTextureResource->GetTexture2DRHI(), 0, Region, DstWidth * sizeof(FColor), (const uint8*)DstPixels.GetData());
+	});
+}
+
 bool ULGUISpriteData::PackageSprite()
 {
-	CheckAndApplySpriteTextureSetting(spriteTexture);
+	if (spriteTexture != nullptr)
+	{
+		CheckAndApplySpriteTextureSetting(spriteTexture);
+	}
 
 	auto atlasData = ULGUIDynamicSpriteAtlasManager::FindOrAdd(packingTag);
 	atlasData->EnsureAtlasTexture(packingTag);
-	atlasTexture = atlasData->atlasTexture;
-PACK_AND_INSERT:
-	if (InsertTexture(atlasData))
+	//settings are per packing tag, so not cache them in function static
+	int32 spaceBetweenSprites = ULGUISettings::GetAtlasTexturePadding(packingTag);
+	int32 maxPageSize = ULGUISettings::GetAtlasPageMaxSize(packingTag);
+	int32 maxPageCount = ULGUISettings::GetAtlasMaxPageCount(packingTag);
+	maxPageSize = FMath::Min(maxPageSize, (int32)GetMax2DTextureDimension());
+	auto spriteSourceSize = GetSpriteSourceSize();
+	int insertRectWidth = spriteSourceSize.X + spaceBetweenSprites + spaceBetweenSprites;
+	int insertRectHeight = spriteSourceSize.Y + spaceBetweenSprites + spaceBetweenSprites;
+	if (insertRectWidth > maxPageSize || insertRectHeight > maxPageSize)
 	{
-		return true;
+		auto warningMsg = FText::Format(LOCTEXT("PackageSprite_AtlasSize_Error", "{0} Trying to insert texture:{1}, result too large size that not supported! Maximun texture size is:{2}.")
+			, FText::FromString(FString::Printf(TEXT("[%s].%d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__))
+			, FText::FromString(GetSpriteSourceName()), maxPageSize);
+		UE_LOG(LGUI, Error, TEXT("%s"), *warningMsg.ToString());
+#if WITH_EDITOR
+		LGUIUtils::EditorNotification(warningMsg);
+#endif
+		return false;
 	}
-	else//all area cannot fit the texture, then expend texture size
+	while (true)
 	{
-		int32 newTextureSize = atlasData->GetWillExpendTextureSize();
-		UE_LOG(LGUI, Log, TEXT("[%s].%d Insert texture:%s expend size to %d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *(spriteTexture->GetPathName()), newTextureSize);
-		if (newTextureSize > WARNING_ATLAS_SIZE)
+		//try every page
+		for (int pageIndex = 0; pageIndex < atlasData->pages.Num(); pageIndex++)
 		{
-			auto warningMsg = FText::Format(LOCTEXT("PackageSprite_AtlasSize_Warning", "{0} Trying to insert texture:{1}, result to expend size to:{2} larger than the preferred maximun texture size:{3}!\
+			if (InsertTexture(atlasData, pageIndex))
+			{
+				return true;
+			}
+		}
+		//all area cannot fit the texture, then expend last page's texture size
+		int32 lastPageIndex = atlasData->pages.Num() - 1;
+		int32 newTextureSize = atlasData->GetWillExpendTextureSize(lastPageIndex);
+		if (newTextureSize <= maxPageSize)
+		{
+			UE_LOG(LGUI, Log, TEXT("[%s].%d Insert texture:%s expend size to %d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *GetSpriteSourceName(), newTextureSize);
+			if (newTextureSize > WARNING_ATLAS_SIZE)
+			{
+				auto warningMsg = FText::Format(LOCTEXT("PackageSprite_AtlasSize_Warning", "{0} Trying to insert texture:{1}, result to expend size to:{2} larger than the preferred maximun texture size:{3}!\
 \nTry reduce some sprite texture size, or use UITexture to render some large texture, or use different packingTag to split your atlasTexture.\
 \nAlso remember to dispose unused atlas by call function DisposeAtlasByPackingTag from LGUIDynamicSpriteAtlasManager.\
 ")
-				, FText::FromString(FString::Printf(TEXT("[%s].%d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__))
-				, FText::FromString(spriteTexture->GetPathName())
-				, newTextureSize, WARNING_ATLAS_SIZE);
-			UE_LOG(LGUI, Warning, TEXT("%s"), *warningMsg.ToString());
+					, FText::FromString(FString::Printf(TEXT("[%s].%d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__))
+					, FText::FromString(GetSpriteSourceName())
+					, newTextureSize, WARNING_ATLAS_SIZE);
+				UE_LOG(LGUI, Warning, TEXT("%s"), *warningMsg.ToString());
 #if WITH_EDITOR
-			LGUIUtils::EditorNotification(warningMsg);
+				LGUIUtils::EditorNotification(warningMsg);
 #endif
+			}
+			atlasData->ExpendTextureSize(packingTag, lastPageIndex);
+			continue;
+		}
+		//page reach max size, evict sprites that not used by any render object
+		if (atlasData->EvictUnusedSpritesForSpace(packingTag, insertRectWidth, insertRectHeight))
+		{
+			continue;
 		}
-		if ((uint32)newTextureSize > GetMax2DTextureDimension())
+		//still no space, add new page
+		if (maxPageCount <= 0 || atlasData->pages.Num() < maxPageCount)
 		{
-			auto warningMsg = FText::Format(LOCTEXT("PackageSprite_AtlasSize_Error", "{0} Trying to insert texture:{1}, result too large size that not supported! Maximun texture size is:{2}.")
-				, FText::FromString(FString::Printf(TEXT("[%s].%d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__))
-				, FText::FromString(spriteTexture->GetPathName()), GetMax2DTextureDimension());
-			UE_LOG(LGUI, Error, TEXT("%s"), *warningMsg.ToString());
+			UE_LOG(LGUI, Log, TEXT("[%s].%d Insert texture:%s add atlas page: %d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *GetSpriteSourceName(), atlasData->pages.Num());
+			atlasData->AddPage(packingTag);
+			continue;
+		}
+		auto warningMsg = FText::Format(LOCTEXT("PackageSprite_AtlasPageCount_Error", "{0} Trying to insert texture:{1}, but atlas of packingTag:{2} is full! Max page count is:{3}, max page size is:{4}.")
+			, FText::FromString(FString::Printf(TEXT("[%s].%d"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__))
+			, FText::FromString(GetSpriteSourceName()), FText::FromName(packingTag), maxPageCount, maxPageSize);
+		UE_LOG(LGUI, Error, TEXT("%s"), *warningMsg.ToString());
 #if WITH_EDITOR
-			LGUIUtils::EditorNotification(warningMsg);
+		LGUIUtils::EditorNotification(warningMsg);
 #endif
-			return false;
-		}
-		atlasData->ExpendTextureSize(packingTag);
-		goto PACK_AND_INSERT;
+		return false;
+	}
+}
+
+FIntPoint ULGUISpriteData::GetSpriteSourceSize()const
+{
+	if (spritePixels.IsValid())
+	{
+		return spritePixelsSize;
+	}
+	return FIntPoint(spriteTexture->GetSizeX(), spriteTexture->GetSizeY());
+}
+FString ULGUISpriteData::GetSpriteSourceName()const
+{
+	if (spriteTexture != nullptr)
+	{
+		return spriteTexture->GetPathName();
 	}
+	return this->GetPathName();
 }
 
 void ULGUISpriteData::CheckSpriteTexture()
@@ -434,6 +555,11 @@ void ULGUISpriteData::InitSpriteData()
 				UE_LOG(LGUI, Error, TEXT("[%s].%d PackingAtlas:%s pack error, will fallback to use PackingTag!"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *(packingAtlas->GetPathName()));
 			}
 		}
+		if (spritePixels.IsValid())//created from image file, can only live in dynamic atlas
+		{
+			isInitialized = !packingTag.IsNone() && PackageSprite();
+			return;
+		}
 		if (spriteTexture == nullptr)
 		{
 			UE_LOG(LGUI, Error, TEXT("[%s].%d SpriteData:%s spriteTexture is null!"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *(this->GetPathName()));
@@ -537,6 +663,205 @@ ULGUISpriteData* ULGUISpriteData::CreateLGUISpriteData(UObject* Outer, UTexture2
 	return result;
 }
 
+/** Queue and run requests of create sprite from image file, all functions must be called on game thread. */
+class FLGUISpriteDataAsyncCreator
+{
+public:
+	struct FRequest
+	{
+		int32 Id = 0;
+		TWeakObjectPtr<UObject> Outer;
+		bool bHasOuter = false;
+		FString FilePath;
+		TArray<uint8> ImageData;
+		int32 MaxSize = 0;
+		FVector2D HorizontalBorder;
+		FVector2D VerticalBorder;
+		FName PackingTag;
+		FLGUISpriteDataAsyncCreateDelegate Callback;
+		/** set on game thread, checked on worker thread so cancelled request can skip decode */
+		FThreadSafeBool bCancelled;
+		/** decode result, write on worker thread and read on game thread after finish */
+		TArray<FColor> Pixels;
+		int32 Width = 0;
+		int32 Height = 0;
+	};
+	typedef TSharedPtr<FRequest, ESPMode::ThreadSafe> FRequestPtr;
+
+	static int32 Add(const FRequestPtr& InRequest)
+	{
+		check(IsInGameThread());
+		InRequest->Id = ++NextRequestId;
+		PendingRequests.Add(InRequest);
+		StartPendingRequests();
+		return InRequest->Id;
+	}
+	static bool Cancel(int32 InRequestId)
+	{
+		check(IsInGameThread());
+		auto Predicate = [InRequestId](const FRequestPtr& Item) { return Item->Id == InRequestId; };
+		if (PendingRequests.RemoveAll(Predicate) > 0)
+		{
+			return true;
+		}
+		if (auto FoundRequest = RunningRequests.FindByPredicate(Predicate))
+		{
+			(*FoundRequest)->bCancelled = true;
+			return true;
+		}
+		return false;
+	}
+private:
+	static int32 NextRequestId;
+	static TArray<FRequestPtr> PendingRequests;
+	static TArray<FRequestPtr> RunningRequests;
+
+	static void StartPendingRequests()
+	{
+		while (PendingRequests.Num() > 0 && RunningRequests.Num() < FMath::Max(GLGUISpriteDataMaxConcurrentAsyncCreate, 1))
+		{
+			auto Request = PendingRequests[0];
+			PendingRequests.RemoveAt(0);
+			RunningRequests.Add(Request);
+			//module must be loaded on game thread
+			auto ImageWrapperModule = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+			Async(EAsyncExecution::ThreadPool, [Request, ImageWrapperModule] {
+				if (!Request->bCancelled)
+				{
+					Decode(*Request, *ImageWrapperModule);
+				}
+				AsyncTask(ENamedThreads::GameThread, [Request] {
+					Finish(Request);
+				});
+			});
+		}
+	}
+	/** run on worker thread */
+	static void Decode(FRequest& InRequest, IImageWrapperModule& InImageWrapperModule)
+	{
+		if (!InRequest.FilePath.IsEmpty())
+		{
+			if (!FFileHelper::LoadFileToArray(InRequest.ImageData, *InRequest.FilePath))
+			{
+				UE_LOG(LGUI, Error, TEXT("[%s].%d Failed to load file: %s"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *InRequest.FilePath);
+				return;
+			}
+		}
+		auto ImageFormat = InImageWrapperModule.DetectImageFormat(InRequest.ImageData.GetData(), InRequest.ImageData.Num());
+		if (ImageFormat == EImageFormat::Invalid)
+		{
+			UE_LOG(LGUI, Error, TEXT("[%s].%d Not supported image format: %s"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *InRequest.FilePath);
+			return;
+		}
+		auto ImageWrapper = InImageWrapperModule.CreateImageWrapper(ImageFormat);
+		TArray<uint8> RawData;
+		if (!ImageWrapper.IsValid()
+			|| !ImageWrapper->SetCompressed(InRequest.ImageData.GetData(), InRequest.ImageData.Num())
+			|| !ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, RawData))
+		{
+			UE_LOG(LGUI, Error, TEXT("[%s].%d Failed to decode image: %s"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *InRequest.FilePath);
+			return;
+		}
+		InRequest.ImageData.Empty();
+		int32 Width = ImageWrapper->GetWidth();
+		int32 Height = ImageWrapper->GetHeight();
+		InRequest.Pixels.SetNumUninitialized(Width * Height);
+		FMemory::Memcpy(InRequest.Pixels.GetData(), RawData.GetData(), Width * Height * sizeof(FColor));
+		if (InRequest.MaxSize > 0 && FMath::Max(Width, Height) > InRequest.MaxSize)
+		{
+			float Scale = (float)InRequest.MaxSize / FMath::Max(Width, Height);
+			int32 NewWidth = FMath::Max(FMath::RoundToInt(Width * Scale), 1);
+			int32 NewHeight = FMath::Max(FMath::RoundToInt(Height * Scale), 1);
+			TArray<FColor> ResizedPixels;
+			FImageUtils::ImageResize(Width, Height, InRequest.Pixels, NewWidth, NewHeight, ResizedPixels, false, false);
+			InRequest.Pixels = MoveTemp(ResizedPixels);
+			Width = NewWidth;
+			Height = NewHeight;
+		}
+		InRequest.Width = Width;
+		InRequest.Height = Height;
+	}
+	static void Finish(const FRequestPtr& InRequest)
+	{
+		RunningRequests.Remove(InRequest);
+		if (!InRequest->bCancelled && !(InRequest->bHasOuter && !InRequest->Outer.IsValid()))
+		{
+			ULGUISpriteData* Result = nullptr;
+			if (InRequest->Pixels.Num() > 0)
+			{
+				Result = NewObject<ULGUISpriteData>(InRequest->bHasOuter ? InRequest->Outer.Get() : GetTransientPackage());
+				Result->spriteTexture = nullptr;
+				Result->spritePixelsSize = FIntPoint(InRequest->Width, InRequest->Height);
+				Result->spritePixels = MakeShared<TArray<FColor>, ESPMode::ThreadSafe>(MoveTemp(InRequest->Pixels));
+				Result->packingTag = InRequest->PackingTag;
+				auto& spriteInfo = Result->spriteInfo;
+				spriteInfo.width = InRequest->Width;
+				spriteInfo.height = InRequest->Height;
+				spriteInfo.borderLeft = (uint16)InRequest->HorizontalBorder.X;
+				spriteInfo.borderRight = (uint16)InRequest->HorizontalBorder.Y;
+				spriteInfo.borderTop = (uint16)InRequest->VerticalBorder.X;
+				spriteInfo.borderBottom = (uint16)InRequest->VerticalBorder.Y;
+				//pack into atlas now, so the sprite is ready to render
+				Result->InitSpriteData();
+				if (!Result->isInitialized)
+				{
+					Result = nullptr;
+				}
+			}
+			InRequest->Callback.ExecuteIfBound(Result);
+		}
+		StartPendingRequests();
+	}
+};
+int32 FLGUISpriteDataAsyncCreator::NextRequestId = 0;
+TArray<FLGUISpriteDataAsyncCreator::FRequestPtr> FLGUISpriteDataAsyncCreator::PendingRequests;
+TArray<FLGUISpriteDataAsyncCreator::FRequestPtr> FLGUISpriteDataAsyncCreator::RunningRequests;
+
+static int32 AddAsyncCreateRequest(UObject* Outer, FString&& InFilePath, TArray<uint8>&& InImageData, const FLGUISpriteDataAsyncCreateDelegate& InCallback, int32 InMaxSize, FVector2D inHorizontalBorder, FVector2D inVerticalBorder, FName inPackingTag)
+{
+	if (inPackingTag.IsNone())
+	{
+		UE_LOG(LGUI, Error, TEXT("[%s].%d PackingTag must not be None!"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__);
+		return 0;
+	}
+	auto Request = MakeShared<FLGUISpriteDataAsyncCreator::FRequest, ESPMode::ThreadSafe>();
+	Request->Outer = Outer;
+	Request->bHasOuter = IsValid(Outer);
+	Request->FilePath = MoveTemp(InFilePath);
+	Request->ImageData = MoveTemp(InImageData);
+	Request->MaxSize = InMaxSize;
+	Request->HorizontalBorder = inHorizontalBorder;
+	Request->VerticalBorder = inVerticalBorder;
+	Request->PackingTag = inPackingTag;
+	Request->Callback = InCallback;
+	return FLGUISpriteDataAsyncCreator::Add(Request);
+}
+int32 ULGUISpriteData::CreateLGUISpriteDataFromFileAsync(UObject* Outer, const FString& InFilePath, const FLGUISpriteDataAsyncCreateDynamicDelegate& InCallback, int32 InMaxSize, FVector2D inHorizontalBorder, FVector2D inVerticalBorder, FName inPackingTag)
+{
+	return CreateLGUISpriteDataFromFileAsync(Outer, InFilePath, FLGUISpriteDataAsyncCreateDelegate::CreateLambda([InCallback](ULGUISpriteData* CreatedSprite) {
+		InCallback.ExecuteIfBound(CreatedSprite);
+		}), InMaxSize, inHorizontalBorder, inVerticalBorder, inPackingTag);
+}
+int32 ULGUISpriteData::CreateLGUISpriteDataFromFileAsync(UObject* Outer, const FString& InFilePath, const FLGUISpriteDataAsyncCreateDelegate& InCallback, int32 InMaxSize, FVector2D inHorizontalBorder, FVector2D inVerticalBorder, FName inPackingTag)
+{
+	FString FilePath = FPaths::IsRelative(InFilePath) ? FPaths::ProjectDir() / InFilePath : InFilePath;
+	return AddAsyncCreateRequest(Outer, MoveTemp(FilePath), TArray<uint8>(), InCallback, InMaxSize, inHorizontalBorder, inVerticalBorder, inPackingTag);
+}
+int32 ULGUISpriteData::CreateLGUISpriteDataFromMemoryAsync(UObject* Outer, const TArray<uint8>& InImageData, const FLGUISpriteDataAsyncCreateDynamicDelegate& InCallback, int32 InMaxSize, FVector2D inHorizontalBorder, FVector2D inVerticalBorder, FName inPackingTag)
+{
+	return CreateLGUISpriteDataFromMemoryAsync(Outer, TArray<uint8>(InImageData), FLGUISpriteDataAsyncCreateDelegate::CreateLambda([InCallback](ULGUISpriteData* CreatedSprite) {
+		InCallback.ExecuteIfBound(CreatedSprite);
+		}), InMaxSize, inHorizontalBorder, inVerticalBorder, inPackingTag);
+}
+int32 ULGUISpriteData::CreateLGUISpriteDataFromMemoryAsync(UObject* Outer, TArray<uint8>&& InImageData, const FLGUISpriteDataAsyncCreateDelegate& InCallback, int32 InMaxSize, FVector2D inHorizontalBorder, FVector2D inVerticalBorder, FName inPackingTag)
+{
+	return AddAsyncCreateRequest(Outer, FString(), MoveTemp(InImageData), InCallback, InMaxSize, inHorizontalBorder, inVerticalBorder, inPackingTag);
+}
+bool ULGUISpriteData::CancelAsyncCreateLGUISpriteData(int32 InRequestId)
+{
+	return FLGUISpriteDataAsyncCreator::Cancel(InRequestId);
+}
+
 void ULGUISpriteData::AddUISprite(TScriptInterface<class IUISpriteRenderableInterface> InUISprite)
 {
 	if (IsValid(packingAtlas))
@@ -550,8 +875,7 @@ void ULGUISpriteData::AddUISprite(TScriptInterface<class IUISpriteRenderableInte
 	else if (!packingTag.IsNone())
 	{
 		InitSpriteData();
-		auto& spriteArray = ULGUIDynamicSpriteAtlasManager::FindOrAdd(packingTag)->renderSpriteArray;
-		spriteArray.AddUnique(InUISprite.GetObject());
+		ULGUIDynamicSpriteAtlasManager::FindOrAdd(packingTag)->AddRenderSprite(this, InUISprite.GetObject());
 	}
 }
 void ULGUISpriteData::RemoveUISprite(TScriptInterface<class IUISpriteRenderableInterface> InUISprite)
@@ -565,9 +889,9 @@ void ULGUISpriteData::RemoveUISprite(TScriptInterface<class IUISpriteRenderableI
 	}
 	else if (!packingTag.IsNone())
 	{
-		if (auto spriteData = ULGUIDynamicSpriteAtlasManager::Find(packingTag))
+		if (auto atlasData = ULGUIDynamicSpriteAtlasManager::Find(packingTag))
 		{
-			spriteData->renderSpriteArray.RemoveSingle(InUISprite.GetObject());
+			atlasData->RemoveRenderSprite(this, InUISprite.GetObject());
 		}
 	}
 }
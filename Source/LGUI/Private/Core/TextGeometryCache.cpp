@@ -5,10 +5,203 @@
 #include "Core/ActorComponent/UIText.h"
 #include "Core/LGUIRichTextImageData.h"
 #include "Core/LGUIFontData_BaseObject.h"
+#include "Core/ActorComponent/LGUICanvas.h"
+#include "Core/LGUIRichTextCustomStyleData.h"
+#include "LGUI.h"
+#include "Containers/LruCache.h"
+#include "UObject/ObjectKey.h"
+#include "HAL/IConsoleManager.h"
+#include "Algo/BinarySearch.h"
 
-FTextGeometryCache::FTextGeometryCache(UUIText* InUIText)
+#if LGUI_CAN_DISABLE_OPTIMIZATION
+UE_DISABLE_OPTIMIZATION
+#endif
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("TextGeometrySharedCache Hit"), STAT_TextGeometrySharedCacheHit, STATGROUP_LGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("TextGeometrySharedCache Miss"), STAT_TextGeometrySharedCacheMiss, STATGROUP_LGUI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("TextGeometrySharedCache EntryCount"), STAT_TextGeometrySharedCacheEntryCount, STATGROUP_LGUI);
+DECLARE_MEMORY_STAT(TEXT("TextGeometrySharedCache Memory"), STAT_TextGeometrySharedCacheMemory, STATGROUP_LGUI);
+
+namespace LGUITextGeometrySharedCache
+{
+	/** Everything that affect UIGeometry::UpdateUIText's result, except UIText's transform */
+	struct FKey
+	{
+		FString Content;
+		int32 VisibleCharCount = 0;
+		float Width = 0;
+		float Height = 0;
+		FVector2f Pivot = FVector2f::ZeroVector;
+		FColor Color = FColor::White;//only rich text, because rich text's color is mixed with tag's color. none rich text just use it's own color after copy
+		FVector2f FontSpace = FVector2f::ZeroVector;
+		float FontSize = 0;
+		float MaxHorizontalWidth = 0;
+		EUITextParagraphHorizontalAlign ParagraphHAlign = EUITextParagraphHorizontalAlign::Left;
+		EUITextParagraphVerticalAlign ParagraphVAlign = EUITextParagraphVerticalAlign::Bottom;
+		EUITextOverflowType OverflowType = EUITextOverflowType::HorizontalOverflow;
+		EUITextFontStyle FontStyle = EUITextFontStyle::None;
+		bool bUseKerning = false;
+		bool bFixedWidthDigit = false;
+		bool bRichText = false;
+		int32 RichTextFilterFlags = 0;
+		FObjectKey Font;
+		FObjectKey RichTextCustomStyleData;
+		//canvas
+		float RootCanvasScale = 1;
+		float DynamicPixelsPerUnit = 1;
+		bool bWorldSpace = false;
+		bool bRequireNormalOrTangent = false;
+		bool bRequireUV1 = false;
+
+		uint32 Hash = 0;
+		void CalculateHash()
+		{
+			Hash = FCrc::StrCrc32(*Content);//case sensitive, GetTypeHash(FString) is not
+			Hash = HashCombine(Hash, GetTypeHash(VisibleCharCount));
+			Hash = HashCombine(Hash, GetTypeHash(Width));
+			Hash = HashCombine(Hash, GetTypeHash(Height));
+			Hash = HashCombine(Hash, GetTypeHash(Pivot));
+			Hash = HashCombine(Hash, GetTypeHash(Color));
+			Hash = HashCombine(Hash, GetTypeHash(FontSpace));
+			Hash = HashCombine(Hash, GetTypeHash(FontSize));
+			Hash = HashCombine(Hash, GetTypeHash(MaxHorizontalWidth));
+			Hash = HashCombine(Hash, (uint32)ParagraphHAlign | ((uint32)ParagraphVAlign << 8) | ((uint32)OverflowType << 16) | ((uint32)FontStyle << 24));
+			Hash = HashCombine(Hash, (uint32)bUseKerning | ((uint32)bRichText << 1) | ((uint32)bWorldSpace << 2) | ((uint32)bRequireNormalOrTangent << 3) | ((uint32)bRequireUV1 << 4) | ((uint32)bFixedWidthDigit << 5));
+			Hash = HashCombine(Hash, GetTypeHash(RichTextFilterFlags));
+			Hash = HashCombine(Hash, GetTypeHash(Font));
+			Hash = HashCombine(Hash, GetTypeHash(RichTextCustomStyleData));
+			Hash = HashCombine(Hash, GetTypeHash(RootCanvasScale));
+			Hash = HashCombine(Hash, GetTypeHash(DynamicPixelsPerUnit));
+		}
+		bool operator==(const FKey& Other)const
+		{
+			return Hash == Other.Hash
+				&& VisibleCharCount == Other.VisibleCharCount
+				&& Width == Other.Width
+				&& Height == Other.Height
+				&& Pivot == Other.Pivot
+				&& Color == Other.Color
+				&& FontSpace == Other.FontSpace
+				&& FontSize == Other.FontSize
+				&& MaxHorizontalWidth == Other.MaxHorizontalWidth
+				&& ParagraphHAlign == Other.ParagraphHAlign
+				&& ParagraphVAlign == Other.ParagraphVAlign
+				&& OverflowType == Other.OverflowType
+				&& FontStyle == Other.FontStyle
+				&& bUseKerning == Other.bUseKerning
+				&& bFixedWidthDigit == Other.bFixedWidthDigit
+				&& bRichText == Other.bRichText
+				&& RichTextFilterFlags == Other.RichTextFilterFlags
+				&& Font == Other.Font
+				&& RichTextCustomStyleData == Other.RichTextCustomStyleData
+				&& RootCanvasScale == Other.RootCanvasScale
+				&& DynamicPixelsPerUnit == Other.DynamicPixelsPerUnit
+				&& bWorldSpace == Other.bWorldSpace
+				&& bRequireNormalOrTangent == Other.bRequireNormalOrTangent
+				&& bRequireUV1 == Other.bRequireUV1
+				&& Content.Equals(Other.Content, ESearchCase::CaseSensitive)
+				;
+		}
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return Key.Hash;
+		}
+	};
+	struct FEntry
+	{
+		TArray<FLGUIOriginVertexData> OriginVertices;
+		TArray<FLGUIMeshVertex> Vertices;
+		TArray<FLGUIMeshIndexBufferType> Triangles;
+		FVector2f TextRealSize = FVector2f::ZeroVector;
+		TArray<FUITextLineProperty> LinePropertyArray;
+		TArray<FUITextCharProperty> CharPropertyArray;
+		TArray<FUIText_RichTextCustomTag> RichTextCustomTagArray;
+		TArray<FUIText_RichTextImageTag> RichTextImageTagArray;
+		int64 MemorySize = 0;
+	};
+
+	static int32 MaxEntryCount = 256;
+	/** Long text is unlikely to be same with other text, and cost more memory, so skip it */
+	static int32 MaxContentLength = 256;
+	static TLruCache<FKey, TSharedPtr<FEntry>>& GetCache()
+	{
+		static TLruCache<FKey, TSharedPtr<FEntry>> Cache(FMath::Max(MaxEntryCount, 1));
+		return Cache;
+	}
+	static int64 MemorySize = 0;
+	static int64 HitCount = 0;
+	static int64 MissCount = 0;
+
+	static void Clear()
+	{
+		auto& Cache = GetCache();
+		if (Cache.Num() == 0 && Cache.Max() == FMath::Max(MaxEntryCount, 1))return;
+		Cache.Empty(FMath::Max(MaxEntryCount, 1));
+		SET_DWORD_STAT(STAT_TextGeometrySharedCacheEntryCount, 0);
+		SET_MEMORY_STAT(STAT_TextGeometrySharedCacheMemory, 0);
+		MemorySize = 0;
+	}
+	static void Add(const FKey& Key, const TSharedPtr<FEntry>& Entry)
+	{
+		auto& Cache = GetCache();
+		if (Cache.Num() >= Cache.Max())
+		{
+			auto RemovedEntry = Cache.RemoveLeastRecent();
+			if (RemovedEntry.IsValid())
+			{
+				MemorySize -= RemovedEntry->MemorySize;
+			}
+		}
+		Cache.Add(Key, Entry);
+		MemorySize += Entry->MemorySize;
+		SET_DWORD_STAT(STAT_TextGeometrySharedCacheEntryCount, Cache.Num());
+		SET_MEMORY_STAT(STAT_TextGeometrySharedCacheMemory, MemorySize);
+	}
+
+	static FAutoConsoleVariableRef CVarMaxEntryCount(
+		TEXT("lgui.TextGeometrySharedCache.MaxEntryCount"),
+		MaxEntryCount,
+		TEXT("Max count of text layout result that can share between UIText. 0 to disable the cache."),
+		FConsoleVariableDelegate::CreateLambda([](IConsoleVariable* InVariable) {
+			Clear();
+			}),
+		ECVF_Default);
+	static FAutoConsoleVariableRef CVarMaxContentLength(
+		TEXT("lgui.TextGeometrySharedCache.MaxContentLength"),
+		MaxContentLength,
+		TEXT("Text longer than this will not use shared layout cache."),
+		ECVF_Default);
+	static FAutoConsoleCommand CCmdStats(
+		TEXT("lgui.TextGeometrySharedCache.Stats"),
+		TEXT("Print hit rate and memory of text layout shared cache."),
+		FConsoleCommandDelegate::CreateLambda([]() {
+			UE_LOG(LGUI, Log, TEXT("[%s].%d TextGeometrySharedCache: entry: %d/%d, memory: %lld bytes, hit: %lld, miss: %lld, hit rate: %f")
+				, ANSI_TO_TCHAR(__FUNCTION__), __LINE__
+				, GetCache().Num(), MaxEntryCount, MemorySize, HitCount, MissCount, FTextGeometrySharedCache::GetHitRate());
+			})
+	);
+	static FAutoConsoleCommand CCmdClear(
+		TEXT("lgui.TextGeometrySharedCache.Clear"),
+		TEXT("Remove all text layout result in shared cache."),
+		FConsoleCommandDelegate::CreateStatic(&FTextGeometrySharedCache::Clear)
+	);
+}
+
+FTextGeometryCache::FTextGeometryCache(UUIText* InUIText, bool InLayoutOnly)
 {
 	this->UIText = InUIText;
+	if (InLayoutOnly)
+	{
+		layoutOnlyGeometry = MakeShared<UIGeometry>();
+	}
+}
+UIGeometry* FTextGeometryCache::GetGeometry()const
+{
+	if (layoutOnlyGeometry.IsValid())
+	{
+		return layoutOnlyGeometry.Get();
+	}
+	return this->UIText->GetGeometry();
 }
 bool FTextGeometryCache::SetInputParameters(
 	const FString& InContent,
@@ -17,7 +210,6 @@ bool FTextGeometryCache::SetInputParameters(
 	float InHeight,
 	FVector2f InPivot,
 	FColor InColor,
-	float InCanvasGroupAlpha,
 	FVector2f InFontSpace,
 	float InFontSize,
 	EUITextParagraphHorizontalAlign InParagraphHAlign,
@@ -31,7 +223,8 @@ bool FTextGeometryCache::SetInputParameters(
 	ULGUIFontData_BaseObject* InFont
 )
 {
-	if (!this->content.Equals(InContent))
+	if (&InContent != &this->content//content is already edited in place, eg: AppendContent/ReplaceContent
+		&& !this->content.Equals(InContent))
 	{
 		this->content = InContent;
 		bIsDirty = true;
@@ -49,7 +242,10 @@ bool FTextGeometryCache::SetInputParameters(
 	if (this->height != InHeight)
 	{
 		this->height = InHeight;
-		bIsDirty = true;
+		if (!IsLayoutIndependentOfHeight())
+		{
+			bIsDirty = true;
+		}
 	}
 	if (this->pivot != InPivot)
 	{
@@ -71,14 +267,6 @@ bool FTextGeometryCache::SetInputParameters(
 		this->richTextFilterFlags = InRichTextFilterFlags;
 		bIsDirty = true;
 	}
-	if (this->canvasGroupAlpha != InCanvasGroupAlpha)
-	{
-		this->canvasGroupAlpha = InCanvasGroupAlpha;
-		if (this->richText)//CanvasGroupAlpha only affect rich text alpha
-		{
-			bIsColorDirty = true;
-		}
-	}
 	if (this->fontSpace != InFontSpace)
 	{
 		this->fontSpace = InFontSpace;
@@ -132,18 +320,729 @@ void FTextGeometryCache::MarkDirty()
 	bIsDirty = true;
 }
 
+void FTextGeometryCache::OnGeometryCleared()
+{
+	if (!bIsDirty && fullGeometry.IsValid())
+	{
+		bIsRestoreDirty = true;
+	}
+	else
+	{
+		bIsDirty = true;
+	}
+}
+
+void FTextGeometryCache::ApplyFontTextureScaleUp()
+{
+	bDigitTemplateValid = false;
+	fontTextureScaleUpCount++;
+	if (fullGeometry.IsValid())
+	{
+		auto& vertices = fullGeometry->vertices;
+		for (int i = 0; i < vertices.Num(); i++)
+		{
+			vertices[i].TextureCoordinate[0] *= 0.5f;
+		}
+	}
+}
+
+int32 FTextGeometryCache::GetRevealIndicesCount()const
+{
+	if (revealCharCount < 0 || revealCharCount >= cacheCharPropertyArray.Num())
+	{
+		return fullGeometry->triangles.Num();
+	}
+	if (revealCharCount == 0)
+	{
+		return 0;
+	}
+	auto& charProperty = cacheCharPropertyArray[revealCharCount - 1];
+	return charProperty.StartTriangleIndex + charProperty.IndicesCount;
+}
+
+void FTextGeometryCache::OnFullGeometryReady(UIGeometry* InGeo)
+{
+	if (revealCharCount < 0)
+	{
+		fullGeometry.Reset();
+		revealIndicesCount = -1;
+		return;
+	}
+	if (!fullGeometry.IsValid())
+	{
+		fullGeometry = MakeShared<UIGeometry>();
+	}
+	InGeo->CopyTo(fullGeometry.Get());
+	revealIndicesCount = GetRevealIndicesCount();
+	InGeo->triangles.SetNum(revealIndicesCount, false);
+}
+
+bool FTextGeometryCache::SetRevealCharCount(int32 InRevealCharCount, UIGeometry* InGeo)
+{
+	if (revealCharCount == InRevealCharCount)return true;
+	revealCharCount = InRevealCharCount;
+	if (!fullGeometry.IsValid())
+	{
+		if (revealCharCount >= 0)
+		{
+			bIsDirty = true;//layout full text once and keep it
+		}
+		return false;
+	}
+	if (InGeo == nullptr || bIsDirty || bIsRestoreDirty
+		|| InGeo->triangles.Num() != revealIndicesCount//geometry is modified by other
+		|| InGeo->vertices.Num() != fullGeometry->vertices.Num()
+		)
+	{
+		return false;
+	}
+	//all glyph's vertices are already in geometry, only need to add or remove triangle indices
+	auto newRevealIndicesCount = GetRevealIndicesCount();
+	if (newRevealIndicesCount > revealIndicesCount)
+	{
+		InGeo->triangles.Append(fullGeometry->triangles.GetData() + revealIndicesCount, newRevealIndicesCount - revealIndicesCount);
+	}
+	else
+	{
+		InGeo->triangles.SetNum(newRevealIndicesCount, false);
+	}
+	revealIndicesCount = newRevealIndicesCount;
+	return true;
+}
+
+bool FTextGeometryCache::CanUseSharedCache()const
+{
+	if (LGUITextGeometrySharedCache::MaxEntryCount <= 0)return false;
+	if (layoutOnlyGeometry.IsValid())return false;//not rendered, no need to share
+	if (this->content.Len() > LGUITextGeometrySharedCache::MaxContentLength)return false;
+	if (this->font->GetNeedObjectScale())return false;//layout result rely on UIText's scale
+	auto RenderCanvas = this->UIText->GetRenderCanvas();
+	if (this->UIText->GetShouldAffectByPixelPerfect() && RenderCanvas->GetActualPixelPerfect() && !RenderCanvas->GetRootCanvas()->IsRenderToWorldSpace())return false;//pixel perfect snap vertex position by UIText's location
+	return true;
+}
+
+bool FTextGeometryCache::IsLayoutIndependentOfHeight()const
+{
+	return this->paragraphVAlign == EUITextParagraphVerticalAlign::Top
+		&& this->pivot.Y == 1.0f
+		&& this->overflowType != EUITextOverflowType::ClampContent;
+}
+
+bool FTextGeometryCache::AppendContent(const FString& InAppendContent, int32 InAppendVisibleCharCount, UIGeometry* InGeo)
+{
+	if (bIsDirty || bIsRestoreDirty)return false;
+	if (fullGeometry.IsValid() || revealCharCount >= 0)return false;
+	if (this->richText)return false;//rich text tag can cross the append point
+	if (this->overflowType != EUITextOverflowType::HorizontalOverflow && this->overflowType != EUITextOverflowType::VerticalOverflow)return false;
+	if (this->paragraphVAlign != EUITextParagraphVerticalAlign::Top)return false;//other align will move all lines
+	if (!this->font.IsValid() || !this->UIText.IsValid())return false;
+	auto RenderCanvas = this->UIText->GetRenderCanvas();
+	if (RenderCanvas == nullptr)return false;
+	if (this->UIText->GetShouldAffectByPixelPerfect() && RenderCanvas->GetActualPixelPerfect() && !RenderCanvas->GetRootCanvas()->IsRenderToWorldSpace())return false;
+
+	if (cacheLinePropertyArray.Num() == 0)return false;
+	//a line break by wrap start layout from it's first char, same as a new paragraph, so only last line need layout with appended content, chars before it will not change.
+	//except kerning, which use last char of previous line for the first char, then layout from last paragraph (after last '\n').
+	//empty last line only have line end caret, also use last paragraph.
+	int32 paragraphStartLineIndex = cacheLinePropertyArray.Num() - 1;
+	int32 paragraphStartCharIndex = INDEX_NONE;
+	{
+		auto& caretList = cacheLinePropertyArray[paragraphStartLineIndex].caretPropertyList;
+		if (caretList.Num() == 0)return false;
+		bool bKerningAcrossLine = this->useKerning && this->font->HasKerning();
+		if (!bKerningAcrossLine && caretList[0].charIndex != -1)
+		{
+			paragraphStartCharIndex = caretList[0].charIndex;
+		}
+	}
+	if (paragraphStartCharIndex == INDEX_NONE)
+	{
+		paragraphStartCharIndex = 0;
+		int32 lastNewLineCharIndex;
+		if (this->content.FindLastChar('\n', lastNewLineCharIndex))
+		{
+			paragraphStartCharIndex = lastNewLineCharIndex + 1;
+		}
+		//find first line of last paragraph
+		paragraphStartLineIndex = cacheLinePropertyArray.Num();
+		for (int i = cacheLinePropertyArray.Num() - 1; i >= 0; i--)
+		{
+			auto& caretList = cacheLinePropertyArray[i].caretPropertyList;
+			if (caretList.Num() == 0)return false;
+			if (caretList[0].charIndex != -1 && caretList[0].charIndex < paragraphStartCharIndex)break;
+			paragraphStartLineIndex = i;
+		}
+	}
+	if (paragraphStartCharIndex == 0)return false;//all chars need layout, just layout again
+	if (paragraphStartLineIndex <= 0 || paragraphStartLineIndex >= cacheLinePropertyArray.Num())return false;
+	int32 paragraphStartCharPropertyIndex = cacheCharPropertyArray.Num();
+	for (int i = cacheCharPropertyArray.Num() - 1; i >= 0; i--)
+	{
+		if (cacheCharPropertyArray[i].CharIndex < paragraphStartCharIndex)break;
+		paragraphStartCharPropertyIndex = i;
+	}
+	int32 paragraphStartVertIndex = InGeo->vertices.Num(), paragraphStartTriangleIndex = InGeo->triangles.Num();
+	if (paragraphStartCharPropertyIndex < cacheCharPropertyArray.Num())
+	{
+		auto& charProperty = cacheCharPropertyArray[paragraphStartCharPropertyIndex];
+		paragraphStartVertIndex = charProperty.StartVertIndex;
+		paragraphStartTriangleIndex = charProperty.StartTriangleIndex;
+	}
+	else if (cacheCharPropertyArray.Num() > 0)
+	{
+		auto& charProperty = cacheCharPropertyArray.Last();
+		paragraphStartVertIndex = charProperty.StartVertIndex + charProperty.VertCount;
+		paragraphStartTriangleIndex = charProperty.StartTriangleIndex + charProperty.IndicesCount;
+	}
+	if (paragraphStartVertIndex > InGeo->vertices.Num() || paragraphStartTriangleIndex > InGeo->triangles.Num())return false;
+
+	//layout last line (or last paragraph) with appended content
+	FString paragraphContent = this->content.Mid(paragraphStartCharIndex) + InAppendContent;
+	UIGeometry paragraphGeo;
+	FVector2f paragraphRealSize;
+	TArray<FUITextLineProperty> paragraphLinePropertyArray;
+	TArray<FUITextCharProperty> paragraphCharPropertyArray;
+	TArray<FUIText_RichTextCustomTag> paragraphRichTextCustomTagArray;
+	TArray<FUIText_RichTextImageTag> paragraphRichTextImageTagArray;
+	UIGeometry::UpdateUIText(
+		paragraphContent
+		, UUIText::VisibleCharCountInString(paragraphContent)
+		, this->width
+		, this->height
+		, this->pivot
+		, this->color
+		, this->fontSpace
+		, &paragraphGeo
+		, this->fontSize
+		, this->paragraphHAlign
+		, this->paragraphVAlign
+		, this->overflowType
+		, this->maxHorizontalWidth
+		, this->useKerning
+		, this->fontStyle
+		, paragraphRealSize
+		, RenderCanvas
+		, this->UIText.Get()
+		, paragraphLinePropertyArray
+		, paragraphCharPropertyArray
+		, paragraphRichTextCustomTagArray
+		, paragraphRichTextImageTagArray
+		, this->font.Get()
+		, false
+		, this->richTextFilterFlags
+	);
+	if (paragraphLinePropertyArray.Num() == 0 || paragraphLinePropertyArray[0].caretPropertyList.Num() == 0)return false;
+
+	//paragraph is layout from top, move it to the origin paragraph's line
+	float paragraphOffsetY = cacheLinePropertyArray[paragraphStartLineIndex].caretPropertyList[0].caretPosition.Y - paragraphLinePropertyArray[0].caretPropertyList[0].caretPosition.Y;
+	float heightAboveParagraph = FMath::Abs(cacheLinePropertyArray[0].caretPropertyList[0].caretPosition.Y - cacheLinePropertyArray[paragraphStartLineIndex].caretPropertyList[0].caretPosition.Y);
+
+	//replace last line (or last paragraph)
+	InGeo->originVertices.SetNum(paragraphStartVertIndex, false);
+	InGeo->vertices.SetNum(paragraphStartVertIndex, false);
+	InGeo->triangles.SetNum(paragraphStartTriangleIndex, false);
+	cacheLinePropertyArray.SetNum(paragraphStartLineIndex, false);
+	cacheCharPropertyArray.SetNum(paragraphStartCharPropertyIndex, false);
+
+	UIGeometry::OffsetVertices(paragraphGeo.originVertices, paragraphGeo.originVertices.Num(), 0, paragraphOffsetY);
+	InGeo->originVertices.Append(paragraphGeo.originVertices);
+	InGeo->vertices.Append(paragraphGeo.vertices);
+	for (auto& triangleIndex : paragraphGeo.triangles)
+	{
+		InGeo->triangles.Add(triangleIndex + paragraphStartVertIndex);
+	}
+	for (auto& lineProperty : paragraphLinePropertyArray)
+	{
+		for (auto& caretProperty : lineProperty.caretPropertyList)
+		{
+			caretProperty.caretPosition.Y += paragraphOffsetY;
+			if (caretProperty.charIndex != -1)
+			{
+				caretProperty.charIndex += paragraphStartCharIndex;
+			}
+		}
+		cacheLinePropertyArray.Add(MoveTemp(lineProperty));
+	}
+	for (auto& charProperty : paragraphCharPropertyArray)
+	{
+		charProperty.CharIndex += paragraphStartCharIndex;
+		charProperty.StartVertIndex += paragraphStartVertIndex;
+		charProperty.StartTriangleIndex += paragraphStartTriangleIndex;
+		cacheCharPropertyArray.Add(charProperty);
+	}
+	textRealSize.X = FMath::Max(textRealSize.X, paragraphRealSize.X);
+	textRealSize.Y = heightAboveParagraph + paragraphRealSize.Y;
+
+	this->content.Append(InAppendContent);
+	this->visibleCharCount += InAppendVisibleCharCount;
+	return true;
+}
+
+bool FTextGeometryCache::ReplaceContent(int32 InStartCharIndex, int32 InRemoveCharCount, const FString& InInsertContent, int32 InVisibleCharCountDelta, UIGeometry* InGeo)
+{
+	if (bIsDirty || bIsRestoreDirty)return false;
+	if (fullGeometry.IsValid() || revealCharCount >= 0)return false;
+	if (this->richText)return false;//rich text tag can cross the edit point
+	if (this->overflowType != EUITextOverflowType::HorizontalOverflow && this->overflowType != EUITextOverflowType::VerticalOverflow)return false;
+	if (this->paragraphVAlign != EUITextParagraphVerticalAlign::Top)return false;//other align will move all lines
+	if (!this->font.IsValid() || !this->UIText.IsValid())return false;
+	auto RenderCanvas = this->UIText->GetRenderCanvas();
+	if (RenderCanvas == nullptr)return false;
+	if (this->UIText->GetShouldAffectByPixelPerfect() && RenderCanvas->GetActualPixelPerfect() && !RenderCanvas->GetRootCanvas()->IsRenderToWorldSpace())return false;
+	if (InStartCharIndex < 0 || InRemoveCharCount < 0 || InStartCharIndex + InRemoveCharCount > this->content.Len())return false;
+	if (cacheLinePropertyArray.Num() == 0)return false;
+
+	//edited paragraphs, from the '\n' before edit start to the '\n' after edit end. chars outside will not change layout
+	int32 removeEndCharIndex = InStartCharIndex + InRemoveCharCount;
+	int32 paragraphStartCharIndex = InStartCharIndex;
+	while (paragraphStartCharIndex > 0 && this->content[paragraphStartCharIndex - 1] != '\n')
+	{
+		paragraphStartCharIndex--;
+	}
+	int32 paragraphEndCharIndex = removeEndCharIndex;
+	while (paragraphEndCharIndex < this->content.Len() && this->content[paragraphEndCharIndex] != '\n')
+	{
+		paragraphEndCharIndex++;
+	}
+	//'\r' can pair with '\n' as one line break, leave it to full layout
+	for (int i = FMath::Max(paragraphStartCharIndex - 2, 0), end = FMath::Min(paragraphEndCharIndex + 2, this->content.Len()); i < end; i++)
+	{
+		if (this->content[i] == '\r')return false;
+	}
+	for (auto& charCode : InInsertContent)
+	{
+		if (charCode == '\r')return false;
+	}
+
+	//lines of edited paragraphs, first caret of a line is it's first char
+	int32 startLineIndex = INDEX_NONE, endLineIndex = INDEX_NONE;
+	int32 editLineIndex = INDEX_NONE;
+	for (int i = 0; i < cacheLinePropertyArray.Num(); i++)
+	{
+		auto& caretList = cacheLinePropertyArray[i].caretPropertyList;
+		if (caretList.Num() == 0 || caretList[0].charIndex == -1)return false;
+		auto lineStartCharIndex = caretList[0].charIndex;
+		if (lineStartCharIndex < paragraphStartCharIndex)continue;
+		if (lineStartCharIndex > paragraphEndCharIndex)break;
+		if (startLineIndex == INDEX_NONE)startLineIndex = i;
+		if (lineStartCharIndex <= InStartCharIndex)editLineIndex = i;
+		endLineIndex = i + 1;
+	}
+	if (startLineIndex == INDEX_NONE)return false;
+	//lines before the edit keep their layout, start from the line before edited line, because edit can pull words back to previous wrapped line.
+	//a line break by wrap start layout from it's first char, same as a new paragraph, so only that line and following lines of the paragraph need layout.
+	//except kerning, which use last char of previous line for the first char.
+	bool bKerningAcrossLine = this->useKerning && this->font->HasKerning();
+	if (!bKerningAcrossLine && editLineIndex != INDEX_NONE && editLineIndex - 1 > startLineIndex)
+	{
+		startLineIndex = editLineIndex - 1;
+		paragraphStartCharIndex = cacheLinePropertyArray[startLineIndex].caretPropertyList[0].charIndex;
+	}
+	if (startLineIndex == 0 && endLineIndex == cacheLinePropertyArray.Num())return false;//all lines need layout, just layout again
+	//chars and geometry of edited paragraphs, line break char have no geometry
+	auto GetCharIndex = [](const FUITextCharProperty& Item) { return Item.CharIndex; };
+	int32 startCharPropertyIndex = Algo::LowerBoundBy(cacheCharPropertyArray, paragraphStartCharIndex, GetCharIndex);
+	int32 endCharPropertyIndex = Algo::LowerBoundBy(cacheCharPropertyArray, paragraphEndCharIndex, GetCharIndex);
+	auto GetGeometryStartIndex = [&](int32 InCharPropertyIndex, int32& OutVertIndex, int32& OutTriangleIndex) {
+		if (InCharPropertyIndex < cacheCharPropertyArray.Num())
+		{
+			auto& charProperty = cacheCharPropertyArray[InCharPropertyIndex];
+			OutVertIndex = charProperty.StartVertIndex;
+			OutTriangleIndex = charProperty.StartTriangleIndex;
+		}
+		else if (cacheCharPropertyArray.Num() > 0)
+		{
+			auto& charProperty = cacheCharPropertyArray.Last();
+			OutVertIndex = charProperty.StartVertIndex + charProperty.VertCount;
+			OutTriangleIndex = charProperty.StartTriangleIndex + charProperty.IndicesCount;
+		}
+		else
+		{
+			OutVertIndex = OutTriangleIndex = 0;
+		}
+	};
+	int32 startVertIndex, startTriangleIndex, endVertIndex, endTriangleIndex, geometryVertCount, geometryTriangleCount;
+	GetGeometryStartIndex(startCharPropertyIndex, startVertIndex, startTriangleIndex);
+	GetGeometryStartIndex(endCharPropertyIndex, endVertIndex, endTriangleIndex);
+	GetGeometryStartIndex(cacheCharPropertyArray.Num(), geometryVertCount, geometryTriangleCount);
+	//geometry must only contains chars
+	if (geometryVertCount != InGeo->vertices.Num() || geometryVertCount != InGeo->originVertices.Num() || geometryTriangleCount != InGeo->triangles.Num())return false;
+
+	//layout edited paragraphs
+	FString paragraphContent = this->content.Mid(paragraphStartCharIndex, InStartCharIndex - paragraphStartCharIndex);
+	paragraphContent.Append(InInsertContent);
+	paragraphContent.Append(*this->content + removeEndCharIndex, paragraphEndCharIndex - removeEndCharIndex);
+	UIGeometry paragraphGeo;
+	FVector2f paragraphRealSize;
+	TArray<FUITextLineProperty> paragraphLinePropertyArray;
+	TArray<FUITextCharProperty> paragraphCharPropertyArray;
+	TArray<FUIText_RichTextCustomTag> paragraphRichTextCustomTagArray;
+	TArray<FUIText_RichTextImageTag> paragraphRichTextImageTagArray;
+	UIGeometry::UpdateUIText(
+		paragraphContent
+		, UUIText::VisibleCharCountInString(paragraphContent)
+		, this->width
+		, this->height
+		, this->pivot
+		, this->color
+		, this->fontSpace
+		, &paragraphGeo
+		, this->fontSize
+		, this->paragraphHAlign
+		, this->paragraphVAlign
+		, this->overflowType
+		, this->maxHorizontalWidth
+		, this->useKerning
+		, this->fontStyle
+		, paragraphRealSize
+		, RenderCanvas
+		, this->UIText.Get()
+		, paragraphLinePropertyArray
+		, paragraphCharPropertyArray
+		, paragraphRichTextCustomTagArray
+		, paragraphRichTextImageTagArray
+		, this->font.Get()
+		, false
+		, this->richTextFilterFlags
+	);
+	if (paragraphLinePropertyArray.Num() == 0 || paragraphLinePropertyArray[0].caretPropertyList.Num() == 0)return false;
+
+	//paragraphs is layout from top, move it to the origin paragraph's line. none rich text have same line height, so following lines only move by line count change
+	float paragraphOffsetY = cacheLinePropertyArray[startLineIndex].caretPropertyList[0].caretPosition.Y - paragraphLinePropertyArray[0].caretPropertyList[0].caretPosition.Y;
+	int32 paragraphLineCount = paragraphLinePropertyArray.Num();
+	int32 lineCountDelta = paragraphLineCount - (endLineIndex - startLineIndex);
+	float lineHeight = this->font->GetLineHeight(this->fontSize) + this->fontSpace.Y;
+	float followingOffsetY = -lineCountDelta * lineHeight;
+	int32 charCountDelta = InInsertContent.Len() - InRemoveCharCount;
+	int32 vertCountDelta = paragraphGeo.vertices.Num() - (endVertIndex - startVertIndex);
+	int32 triangleCountDelta = paragraphGeo.triangles.Num() - (endTriangleIndex - startTriangleIndex);
+
+	//replace geometry of edited paragraphs, and move following geometry
+	UIGeometry::OffsetVertices(paragraphGeo.originVertices, paragraphGeo.originVertices.Num(), 0, paragraphOffsetY);
+	InGeo->originVertices.RemoveAt(startVertIndex, endVertIndex - startVertIndex, false);
+	InGeo->originVertices.Insert(paragraphGeo.originVertices, startVertIndex);
+	InGeo->vertices.RemoveAt(startVertIndex, endVertIndex - startVertIndex, false);
+	InGeo->vertices.Insert(paragraphGeo.vertices, startVertIndex);
+	if (followingOffsetY != 0)
+	{
+		for (int i = startVertIndex + paragraphGeo.originVertices.Num(); i < InGeo->originVertices.Num(); i++)
+		{
+			InGeo->originVertices[i].Position.Z += followingOffsetY;
+		}
+	}
+	InGeo->triangles.RemoveAt(startTriangleIndex, endTriangleIndex - startTriangleIndex, false);
+	if (vertCountDelta != 0)
+	{
+		for (int i = startTriangleIndex; i < InGeo->triangles.Num(); i++)
+		{
+			InGeo->triangles[i] += vertCountDelta;
+		}
+	}
+	for (auto& triangleIndex : paragraphGeo.triangles)
+	{
+		triangleIndex += startVertIndex;
+	}
+	InGeo->triangles.Insert(paragraphGeo.triangles, startTriangleIndex);
+
+	//replace lines and chars of edited paragraphs, and offset following ones
+	cacheLinePropertyArray.RemoveAt(startLineIndex, endLineIndex - startLineIndex, false);
+	for (int i = startLineIndex; i < cacheLinePropertyArray.Num(); i++)
+	{
+		for (auto& caretProperty : cacheLinePropertyArray[i].caretPropertyList)
+		{
+			caretProperty.caretPosition.Y += followingOffsetY;
+			if (caretProperty.charIndex != -1)
+			{
+				caretProperty.charIndex += charCountDelta;
+			}
+		}
+	}
+	for (auto& lineProperty : paragraphLinePropertyArray)
+	{
+		for (auto& caretProperty : lineProperty.caretPropertyList)
+		{
+			caretProperty.caretPosition.Y += paragraphOffsetY;
+			if (caretProperty.charIndex != -1)
+			{
+				caretProperty.charIndex += paragraphStartCharIndex;
+			}
+		}
+	}
+	cacheLinePropertyArray.Insert(MoveTemp(paragraphLinePropertyArray), startLineIndex);
+	cacheCharPropertyArray.RemoveAt(startCharPropertyIndex, endCharPropertyIndex - startCharPropertyIndex, false);
+	for (int i = startCharPropertyIndex; i < cacheCharPropertyArray.Num(); i++)
+	{
+		auto& charProperty = cacheCharPropertyArray[i];
+		charProperty.CharIndex += charCountDelta;
+		charProperty.StartVertIndex += vertCountDelta;
+		charProperty.StartTriangleIndex += triangleCountDelta;
+	}
+	for (auto& charProperty : paragraphCharPropertyArray)
+	{
+		charProperty.CharIndex += paragraphStartCharIndex;
+		charProperty.StartVertIndex += startVertIndex;
+		charProperty.StartTriangleIndex += startTriangleIndex;
+	}
+	cacheCharPropertyArray.Insert(paragraphCharPropertyArray, startCharPropertyIndex);
+
+	if (paragraphRealSize.X >= textRealSize.X)
+	{
+		textRealSize.X = paragraphRealSize.X;
+	}
+	else//edited paragraphs could be the widest one, check other lines. caret span of a line is line width plus one font space
+	{
+		float maxLineWidth = paragraphRealSize.X;
+		for (int i = 0; i < cacheLinePropertyArray.Num(); i++)
+		{
+			if (i == startLineIndex)
+			{
+				i += paragraphLineCount - 1;
+				continue;
+			}
+			auto& caretList = cacheLinePropertyArray[i].caretPropertyList;
+			if (caretList.Num() == 0)continue;
+			maxLineWidth = FMath::Max(maxLineWidth, caretList.Last().caretPosition.X - caretList[0].caretPosition.X - this->fontSpace.X);
+		}
+		textRealSize.X = maxLineWidth;
+	}
+	textRealSize.Y += lineCountDelta * lineHeight;
+
+	this->content.RemoveAt(InStartCharIndex, InRemoveCharCount, false);
+	this->content.InsertAt(InStartCharIndex, InInsertContent);
+	this->visibleCharCount += InVisibleCharCountDelta;
+	return true;
+}
+
+bool FTextGeometryCache::PrepareDigitTemplate()
+{
+	if (bDigitTemplateValid)return true;
+	auto RenderCanvas = this->UIText->GetRenderCanvas();
+	if (RenderCanvas == nullptr)return false;
+	if (!digitTemplateGeometry.IsValid())
+	{
+		digitTemplateGeometry = MakeShared<UIGeometry>();
+	}
+	//last '0' is for the advance of '9'
+	static const FString DigitTemplateContent = TEXT("01234567890");
+	FVector2f templateRealSize;
+	TArray<FUITextLineProperty> templateLinePropertyArray;
+	TArray<FUITextCharProperty> templateCharPropertyArray;
+	TArray<FUIText_RichTextCustomTag> templateRichTextCustomTagArray;
+	TArray<FUIText_RichTextImageTag> templateRichTextImageTagArray;
+	//new glyph may scale up font texture during layout, and glyph before that will have wrong uv, so layout again
+	for (int tryCount = 0; tryCount < 2; tryCount++)
+	{
+		auto prevFontTextureScaleUpCount = fontTextureScaleUpCount;
+		UIGeometry::UpdateUIText(
+			DigitTemplateContent
+			, DigitTemplateContent.Len()
+			, this->width
+			, this->height
+			, this->pivot
+			, this->color
+			, this->fontSpace
+			, digitTemplateGeometry.Get()
+			, this->fontSize
+			, EUITextParagraphHorizontalAlign::Left
+			, EUITextParagraphVerticalAlign::Top
+			, EUITextOverflowType::HorizontalOverflow
+			, this->maxHorizontalWidth
+			, this->useKerning
+			, this->fontStyle
+			, templateRealSize
+			, RenderCanvas
+			, this->UIText.Get()
+			, templateLinePropertyArray
+			, templateCharPropertyArray
+			, templateRichTextCustomTagArray
+			, templateRichTextImageTagArray
+			, this->font.Get()
+			, false
+			, 0
+		);
+		if (prevFontTextureScaleUpCount == fontTextureScaleUpCount)break;
+	}
+	if (templateLinePropertyArray.Num() != 1 || templateCharPropertyArray.Num() != DigitTemplateContent.Len())return false;
+	auto& caretList = templateLinePropertyArray[0].caretPropertyList;
+	if (caretList.Num() < DigitTemplateContent.Len())return false;
+	for (int i = 0; i < 10; i++)
+	{
+		digitTemplateCharProperty[i] = templateCharPropertyArray[i];
+		digitTemplateCaretPosition[i] = caretList[i].caretPosition;
+		digitTemplateXAdvance[i] = caretList[i + 1].caretPosition.X - caretList[i].caretPosition.X;
+	}
+	bDigitTemplateValid = true;
+	return true;
+}
+
+bool FTextGeometryCache::ReplaceDigits(const TCHAR* InContent, int32 InLength, UIGeometry* InGeo, bool& OutAnyChanged)
+{
+	OutAnyChanged = false;
+	if (bIsDirty || bIsRestoreDirty)return false;
+	if (fullGeometry.IsValid() || revealCharCount >= 0)return false;
+	if (this->richText)return false;
+	if (this->overflowType == EUITextOverflowType::ClampContent)return false;//clamped chars are hidden by zero position
+	if (InLength != this->content.Len())return false;
+	if (!this->font.IsValid() || !this->UIText.IsValid())return false;
+	auto RenderCanvas = this->UIText->GetRenderCanvas();
+	if (RenderCanvas == nullptr)return false;
+	if (this->UIText->GetShouldAffectByPixelPerfect() && RenderCanvas->GetActualPixelPerfect() && !RenderCanvas->GetRootCanvas()->IsRenderToWorldSpace())return false;//pixel perfect snap every vertex
+	bool bFixedWidthDigit = this->UIText->GetFixedWidthDigit();
+	if (!bFixedWidthDigit && this->useKerning && this->font->HasKerning())return false;//kerning make digit's advance depend on neighbour char
+
+	const TCHAR* contentPtr = *this->content;
+	int32 changedCount = 0;
+	for (int i = 0; i < InLength; i++)
+	{
+		auto oldChar = contentPtr[i], newChar = InContent[i];
+		if (oldChar == newChar)continue;
+		if (oldChar < '0' || oldChar > '9' || newChar < '0' || newChar > '9')return false;//only digit can change
+		changedCount++;
+	}
+	if (changedCount == 0)return true;
+	if (!PrepareDigitTemplate())return false;
+
+	//verify before modify geometry
+	int32 foundCount = 0;
+	for (auto& charProperty : cacheCharPropertyArray)
+	{
+		auto charIndex = charProperty.CharIndex;
+		if (charIndex < 0 || charIndex >= InLength || contentPtr[charIndex] == InContent[charIndex])continue;
+		auto& oldDigitProperty = digitTemplateCharProperty[contentPtr[charIndex] - '0'];
+		auto& newDigitProperty = digitTemplateCharProperty[InContent[charIndex] - '0'];
+		if (charProperty.VertCount != oldDigitProperty.VertCount || charProperty.VertCount != newDigitProperty.VertCount)return false;
+		if (charProperty.StartVertIndex + charProperty.VertCount > InGeo->vertices.Num())return false;
+		if (!bFixedWidthDigit && digitTemplateXAdvance[contentPtr[charIndex] - '0'] != digitTemplateXAdvance[InContent[charIndex] - '0'])return false;//advance change will move following chars
+		foundCount++;
+	}
+	if (foundCount != changedCount)return false;
+
+	//glyph's position relative to caret is same at any place, so move vertices by the difference between two digits
+	auto& templateOriginVertices = digitTemplateGeometry->originVertices;
+	auto& templateVertices = digitTemplateGeometry->vertices;
+	auto& originVertices = InGeo->originVertices;
+	auto& vertices = InGeo->vertices;
+	for (auto& charProperty : cacheCharPropertyArray)
+	{
+		auto charIndex = charProperty.CharIndex;
+		if (charIndex < 0 || charIndex >= InLength || contentPtr[charIndex] == InContent[charIndex])continue;
+		int oldDigit = contentPtr[charIndex] - '0', newDigit = InContent[charIndex] - '0';
+		auto& oldDigitProperty = digitTemplateCharProperty[oldDigit];
+		auto& newDigitProperty = digitTemplateCharProperty[newDigit];
+		auto oldCaret = digitTemplateCaretPosition[oldDigit];
+		auto newCaret = digitTemplateCaretPosition[newDigit];
+		for (int i = 0; i < charProperty.VertCount; i++)
+		{
+			auto& oldTemplatePosition = templateOriginVertices[oldDigitProperty.StartVertIndex + i].Position;
+			auto& newTemplatePosition = templateOriginVertices[newDigitProperty.StartVertIndex + i].Position;
+			auto& position = originVertices[charProperty.StartVertIndex + i].Position;
+			position.Y += (newTemplatePosition.Y - newCaret.X) - (oldTemplatePosition.Y - oldCaret.X);
+			position.Z += (newTemplatePosition.Z - newCaret.Y) - (oldTemplatePosition.Z - oldCaret.Y);
+			vertices[charProperty.StartVertIndex + i].TextureCoordinate[0] = templateVertices[newDigitProperty.StartVertIndex + i].TextureCoordinate[0];
+		}
+		this->content[charIndex] = InContent[charIndex];
+	}
+	OutAnyChanged = true;
+	return true;
+}
+
 void FTextGeometryCache::ConditaionalCalculateGeometry()
 {
-	if (bIsColorDirty && !bIsDirty)
+	if (bIsRestoreDirty && !bIsDirty)
+	{
+		bIsRestoreDirty = false;
+		if (bIsColorDirty)
+		{
+			bIsColorDirty = false;
+			UIGeometry::UpdateUIColor(fullGeometry.Get(), this->color);
+		}
+		auto UIGeo = GetGeometry();
+		fullGeometry->CopyTo(UIGeo);
+		revealIndicesCount = GetRevealIndicesCount();
+		UIGeo->triangles.SetNum(revealIndicesCount, false);
+		if (revealCharCount < 0)//reveal is not used anymore
+		{
+			fullGeometry.Reset();
+			revealIndicesCount = -1;
+		}
+	}
+	else if (bIsColorDirty && !bIsDirty)
 	{
 		bIsColorDirty = false;
-		UIGeometry::UpdateUIColor(this->UIText->GetGeometry(), this->color);
+		UIGeometry::UpdateUIColor(GetGeometry(), this->color);
+		if (fullGeometry.IsValid())
+		{
+			UIGeometry::UpdateUIColor(fullGeometry.Get(), this->color);
+		}
 	}
 	else if (bIsDirty)
 	{
 		if (!this->UIText->GetRenderCanvas())return;
+		if (!this->font.IsValid())return;
 		bIsDirty = false;
 		bIsColorDirty = false;
+		bIsRestoreDirty = false;
+		bDigitTemplateValid = false;//layout parameters may change
+
+		using namespace LGUITextGeometrySharedCache;
+		auto UIGeo = GetGeometry();
+		bool bUseSharedCache = CanUseSharedCache();
+		FKey Key;
+		if (bUseSharedCache)
+		{
+			auto RenderCanvas = this->UIText->GetRenderCanvas();
+			auto RootCanvas = RenderCanvas->GetRootCanvas();
+			Key.Content = this->content;
+			Key.VisibleCharCount = this->visibleCharCount;
+			Key.Width = this->width;
+			Key.Height = this->height;
+			Key.Pivot = this->pivot;
+			Key.Color = this->richText ? this->color : FColor::White;
+			Key.FontSpace = this->fontSpace;
+			Key.FontSize = this->fontSize;
+			Key.MaxHorizontalWidth = this->maxHorizontalWidth;
+			Key.ParagraphHAlign = this->paragraphHAlign;
+			Key.ParagraphVAlign = this->paragraphVAlign;
+			Key.OverflowType = this->overflowType;
+			Key.FontStyle = this->fontStyle;
+			Key.bUseKerning = this->useKerning;
+			Key.bFixedWidthDigit = this->UIText->GetFixedWidthDigit();
+			Key.bRichText = this->richText;
+			Key.RichTextFilterFlags = this->richText ? this->richTextFilterFlags : 0;
+			Key.Font = FObjectKey(this->font.Get());
+			Key.RichTextCustomStyleData = FObjectKey(this->richText ? this->UIText->GetRichTextCustomStyleData() : nullptr);
+			Key.RootCanvasScale = RootCanvas->GetCanvasScale();
+			Key.DynamicPixelsPerUnit = RenderCanvas->GetActualDynamicPixelsPerUnit();
+			Key.bWorldSpace = RootCanvas->IsRenderToWorldSpace();
+			Key.bRequireNormalOrTangent = RenderCanvas->GetRequireNormal() || RenderCanvas->GetRequireTangent();
+			Key.bRequireUV1 = RenderCanvas->GetRequireUV1();
+			Key.CalculateHash();
+
+			if (auto EntryPtr = GetCache().FindAndTouch(Key))
+			{
+				auto& Entry = **EntryPtr;
+				UIGeo->originVertices = Entry.OriginVertices;
+				UIGeo->vertices = Entry.Vertices;
+				UIGeo->triangles = Entry.Triangles;
+				this->textRealSize = Entry.TextRealSize;
+				this->cacheLinePropertyArray = Entry.LinePropertyArray;
+				this->cacheCharPropertyArray = Entry.CharPropertyArray;
+				this->cacheRichTextCustomTagArray = Entry.RichTextCustomTagArray;
+				this->cacheRichTextImageTagArray = Entry.RichTextImageTagArray;
+				if (!this->richText)
+				{
+					UIGeometry::UpdateUIColor(UIGeo, this->color);
+				}
+				HitCount++;
+				INC_DWORD_STAT(STAT_TextGeometrySharedCacheHit);
+				OnFullGeometryReady(UIGeo);
+				this->UIText->GenerateRichTextImageObject();
+				return;
+			}
+			MissCount++;
+			INC_DWORD_STAT(STAT_TextGeometrySharedCacheMiss);
+		}
+
 		UIGeometry::UpdateUIText(
 			this->content
 			, this->visibleCharCount
@@ -151,9 +1050,8 @@ void FTextGeometryCache::ConditaionalCalculateGeometry()
 			, this->height
 			, this->pivot
 			, this->color
-			, (uint8)(this->canvasGroupAlpha * 255)
 			, this->fontSpace
-			, this->UIText->GetGeometry()
+			, UIGeo
 			, this->fontSize
 			, this->paragraphHAlign
 			, this->paragraphVAlign
@@ -172,7 +1070,411 @@ void FTextGeometryCache::ConditaionalCalculateGeometry()
 			, this->richText
 			, this->richTextFilterFlags
 			);
-		this->UIText->GenerateRichTextImageObject();
+
+		if (bUseSharedCache)
+		{
+			auto Entry = MakeShared<FEntry>();
+			Entry->OriginVertices = UIGeo->originVertices;
+			Entry->Vertices = UIGeo->vertices;
+			Entry->Triangles = UIGeo->triangles;
+			Entry->TextRealSize = this->textRealSize;
+			Entry->LinePropertyArray = this->cacheLinePropertyArray;
+			Entry->CharPropertyArray = this->cacheCharPropertyArray;
+			Entry->RichTextCustomTagArray = this->cacheRichTextCustomTagArray;
+			Entry->RichTextImageTagArray = this->cacheRichTextImageTagArray;
+			Entry->MemorySize = sizeof(FEntry) + Key.Content.GetAllocatedSize()
+				+ Entry->OriginVertices.GetAllocatedSize() + Entry->Vertices.GetAllocatedSize() + Entry->Triangles.GetAllocatedSize()
+				+ Entry->LinePropertyArray.GetAllocatedSize() + Entry->CharPropertyArray.GetAllocatedSize()
+				+ Entry->RichTextCustomTagArray.GetAllocatedSize() + Entry->RichTextImageTagArray.GetAllocatedSize();
+			Add(Key, Entry);
+		}
+		OnFullGeometryReady(UIGeo);
+		if (!layoutOnlyGeometry.IsValid())
+		{
+			this->UIText->GenerateRichTextImageObject();
+		}
+	}
+}
+
+#pragma region UITextInputComponent
+bool FTextGeometryCache::MoveCaret(int32 moveType, int32& inOutCaretPositionIndex, int32& inOutCaretPositionLineIndex, FVector2f& inOutCaretPosition)const
+{
+	auto originCaretPositionIndex = inOutCaretPositionIndex;
+	auto originCaretPositionLineIndex = inOutCaretPositionLineIndex;
+
+	//moveType 0-left, 1-right, 2-up, 3-down, 4-start, 5-end
+	switch (moveType)
+	{
+	case 0:
+	case 1:
+	{
+		if (moveType == 0)
+		{
+			if (inOutCaretPositionIndex > 0)
+			{
+				inOutCaretPositionIndex--;
+			}
+		}
+		else
+		{
+			inOutCaretPositionIndex++;
+		}
+
+		bool foundCaret = false;
+		int totalCaretIndex = 0;
+		for (int lineIndex = 0; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
+		{
+			auto& lineProperty = cacheLinePropertyArray[lineIndex];
+			for (int caretIndex = 0; caretIndex < lineProperty.caretPropertyList.Num(); caretIndex++)
+			{
+				if (totalCaretIndex == inOutCaretPositionIndex)//find caret
+				{
+					inOutCaretPositionLineIndex = lineIndex;
+					inOutCaretPosition = lineProperty.caretPropertyList[caretIndex].caretPosition;
+					//stop loop
+					foundCaret = true;
+					caretIndex = lineProperty.caretPropertyList.Num();
+					lineIndex = cacheLinePropertyArray.Num();
+				}
+				else
+				{
+					totalCaretIndex++;
+				}
+			}
+		}
+		if (!foundCaret)//could be out of range, use last caret
+		{
+			inOutCaretPositionIndex = totalCaretIndex - 1;
+			inOutCaretPositionLineIndex = cacheLinePropertyArray.Num() - 1;
+			auto& lastLineProperty = cacheLinePropertyArray[cacheLinePropertyArray.Num() - 1];
+			inOutCaretPosition = lastLineProperty.caretPropertyList[lastLineProperty.caretPropertyList.Num() - 1].caretPosition;
+		}
+	}
+	break;
+	case 2:
+	case 3:
+	{
+		if (moveType == 2)
+		{
+			if (inOutCaretPositionLineIndex > 0)
+			{
+				inOutCaretPositionLineIndex--;
+			}
+		}
+		else
+		{
+			if (inOutCaretPositionLineIndex < cacheLinePropertyArray.Num() - 1)
+			{
+				inOutCaretPositionLineIndex++;
+			}
+		}
+		auto& lineProperty = cacheLinePropertyArray[inOutCaretPositionLineIndex];
+		float minDistance = MAX_FLT;
+		int accumulatedCaretIndex = 0;
+		for (int lineIndex = 0; lineIndex < inOutCaretPositionLineIndex; lineIndex++)
+		{
+			accumulatedCaretIndex += cacheLinePropertyArray[lineIndex].caretPropertyList.Num();
+		}
+		auto originCaretPosition = inOutCaretPosition;
+		for (int caretIndex = 0; caretIndex < lineProperty.caretPropertyList.Num(); caretIndex++)
+		{
+			auto& caretProperty = lineProperty.caretPropertyList[caretIndex];
+			auto distance = FMath::Abs(originCaretPosition.X - caretProperty.caretPosition.X);
+			if (distance < minDistance)
+			{
+				minDistance = distance;
+				inOutCaretPositionIndex = accumulatedCaretIndex;
+				inOutCaretPosition = caretProperty.caretPosition;
+			}
+			else//found min distance at prev
+			{
+				break;
+			}
+			accumulatedCaretIndex++;
+		}
+	}
+	break;
+	case 4:
+	{
+		inOutCaretPositionIndex = 0;
+		inOutCaretPositionLineIndex = 0;
+		inOutCaretPosition = cacheLinePropertyArray[0].caretPropertyList[0].caretPosition;
+	}
+	break;
+	case 5:
+	{
+		int32 accumulatedCaretIndex = 0;
+		for (int lineIndex = 0; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
+		{
+			accumulatedCaretIndex += cacheLinePropertyArray[lineIndex].caretPropertyList.Num();
+		}
+		inOutCaretPositionIndex = accumulatedCaretIndex - 1;
+		inOutCaretPositionLineIndex = cacheLinePropertyArray.Num() - 1;
+		auto& lastLineProperty = cacheLinePropertyArray[cacheLinePropertyArray.Num() - 1];
+		inOutCaretPosition = lastLineProperty.caretPropertyList[lastLineProperty.caretPropertyList.Num() - 1].caretPosition;
+	}
+	break;
+	}
+	if (originCaretPositionIndex != inOutCaretPositionIndex || originCaretPositionLineIndex != inOutCaretPositionLineIndex)
+	{
+		return true;
+	}
+	return false;
+}
+
+int FTextGeometryCache::GetCharIndexByCaretIndex(int32 inCaretPositionIndex)const
+{
+	int accumulatedCaretIndex = 0;
+	for (int lineIndex = 0; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
+	{
+		auto& lineProperty = cacheLinePropertyArray[lineIndex];
+		for (int caretIndex = 0; caretIndex < lineProperty.caretPropertyList.Num(); caretIndex++)
+		{
+			if (accumulatedCaretIndex == inCaretPositionIndex)//find caret
+			{
+				return lineProperty.caretPropertyList[caretIndex].charIndex;
+			}
+			accumulatedCaretIndex++;
+		}
+	}
+	//not found caret, use last one
+	auto& lastLineProperty = cacheLinePropertyArray[cacheLinePropertyArray.Num() - 1];
+	return lastLineProperty.caretPropertyList[lastLineProperty.caretPropertyList.Num() - 1].charIndex;
+}
+int FTextGeometryCache::GetLastCaret()const
+{
+	int totalCaretIndex = 0;
+	for (int lineIndex = 0; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
+	{
+		auto& lineProperty = cacheLinePropertyArray[lineIndex];
+		totalCaretIndex += lineProperty.caretPropertyList.Num();
+	}
+	return totalCaretIndex - 1;
+}
+int FTextGeometryCache::GetCaretIndexByCharIndex(int32 inCharIndex)const
+{
+	int accumulatedCaretIndex = 0;
+	for (int lineIndex = 0; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
+	{
+		auto& lineProperty = cacheLinePropertyArray[lineIndex];
+		for (int caretIndex = 0; caretIndex < lineProperty.caretPropertyList.Num(); caretIndex++)
+		{
+			if (lineProperty.caretPropertyList[caretIndex].charIndex == inCharIndex)//find char
+			{
+				return accumulatedCaretIndex;
+			}
+			else
+			{
+				accumulatedCaretIndex++;
+			}
+		}
+	}
+	return accumulatedCaretIndex - 1;//not found, return last one
+}
+
+bool FTextGeometryCache::GetVisibleCharRangeForMultiLine(int32& inOutCaretPositionIndex, int32& inOutCaretPositionLineIndex, int32& inOutVisibleCaretStartLineIndex, int32& inOutVisibleCaretStartIndex, int inMaxLineCount, int32& outVisibleCharStartIndex, int32& outVisibleCharCount)const
+{
+	int accumulatedCaretIndex = 0;
+	bool foundCaret = false;
+	for (int lineIndex = 0; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
+	{
+		auto& lineProperty = cacheLinePropertyArray[lineIndex];
+		for (int caretIndex = 0; caretIndex < lineProperty.caretPropertyList.Num(); caretIndex++)
+		{
+			if (inOutCaretPositionIndex == accumulatedCaretIndex)//find caret
+			{
+				inOutCaretPositionLineIndex = lineIndex;
+				lineIndex = cacheLinePropertyArray.Num();
+				foundCaret = true;
+				break;
+			}
+			else
+			{
+				accumulatedCaretIndex++;
+			}
+		}
+	}
+	if (!foundCaret)//could be last caret
+	{
+		inOutCaretPositionLineIndex = cacheLinePropertyArray.Num() - 1;
+	}
+
+	inOutCaretPositionLineIndex = FMath::Clamp(inOutCaretPositionLineIndex, 0, cacheLinePropertyArray.Num() - 1);
+
+	if (inOutVisibleCaretStartLineIndex > inOutCaretPositionLineIndex)
+	{
+		inOutVisibleCaretStartLineIndex = inOutCaretPositionLineIndex;
+	}
+	if (inOutVisibleCaretStartLineIndex + (inMaxLineCount - 1) < inOutCaretPositionLineIndex)
+	{
+		inOutVisibleCaretStartLineIndex = inOutCaretPositionLineIndex - (inMaxLineCount - 1);
+	}
+
+	int calculatedLineCount = 0;
+	bool outOfRange = false;
+	int VisibleCaretEndLineIndex = inOutCaretPositionLineIndex;
+	//check from CaretLineIndex to VisibleCaretStartLineIndex
+	for (int lineIndex = inOutCaretPositionLineIndex; lineIndex >= 0 && lineIndex >= inOutVisibleCaretStartLineIndex; lineIndex--)
+	{
+		auto& lineProperty = cacheLinePropertyArray[lineIndex];
+		calculatedLineCount++;
+		if (calculatedLineCount >= inMaxLineCount)
+		{
+			outOfRange = true;
+			inOutVisibleCaretStartLineIndex = lineIndex;
+			break;
+		}
+	}
+	if (!outOfRange)
+	{
+		//check from CaretLineIndex to bottom end
+		for (int lineIndex = inOutCaretPositionLineIndex + 1; lineIndex < cacheLinePropertyArray.Num(); lineIndex++)
+		{
+			auto& lineProperty = cacheLinePropertyArray[lineIndex];
+			calculatedLineCount++;
+			VisibleCaretEndLineIndex++;
+			if (calculatedLineCount >= inMaxLineCount)
+			{
+				outOfRange = true;
+				break;
+			}
+		}
+
+		if (!outOfRange)
+		{
+			//check from VisibleCaretStartLineIndex to top
+			for (int lineIndex = inOutVisibleCaretStartLineIndex - 1; lineIndex >= 0 && lineIndex < cacheLinePropertyArray.Num(); lineIndex--)
+			{
+				auto& lineProperty = cacheLinePropertyArray[lineIndex];
+				calculatedLineCount++;
+				if (calculatedLineCount >= inMaxLineCount)
+				{
+					outOfRange = true;
+					break;
+				}
+				inOutVisibleCaretStartLineIndex--;
+			}
+		}
+	}
+	inOutVisibleCaretStartIndex = 0;
+	for (int lineIndex = 0; lineIndex < inOutVisibleCaretStartLineIndex; lineIndex++)
+	{
+		auto& lineProperty = cacheLinePropertyArray[lineIndex];
+		inOutVisibleCaretStartIndex += lineProperty.caretPropertyList.Num();
+	}
+	auto& startLineProperty = cacheLinePropertyArray[inOutVisibleCaretStartLineIndex];
+	auto& endLineProperty = cacheLinePropertyArray[VisibleCaretEndLineIndex];
+	outVisibleCharStartIndex = startLineProperty.caretPropertyList[0].charIndex;
+	auto lastIndex = endLineProperty.caretPropertyList.Num() - 1;
+	auto lastCharIndex = endLineProperty.caretPropertyList[lastIndex].charIndex;
+	if (lastCharIndex == -1)//-1 means newline break, so use next caret's char index
+	{
+		lastCharIndex = endLineProperty.caretPropertyList[lastIndex - 1].charIndex + 1;
+	}
+	outVisibleCharCount = lastCharIndex - outVisibleCharStartIndex;
+	return outOfRange;
+}
+
+bool FTextGeometryCache::GetVisibleCharRangeForSingleLine(int32& inOutCaretPositionIndex, int32& inOutVisibleCaretStartIndex, float inMaxWidth, int32& outVisibleCharStartIndex, int32& outVisibleCharCount)const
+{
+	auto& lineProperty = cacheLinePropertyArray[0];//just single line
+	inOutCaretPositionIndex = FMath::Clamp(inOutCaretPositionIndex, 0, lineProperty.caretPropertyList.Num() - 1);
+
+	if (inOutVisibleCaretStartIndex > inOutCaretPositionIndex)
+	{
+		inOutVisibleCaretStartIndex = inOutCaretPositionIndex;
 	}
+
+	float calculatedSize = 0;
+	bool outOfRange = false;
+	int VisibleCaretEndIndex = inOutCaretPositionIndex;
+	auto caretPosition = lineProperty.caretPropertyList[inOutCaretPositionIndex].caretPosition;
+	//check from caret to VisibleCaretStartIndex
+	for (int caretIndex = inOutCaretPositionIndex; caretIndex >= 0 && caretIndex >= inOutVisibleCaretStartIndex; caretIndex--)
+	{
+		auto& caretProperty = lineProperty.caretPropertyList[caretIndex];
+		calculatedSize = caretPosition.X - caretProperty.caretPosition.X;
+		if (calculatedSize >= inMaxWidth)
+		{
+			outOfRange = true;
+			inOutVisibleCaretStartIndex = caretIndex + 1;
+			break;
+		}
+	}
+	if (!outOfRange)
+	{
+		//check from caret to right end
+		float tempWidth = calculatedSize;
+		for (int caretIndex = inOutCaretPositionIndex; caretIndex < lineProperty.caretPropertyList.Num(); caretIndex++)
+		{
+			auto& caretProperty = lineProperty.caretPropertyList[caretIndex];
+			auto dist = caretProperty.caretPosition.X - caretPosition.X;
+			tempWidth = calculatedSize + dist;
+			if (tempWidth > inMaxWidth)
+			{
+				outOfRange = true;
+				break;
+			}
+			VisibleCaretEndIndex++;
+		}
+		VisibleCaretEndIndex--;
+		calculatedSize = tempWidth;
+
+		if (!outOfRange)
+		{
+			//check from VisibleCaretStartIndex to left
+			for (int caretIndex = inOutVisibleCaretStartIndex - 1; caretIndex >= 0; caretIndex--)
+			{
+				auto& caretProperty = lineProperty.caretPropertyList[caretIndex];
+				auto dist = caretPosition.X - caretProperty.caretPosition.X;
+				tempWidth = calculatedSize + dist;
+				if (tempWidth >= inMaxWidth)
+				{
+					outOfRange = true;
+					break;
+				}
+				inOutVisibleCaretStartIndex--;
+			}
+			calculatedSize = tempWidth;
+		}
+	}
+	outVisibleCharStartIndex = lineProperty.caretPropertyList[inOutVisibleCaretStartIndex].charIndex;
+	outVisibleCharCount = lineProperty.caretPropertyList[VisibleCaretEndIndex].charIndex - outVisibleCharStartIndex;
+	return outOfRange;
+}
+#pragma endregion UITextInputComponent
+
+void FTextGeometrySharedCache::Clear()
+{
+	LGUITextGeometrySharedCache::Clear();
+}
+int32 FTextGeometrySharedCache::GetEntryCount()
+{
+	return LGUITextGeometrySharedCache::GetCache().Num();
+}
+int64 FTextGeometrySharedCache::GetMemorySize()
+{
+	return LGUITextGeometrySharedCache::MemorySize;
+}
+int64 FTextGeometrySharedCache::GetHitCount()
+{
+	return LGUITextGeometrySharedCache::HitCount;
+}
+int64 FTextGeometrySharedCache::GetMissCount()
+{
+	return LGUITextGeometrySharedCache::MissCount;
+}
+float FTextGeometrySharedCache::GetHitRate()
+{
+	auto Total = LGUITextGeometrySharedCache::HitCount + LGUITextGeometrySharedCache::MissCount;
+	return Total > 0 ? (float)((double)LGUITextGeometrySharedCache::HitCount / Total) : 0.0f;
+}
+void FTextGeometrySharedCache::ResetHitCount()
+{
+	LGUITextGeometrySharedCache::HitCount = 0;
+	LGUITextGeometrySharedCache::MissCount = 0;
 }
 
+#if LGUI_CAN_DISABLE_OPTIMIZATION
+UE_ENABLE_OPTIMIZATION
+#endif
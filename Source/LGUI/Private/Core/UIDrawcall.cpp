@@ -8,8 +8,23 @@
 #include "Core/ActorComponent/UIPostProcessRenderable.h"
 #include "Core/ActorComponent/UIBatchMeshRenderable.h"
 #include "Core/ActorComponent/UIDirectMeshRenderable.h"
+#include "Core/ActorComponent/UICanvasGroup.h"
 #include "Core/LGUISettings.h"
 
+/** CanvasGroup's alpha is not stored in geometry, apply it here */
+static void ApplyCanvasGroupAlpha(const UUIBatchMeshRenderable* InRenderObject, FLGUIMeshVertex* InVertices, int32 InVertexCount)
+{
+	auto CanvasGroup = InRenderObject->GetCanvasGroup();
+	if (CanvasGroup == nullptr)return;
+	const float Alpha = CanvasGroup->GetFinalAlpha();
+	if (Alpha >= 1.0f)return;
+	for (int32 i = 0; i < InVertexCount; i++)
+	{
+		auto& VertexColor = InVertices[i].Color;
+		VertexColor.A = (uint8)(VertexColor.A * Alpha);
+	}
+}
+
 void UUIDrawcall::GetCombined(TArray<FLGUIMeshVertex>& vertices, TArray<FLGUIMeshIndexBufferType>& triangles)const
 {
 	int count = RenderObjectList.Num();
@@ -18,6 +33,7 @@ void UUIDrawcall::GetCombined(TArray<FLGUIMeshVertex>& vertices, TArray<FLGUIMes
 		auto uiGeo = RenderObjectList[0]->GetGeometry();
 		vertices = uiGeo->vertices;
 		triangles = uiGeo->triangles;
+		ApplyCanvasGroupAlpha(RenderObjectList[0].Get(), vertices.GetData(), vertices.Num());
 	}
 	else
 	{
@@ -32,6 +48,7 @@ void UUIDrawcall::GetCombined(TArray<FLGUIMeshVertex>& vertices, TArray<FLGUIMes
 			int triangleCount = geomTriangles.Num();
 			if (triangleCount <= 0)continue;
 			vertices.Append(uiGeo->vertices);
+			ApplyCanvasGroupAlpha(RenderObjectList[geoIndex].Get(), vertices.GetData() + prevVertexCount, uiGeo->vertices.Num());
 			for (int geomTriangleIndicesIndex = 0; geomTriangleIndicesIndex < triangleCount; geomTriangleIndicesIndex++)
 			{
 				auto triangleIndex = geomTriangles[geomTriangleIndicesIndex] + prevVertexCount;
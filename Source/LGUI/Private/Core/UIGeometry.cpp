@@ -10,6 +10,7 @@
 #include "Core/LGUISpriteData.h"
 #include "Core/LGUIFontData_BaseObject.h"
 #include "Core/RichTextParser.h"
+#include "Core/UITextLayoutContext.h"
 
 #if LGUI_CAN_DISABLE_OPTIMIZATION
 UE_DISABLE_OPTIMIZATION
@@ -2394,7 +2395,7 @@ void UIGeometry_AlignUITextLineVertexForRichText(EUITextParagraphHorizontalAlign
 }
 #include "Core/LGUIRichTextCustomStyleData.h"
 void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float width, float height, const FVector2f& pivot
-	, const FColor& color, uint8 canvasGroupAlpha, const FVector2f& fontSpace, UIGeometry* uiGeo, float fontSize
+	, const FColor& color, const FVector2f& fontSpace, UIGeometry* uiGeo, float fontSize
 	, EUITextParagraphHorizontalAlign paragraphHAlign, EUITextParagraphVerticalAlign paragraphVAlign, EUITextOverflowType overflowType
 	, float maxHorizontalWidth, bool kerning
 	, EUITextFontStyle fontStyle, FVector2f& textRealSize
@@ -2403,7 +2404,28 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 	, TArray<FUIText_RichTextImageTag>& cacheRichTextImageTagArray
 	, ULGUIFontData_BaseObject* font, bool richText, int32 richTextFilterFlags)
 {
-	FString content = text;
+	UpdateUIText(text, visibleCharCount, width, height, pivot
+		, color, fontSpace, uiGeo, fontSize
+		, paragraphHAlign, paragraphVAlign, overflowType
+		, maxHorizontalWidth, kerning
+		, fontStyle, textRealSize
+		, renderCanvas, uiComp
+		, cacheLinePropertyArray, cacheCharPropertyArray, cacheRichTextCustomTagArray
+		, cacheRichTextImageTagArray
+		, font, richText, richTextFilterFlags
+		, FUITextLayoutContext::GetGameThreadContext());
+}
+void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float width, float height, const FVector2f& pivot
+	, const FColor& color, const FVector2f& fontSpace, UIGeometry* uiGeo, float fontSize
+	, EUITextParagraphHorizontalAlign paragraphHAlign, EUITextParagraphVerticalAlign paragraphVAlign, EUITextOverflowType overflowType
+	, float maxHorizontalWidth, bool kerning
+	, EUITextFontStyle fontStyle, FVector2f& textRealSize
+	, ULGUICanvas* renderCanvas, UUIText* uiComp
+	, TArray<FUITextLineProperty>& cacheLinePropertyArray, TArray<FUITextCharProperty>& cacheCharPropertyArray, TArray<FUIText_RichTextCustomTag>& cacheRichTextCustomTagArray
+	, TArray<FUIText_RichTextImageTag>& cacheRichTextImageTagArray
+	, ULGUIFontData_BaseObject* font, bool richText, int32 richTextFilterFlags
+	, FUITextLayoutContext& context)
+{
 
 	float maxFontSize = font->GetFontSizeLimit();
 	fontSize = FMath::Clamp(fontSize, 0.0f, maxFontSize);
@@ -2436,19 +2458,19 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 		}
 	}
 
-	font->PrepareForPushCharData(uiComp);
+	context.Prepare(font, uiComp);
 	bool useKerning = kerning && font->HasKerning();
 
 	//rich text
 	using namespace LGUIRichTextParser;
-	static RichTextParser richTextParser;
+	auto& richTextParser = context.RichTextParser;
 	RichTextParseResult richTextParseResult;
 	if (richText)
 	{
 		richTextParser.Clear();
 		bool bold = fontStyle == EUITextFontStyle::Bold || fontStyle == EUITextFontStyle::BoldAndItalic;
 		bool italic = fontStyle == EUITextFontStyle::Italic || fontStyle == EUITextFontStyle::BoldAndItalic;
-		richTextParser.Prepare(fontSize, color, canvasGroupAlpha, bold, italic, richTextFilterFlags, richTextParseResult);
+		richTextParser.Prepare(fontSize, color, bold, italic, richTextFilterFlags, richTextParseResult);
 	}
 	else
 	{
@@ -2464,7 +2486,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 	cacheCharPropertyArray.Reset();
 	cacheRichTextCustomTagArray.Reset();
 	cacheRichTextImageTagArray.Reset();
-	int contentLength = content.Len();
+	int contentLength = text.Len();
 	FVector2f currentLineOffset(0, 0);
 	float originLineHeight = font->GetLineHeight(fontSize);
 	float currentLineWidth = 0, currentLineHeight = originLineHeight, paragraphHeight = 0;//single line width, height, all line height
@@ -2572,7 +2594,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 	};
 	auto GetCharGeo = [&](TCHAR prevCharCode, TCHAR charCode, float inFontSize)
 	{
-		auto charData = font->GetCharData(charCode, inFontSize);
+		auto charData = context.GetCharData(charCode, inFontSize);
 		float calculatedCharFixedOffset = richText ? font->GetVerticalOffset(inFontSize) : verticalOffset;
 
 		auto overrideCharData = charData;
@@ -2588,7 +2610,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 				}
 				else
 				{
-					overrideCharData = font->GetCharData(charCode, inFontSize);
+					overrideCharData = context.GetCharData(charCode, inFontSize);
 
 					overrideCharData.width = overrideCharData.width * oneDivideRootCanvasScale;
 					overrideCharData.height = overrideCharData.height * oneDivideRootCanvasScale;
@@ -2607,7 +2629,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 				}
 				else
 				{
-					overrideCharData = font->GetCharData(charCode, inFontSize);
+					overrideCharData = context.GetCharData(charCode, inFontSize);
 
 					overrideCharData.width = overrideCharData.width * oneDivideDynamicPixelsPerUnit;
 					overrideCharData.height = overrideCharData.height * oneDivideDynamicPixelsPerUnit;
@@ -2626,7 +2648,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 				}
 				else
 				{
-					overrideCharData = font->GetCharData(charCode, inFontSize);
+					overrideCharData = context.GetCharData(charCode, inFontSize);
 
 					overrideCharData.width = overrideCharData.width * oneDivideRootCanvasScale;
 					overrideCharData.height = overrideCharData.height * oneDivideRootCanvasScale;
@@ -2653,8 +2675,32 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 
 		return overrideCharData;
 	};
+	//fixed width digit: all digits use the widest digit's width and no kerning, so change number will not move other chars
+	bool fixedWidthDigit = uiComp->GetFixedWidthDigit();
+	float fixedDigitFontSize = -1, fixedDigitXAdvance = 0;
+	auto IsFixedWidthDigit = [&](TCHAR charCode)
+	{
+		return fixedWidthDigit && charCode >= '0' && charCode <= '9';
+	};
+	auto GetFixedDigitXAdv = [&](float inFontSize)
+	{
+		if (fixedDigitFontSize != inFontSize)
+		{
+			fixedDigitFontSize = inFontSize;
+			fixedDigitXAdvance = 0;
+			for (TCHAR digit = '0'; digit <= '9'; digit++)
+			{
+				fixedDigitXAdvance = FMath::Max(fixedDigitXAdvance, GetCharGeo(digit, digit, inFontSize).xadvance);
+			}
+		}
+		return fixedDigitXAdvance;
+	};
 	auto GetCharGeoXAdv = [&](TCHAR prevCharCode, TCHAR charCode, const RichTextParseResult& richTextResult)
 	{
+		if (IsFixedWidthDigit(charCode))
+		{
+			return GetFixedDigitXAdv(richText ? richTextResult.size : fontSize);
+		}
 		if (IsRichTextImageSpace(charCode, richTextResult))
 		{
 			return richTextResult.size;//image use font size as width & height & xadvance
@@ -2662,7 +2708,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 		else
 		{
 			auto overrideFontSize = richText ? richTextResult.size : fontSize;
-			auto charData = font->GetCharData(charCode, overrideFontSize);
+			auto charData = context.GetCharData(charCode, overrideFontSize);
 			if (useKerning && prevCharCode != charCode)
 			{
 				auto kerning = font->GetKerning(prevCharCode, charCode, overrideFontSize);
@@ -2676,22 +2722,22 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 	};
 
 	//pre parse rich text
-	static TArray<RichTextParseResult> richTextPropertyArray;
+	auto& richTextPropertyArray = context.RichTextPropertyArray;
 	richTextPropertyArray.Reset();
 	if (richText)
 	{
-		FString richTextContent;
-		richTextContent.Reserve(content.Len());
+		auto& richTextContent = context.RichTextContent;
+		richTextContent.Reset(text.Len());
 		auto richTextCustomStyleData = uiComp->GetRichTextCustomStyleData();
 		bool useCustomStyle = IsValid(richTextCustomStyleData);
 		for (int charIndex = 0; charIndex < contentLength; charIndex++)
 		{
-			auto charCode = content[charIndex];
+			auto charCode = text[charIndex];
 			richTextParseResult.customTag = NAME_None;
 			richTextParseResult.customTagMode = CustomTagMode::None;
 			richTextParseResult.charIndex = charIndex;
 			richTextParser.ClearImageTag();
-			while (richTextParser.Parse(content, contentLength, charIndex, richTextParseResult))
+			while (richTextParser.Parse(text, contentLength, charIndex, richTextParseResult))
 			{
 				if (!richTextParseResult.imageTag.IsNone())//get image, append a blank placeholder
 				{
@@ -2702,7 +2748,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 				}
 				if (charIndex < contentLength)
 				{
-					charCode = content[charIndex];
+					charCode = text[charIndex];
 				}
 				else
 				{
@@ -2732,10 +2778,10 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 			}
 			richTextPropertyArray.Add(richTextParseResult);
 		}
-		//replace text content with parsed rich text content
-		content = richTextContent;
 		contentLength = richTextContent.Len();
 	}
+	//use parsed rich text content to layout
+	const FString& content = richText ? context.RichTextContent : text;
 
 	bool hasClampContent = false;
 	int clamp_RestVerticesCount = 0;
@@ -2783,7 +2829,18 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 			}
 		}
 		
-		auto charGeo = GetCharGeo(charIndex == 0 ? charCode : prevCharCode, charCode, richText ? richTextParseResult.size : fontSize);
+		FLGUICharData_HighPrecision charGeo;
+		if (IsFixedWidthDigit(charCode))
+		{
+			charGeo = GetCharGeo(charCode, charCode, richText ? richTextParseResult.size : fontSize);//no kerning
+			auto fixedXAdv = GetFixedDigitXAdv(richText ? richTextParseResult.size : fontSize);
+			charGeo.xoffset += (fixedXAdv - charGeo.xadvance) * 0.5f;//center in fixed width
+			charGeo.xadvance = fixedXAdv;
+		}
+		else
+		{
+			charGeo = GetCharGeo((charIndex == 0 || IsFixedWidthDigit(prevCharCode)) ? charCode : prevCharCode, charCode, richText ? richTextParseResult.size : fontSize);
+		}
 		//caret property
 		caretPosition.X = currentLineOffset.X - halfFontSpaceX;
 		caretPosition.Y = currentLineOffset.Y;
@@ -2854,7 +2911,7 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 				int additionalVerticesCount, additionalIndicesCount;
 				font->PushCharData(
 					charCode, currentLineOffset, fontSpace, charGeo,
-					richTextParseResult,
+					richTextParseResult, context.PushCharDataParams,
 					verticesCount, indicesCount,
 					additionalVerticesCount, additionalIndicesCount,
 					originVertices, vertices, triangles
@@ -2863,10 +2920,11 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 				//collect char property
 				{
 					FUITextCharProperty charProperty;
+					charProperty.CharIndex = caretCharIndex;
 					charProperty.StartVertIndex = verticesCount;
 					charProperty.VertCount = additionalVerticesCount;
 					charProperty.StartTriangleIndex = indicesCount;
-					charProperty.IndicesCount = indicesCount + additionalIndicesCount;
+					charProperty.IndicesCount = additionalIndicesCount;
 					cacheCharPropertyArray.Add(charProperty);
 				}
 
@@ -3081,6 +3139,19 @@ void UIGeometry::UpdateUIText(const FString& text, int32 visibleCharCount, float
 	}
 }
 
+void FUITextLayoutContext::Prepare(ULGUIFontData_BaseObject* InFont, UUIText* InText)
+{
+	Font = InFont;
+	PushCharDataParams = FLGUIFontPushCharDataParams();
+	InFont->PrepareForPushCharData(InText, PushCharDataParams);
+}
+FUITextLayoutContext& FUITextLayoutContext::GetGameThreadContext()
+{
+	check(IsInGameThread());
+	static FUITextLayoutContext GameThreadContext;
+	return GameThreadContext;
+}
+
 #pragma endregion
 
 void UIGeometry::OffsetVertices(TArray<FLGUIOriginVertexData>& vertices, int count, float offsetX, float offsetY)
@@ -5,6 +5,7 @@
 #include "Engine/SceneCapture2D.h"
 #include "Core/ActorComponent/UIItem.h"
 #include "Core/ActorComponent/LGUICanvas.h"
+#include "Core/LGUIProfiler.h"
 
 ULGUIBaseRaycaster::ULGUIBaseRaycaster()
 {
@@ -61,6 +62,7 @@ bool ULGUIBaseRaycaster::ShouldStartDrag_HoldToDrag(ULGUIPointerEventData* InPoi
 
 bool ULGUIBaseRaycaster::RaycastUI(ULGUIPointerEventData* InPointerEventData, const TArray<ELGUIRenderMode>& InRenderModeArray, FVector& OutRayOrigin, FVector& OutRayDirection, FVector& OutRayEnd, FHitResult& OutHitResult, TArray<USceneComponent*>& OutHoverArray)
 {
+	LGUI_PROFILER_SCOPE(Raycast);
 	OutHoverArray.Reset();
 	if (GenerateRay(InPointerEventData, OutRayOrigin, OutRayDirection))
 	{
@@ -144,6 +146,10 @@ bool ULGUIBaseRaycaster::RaycastUI(ULGUIPointerEventData* InPointerEventData, co
 				{
 					if (ShouldSkipCanvas(CanvasItem.Get()))continue;
 					auto& AllUIItemArray = CanvasItem->GetUIItemArray();
+					//canvas's render offset (eg: ScrollView with ScrollByRenderOffset) move rendered result but not UI elements, so move the ray back to hit UI elements where they are rendered
+					const auto RenderOffset = CanvasItem->GetWorldRenderOffset();
+					const auto CanvasRayOrigin = OutRayOrigin - RenderOffset;
+					const auto CanvasRayEnd = OutRayEnd - RenderOffset;
 					for (auto& uiItem : AllUIItemArray)
 					{
 						if (!IsValid(uiItem))continue;
@@ -155,11 +161,15 @@ bool ULGUIBaseRaycaster::RaycastUI(ULGUIPointerEventData* InPointerEventData, co
 							&& uiItem->IsGroupAllowInteraction()
 							&& uiItem->GetTraceChannel() == traceChannel
 							&& uiItem->GetIsUIActiveInHierarchy()
-							&& uiItem->LineTraceUI(thisHit, OutRayOrigin, OutRayEnd)
+							&& uiItem->LineTraceUI(thisHit, CanvasRayOrigin, CanvasRayEnd)
 							)
 						{
-							if (CanvasItem->CalculatePointVisibilityOnClip(thisHit.Location))
+							if (CanvasItem->CalculatePointVisibilityOnClip(thisHit.Location))//clip parameter is in UI element's space, so check before offset
 							{
+								thisHit.Location += RenderOffset;
+								thisHit.ImpactPoint += RenderOffset;
+								thisHit.TraceStart = OutRayOrigin;
+								thisHit.TraceEnd = OutRayEnd;
 								multiHitResult.Add(thisHit);
 							}
 						}
@@ -218,6 +228,7 @@ bool ULGUIBaseRaycaster::RaycastUI(ULGUIPointerEventData* InPointerEventData, co
 
 bool ULGUIBaseRaycaster::RaycastWorld(bool InRequireFaceIndex, ULGUIPointerEventData* InPointerEventData, FVector& OutRayOrigin, FVector& OutRayDirection, FVector& OutRayEnd, FHitResult& OutHitResult, TArray<USceneComponent*>& OutHoverArray)
 {
+	LGUI_PROFILER_SCOPE(Raycast);
 	OutHoverArray.Reset();
 	if (GenerateRay(InPointerEventData, OutRayOrigin, OutRayDirection))
 	{
@@ -412,14 +412,10 @@ void FLGUIEventDelegateData::Execute()
 	}
 	if (CheckTargetObject())
 	{
-		if (CacheFunction != nullptr)
+		if (CacheFunction != nullptr || FindTargetFunction(TargetObject))
 		{
 			ExecuteTargetFunction(TargetObject, CacheFunction);
 		}
-		else
-		{
-			FindAndExecute(TargetObject);
-		}
 	}
 }
 void FLGUIEventDelegateData::Execute(void* InParam, ELGUIEventDelegateParameterType InParameterType)
@@ -472,32 +468,75 @@ void FLGUIEventDelegateData::Execute(void* InParam, ELGUIEventDelegateParameterT
 		}
 		if (CheckTargetObject())
 		{
-			if (CacheFunction != nullptr)
+			if (CacheFunction != nullptr || FindTargetFunction(TargetObject))
 			{
 				ExecuteTargetFunction(TargetObject, CacheFunction, InParam);
 			}
-			else
-			{
-				FindAndExecute(TargetObject, InParam);
-			}
 		}
 	}
 	else
 	{
 		if (CheckTargetObject())
 		{
-			if (CacheFunction != nullptr)
+			if (CacheFunction != nullptr || FindTargetFunction(TargetObject))
 			{
 				ExecuteTargetFunction(TargetObject, CacheFunction);
 			}
-			else
-			{
-				FindAndExecute(TargetObject);
-			}
 		}
 	}
 }
 
+bool FLGUIEventDelegateData::Prepare()
+{
+	if (ParamType == ELGUIEventDelegateParameterType::None)return false;
+	if (!CheckTargetObject())return false;
+	if (CacheFunction == nullptr && !FindTargetFunction(TargetObject))return false;
+	if (!UseNativeParameter && !bParamBufferDecoded)
+	{
+		DecodeParamBuffer();
+	}
+	return true;
+}
+
+void FLGUIEventDelegateData::PostSerialize(const FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		//parameter buffer may change after load, decode it again when use (Prepare or Execute)
+		bParamBufferDecoded = false;
+		CacheFunction = nullptr;
+		bCacheFunctionIsNative = false;
+	}
+}
+
+void FLGUIEventDelegateData::DecodeParamBuffer()
+{
+	switch (ParamType)
+	{
+	case ELGUIEventDelegateParameterType::String:
+	{
+		auto FromBinary = FMemoryReader(ParamBuffer, false);
+		FromBinary << CacheStringValue;
+	}
+	break;
+	case ELGUIEventDelegateParameterType::Name:
+	{
+		auto FromBinary = FMemoryReader(ParamBuffer, false);
+		FromBinary << CacheNameValue;
+	}
+	break;
+	case ELGUIEventDelegateParameterType::Text:
+	{
+		auto FromBinary = FMemoryReader(ParamBuffer, false);
+		FromBinary << CacheTextValue;
+	}
+	break;
+	default:
+		break;
+	}
+	bParamBufferDecoded = true;
+}
+
 #if WITH_EDITOR
 bool FLGUIEventDelegateData::CheckFunctionParameter()const
 {
@@ -528,6 +567,9 @@ bool FLGUIEventDelegateData::CheckTargetObject()
 	}
 	else
 	{
+		//target object will change, cached function may not belong to the new one
+		CacheFunction = nullptr;
+		bCacheFunctionIsNative = false;
 		if (IsValid(HelperActor))
 		{
 			if (IsValid(HelperClass))
@@ -572,39 +614,37 @@ bool FLGUIEventDelegateData::CheckTargetObject()
 		return IsValid(TargetObject);
 	}
 }
-void FLGUIEventDelegateData::FindAndExecute(UObject* Target, void* ParamData)
+bool FLGUIEventDelegateData::FindTargetFunction(UObject* Target)
 {
 	CacheFunction = Target->FindFunction(functionName);
+	bCacheFunctionIsNative = false;
 	if (CacheFunction)
 	{
 		if (!ULGUIEventDelegateParameterHelper::IsStillSupported(CacheFunction, ParamType))
 		{
-			auto errMsg = FText::Format(LOCTEXT("FunctionNotSupport", "LGUIEventDelegateData.FindAndExecute, Target function: {0} not supported!"), FText::FromName(functionName));
+			auto errMsg = FText::Format(LOCTEXT("FunctionNotSupport", "LGUIEventDelegateData.FindTargetFunction, Target function: {0} not supported!"), FText::FromName(functionName));
 #if WITH_EDITOR
 			LGUIUtils::EditorNotification(errMsg, 10);
 #endif
 			UE_LOG(LGUI, Error, TEXT("[%s].%d %s"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *errMsg.ToString());
 			CacheFunction = nullptr;
+			return false;
 		}
-		else
-		{
-			if (ParamData == nullptr)
-			{
-				ExecuteTargetFunction(Target, CacheFunction);
-			}
-			else
-			{
-				ExecuteTargetFunction(Target, CacheFunction, ParamData);
-			}
-		}
+		//native function without out-parameter and not net function, can call it's thunk directly.
+		//blueprint function (or blueprint override of native event) still use ProcessEvent.
+		bCacheFunctionIsNative = CacheFunction->HasAllFunctionFlags(FUNC_Native)
+			&& !CacheFunction->HasAnyFunctionFlags(FUNC_HasOutParms | FUNC_Net)
+			;
+		return true;
 	}
 	else
 	{
-		auto errMsg = FText::Format(LOCTEXT("FunctionNotExist", "LGUIEventDelegateData.FindAndExecute, Target function: {0} not exist!"), FText::FromName(functionName));
+		auto errMsg = FText::Format(LOCTEXT("FunctionNotExist", "LGUIEventDelegateData.FindTargetFunction, Target function: {0} not exist!"), FText::FromName(functionName));
 #if WITH_EDITOR
 		LGUIUtils::EditorNotification(errMsg, 10);
 #endif
 		UE_LOG(LGUI, Error, TEXT("[%s].%d %s"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *errMsg.ToString());
+		return false;
 	}
 }
 void FLGUIEventDelegateData::ExecuteTargetFunction(UObject* Target, UFunction* Func)
@@ -612,46 +652,45 @@ void FLGUIEventDelegateData::ExecuteTargetFunction(UObject* Target, UFunction* F
 	switch (ParamType)
 	{
 	case ELGUIEventDelegateParameterType::String:
-	{
-		FString TempString;
-		auto FromBinary = FMemoryReader(ParamBuffer, false);
-		FromBinary << TempString;
-		Target->ProcessEvent(Func, &TempString);
-	}
-	break;
 	case ELGUIEventDelegateParameterType::Name:
-	{
-		FName TempName;
-		auto FromBinary = FMemoryReader(ParamBuffer, false);
-		FromBinary << TempName;
-		Target->ProcessEvent(Func, &TempName);
-	}
-	break;
 	case ELGUIEventDelegateParameterType::Text:
 	{
-		FText TempText;
-		auto FromBinary = FMemoryReader(ParamBuffer, false);
-		FromBinary << TempText;
-		Target->ProcessEvent(Func, &TempText);
+		if (!bParamBufferDecoded)
+		{
+			DecodeParamBuffer();
+		}
+		void* ParamData = ParamType == ELGUIEventDelegateParameterType::String ? (void*)&CacheStringValue
+			: ParamType == ELGUIEventDelegateParameterType::Name ? (void*)&CacheNameValue
+			: (void*)&CacheTextValue;
+		ExecuteTargetFunction(Target, Func, ParamData);
 	}
 	break;
 	case ELGUIEventDelegateParameterType::Object:
 	case ELGUIEventDelegateParameterType::Actor:
 	case ELGUIEventDelegateParameterType::Class:
 	{
-		Target->ProcessEvent(Func, &ReferenceObject);
+		ExecuteTargetFunction(Target, Func, &ReferenceObject);
 	}
 	break;
 	default:
 	{
-		Target->ProcessEvent(Func, ParamBuffer.GetData());
+		ExecuteTargetFunction(Target, Func, ParamBuffer.GetData());
 	}
 	break;
 	}
 }
 void FLGUIEventDelegateData::ExecuteTargetFunction(UObject* Target, UFunction* Func, void* ParamData)
 {
-	Target->ProcessEvent(Func, ParamData);
+	if (bCacheFunctionIsNative && Func == CacheFunction)
+	{
+		//same as what ProcessEvent do for native function, but skip all the other checks
+		FFrame NewStack(Target, Func, ParamData, nullptr, Func->ChildProperties);
+		Func->Invoke(Target, NewStack, nullptr);
+	}
+	else
+	{
+		Target->ProcessEvent(Func, ParamData);
+	}
 }
 
 FLGUIEventDelegate::FLGUIEventDelegate()
@@ -666,6 +705,13 @@ bool FLGUIEventDelegate::IsBound()const
 {
 	return eventList.Num() != 0;
 }
+void FLGUIEventDelegate::Prepare()const
+{
+	for (auto& item : eventList)
+	{
+		item.Prepare();
+	}
+}
 void FLGUIEventDelegate::FireEvent()const
 {
 	if (eventList.Num() == 0)return;
@@ -9,6 +9,7 @@
 #include "Event/Interface/LGUIPointerDragDropInterface.h"
 #include "Event/Interface/LGUIPointerSelectDeselectInterface.h"
 #include "Core/LGUIManager.h"
+#include "Core/LGUIProfiler.h"
 #include "Core/ActorComponent/UIItem.h"
 #include "Event/LGUIBaseRaycaster.h"
 #include "Event/LGUIPointerEventData.h"
@@ -93,6 +94,7 @@ void ULGUIEventSystem::ProcessInputEvent()
 		if (CurrentInputModule.IsValid())
 		{
 			SCOPE_CYCLE_COUNTER(STAT_EventSystem);
+			LGUI_PROFILER_SCOPE(EventDispatch);
 			CurrentInputModule->ProcessInput();
 		}
 	}
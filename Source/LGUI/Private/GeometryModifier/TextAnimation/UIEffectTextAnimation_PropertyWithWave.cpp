@@ -5,10 +5,12 @@
 #include "Core/ActorComponent/UIText.h"
 #include "LTweenBPLibrary.h"
 #include "Engine/World.h"
+#include "Materials/MaterialInstanceDynamic.h"
 
 void UUIEffectTextAnimation_PropertyWithWave::Init()
 {
 	uiText = GetUIText();
+	if (IsDrivenByMaterial())return;//material do the animation, no need to update geometry every frame
 	updateTweener = ULTweenBPLibrary::UpdateCall(this, FLTweenUpdateDelegate::CreateUObject(this, &UUIEffectTextAnimation_PropertyWithWave::OnUpdate));
 }
 void UUIEffectTextAnimation_PropertyWithWave::Deinit()
@@ -30,6 +32,10 @@ void UUIEffectTextAnimation_PropertyWithWave::OnUpdate(float deltaTime)
 		uiText->MarkVertexPositionDirty();
 	}
 }
+FLinearColor UUIEffectTextAnimation_PropertyWithWave::GetWaveMaterialParameterValue()const
+{
+	return FLinearColor(frequency, flipDirection ? -speed : speed, 0, 0);
+}
 
 void UUIEffectTextAnimation_PositionWaveProperty::ApplyProperty(UUIText* InUIText, const FUIEffectTextAnimation_SelectResult& InSelection, UIGeometry* InGeometry)
 {
@@ -51,6 +57,13 @@ void UUIEffectTextAnimation_PositionWaveProperty::ApplyProperty(UUIText* InUITex
 		}
 	}
 }
+FName UUIEffectTextAnimation_PositionWaveProperty::ValueParameterName = FName(TEXT("LGUI_TextAnimation_PositionWave"));
+FName UUIEffectTextAnimation_PositionWaveProperty::WaveParameterName = FName(TEXT("LGUI_TextAnimation_PositionWave_FrequencySpeed"));
+void UUIEffectTextAnimation_PositionWaveProperty::ApplyMaterialParameter(UMaterialInstanceDynamic* InMaterial)
+{
+	InMaterial->SetVectorParameterValue(ValueParameterName, FLinearColor(position.X, position.Y, position.Z, 0));
+	InMaterial->SetVectorParameterValue(WaveParameterName, GetWaveMaterialParameterValue());
+}
 void UUIEffectTextAnimation_PositionWaveProperty::SetPosition(FVector value)
 {
 	if (position != value)
@@ -88,6 +101,13 @@ void UUIEffectTextAnimation_RotationWaveProperty::ApplyProperty(UUIText* InUITex
 		}
 	}
 }
+FName UUIEffectTextAnimation_RotationWaveProperty::ValueParameterName = FName(TEXT("LGUI_TextAnimation_RotationWave"));
+FName UUIEffectTextAnimation_RotationWaveProperty::WaveParameterName = FName(TEXT("LGUI_TextAnimation_RotationWave_FrequencySpeed"));
+void UUIEffectTextAnimation_RotationWaveProperty::ApplyMaterialParameter(UMaterialInstanceDynamic* InMaterial)
+{
+	InMaterial->SetVectorParameterValue(ValueParameterName, FLinearColor(rotator.Pitch, rotator.Yaw, rotator.Roll, 0));
+	InMaterial->SetVectorParameterValue(WaveParameterName, GetWaveMaterialParameterValue());
+}
 void UUIEffectTextAnimation_RotationWaveProperty::SetRotator(FRotator value)
 {
 	if (rotator != value)
@@ -124,6 +144,13 @@ void UUIEffectTextAnimation_ScaleWaveProperty::ApplyProperty(UUIText* InUIText,
 		}
 	}
 }
+FName UUIEffectTextAnimation_ScaleWaveProperty::ValueParameterName = FName(TEXT("LGUI_TextAnimation_ScaleWave"));
+FName UUIEffectTextAnimation_ScaleWaveProperty::WaveParameterName = FName(TEXT("LGUI_TextAnimation_ScaleWave_FrequencySpeed"));
+void UUIEffectTextAnimation_ScaleWaveProperty::ApplyMaterialParameter(UMaterialInstanceDynamic* InMaterial)
+{
+	InMaterial->SetVectorParameterValue(ValueParameterName, FLinearColor(scale.X, scale.Y, scale.Z, 0));
+	InMaterial->SetVectorParameterValue(WaveParameterName, GetWaveMaterialParameterValue());
+}
 void UUIEffectTextAnimation_ScaleWaveProperty::SetScale(FVector value)
 {
 	if (scale != value)
@@ -132,3 +159,39 @@ void UUIEffectTextAnimation_ScaleWaveProperty::SetScale(FVector value)
 		MarkUITextPositionDirty();
 	}
 }
+
+void UUIEffectTextAnimation_AlphaWaveProperty::ApplyProperty(UUIText* InUIText, const FUIEffectTextAnimation_SelectResult& InSelection, UIGeometry* InGeometry)
+{
+	auto& vertices = InGeometry->vertices;
+	auto& charProperties = InUIText->GetCharPropertyArray();
+	float PIxFreq = this->GetWorld()->TimeSeconds * PI * speed;
+	PIxFreq = flipDirection ? -PIxFreq : PIxFreq;
+	for (int charIndex = InSelection.startCharIndex; charIndex < InSelection.endCharCount; charIndex++)
+	{
+		auto charPropertyItem = charProperties[charIndex];
+		int startVertIndex = charPropertyItem.StartVertIndex;
+		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
+		float lerpValue = FMath::Clamp(InSelection.lerpValueArray[charIndex - InSelection.startCharIndex], 0.0f, 1.0f);
+		float waveAlpha = FMath::Lerp(1.0f, alpha, FMath::Sin(PIxFreq + charIndex * frequency) * 0.5f + 0.5f);
+		for (int vertIndex = startVertIndex; vertIndex < endVertIndex; vertIndex++)
+		{
+			auto& vert = vertices[vertIndex];
+			vert.Color.A = FMath::Lerp(vert.Color.A, (uint8)(vert.Color.A * waveAlpha), lerpValue);
+		}
+	}
+}
+FName UUIEffectTextAnimation_AlphaWaveProperty::ValueParameterName = FName(TEXT("LGUI_TextAnimation_AlphaWave"));
+FName UUIEffectTextAnimation_AlphaWaveProperty::WaveParameterName = FName(TEXT("LGUI_TextAnimation_AlphaWave_FrequencySpeed"));
+void UUIEffectTextAnimation_AlphaWaveProperty::ApplyMaterialParameter(UMaterialInstanceDynamic* InMaterial)
+{
+	InMaterial->SetScalarParameterValue(ValueParameterName, alpha);
+	InMaterial->SetVectorParameterValue(WaveParameterName, GetWaveMaterialParameterValue());
+}
+void UUIEffectTextAnimation_AlphaWaveProperty::SetAlpha(float value)
+{
+	if (alpha != value)
+	{
+		alpha = value;
+		MarkUITextPositionDirty();
+	}
+}
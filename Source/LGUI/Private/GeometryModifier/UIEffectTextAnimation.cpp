@@ -3,8 +3,13 @@
 #include "GeometryModifier/UIEffectTextAnimation.h"
 #include "LGUI.h"
 #include "Core/ActorComponent/UIText.h"
+#include "Core/ActorComponent/LGUICanvas.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Engine/World.h"
 
 
+FName UUIEffectTextAnimation::GlyphCountParameterName = FName(TEXT("LGUI_TextAnimation_GlyphCount"));
+
 UUIEffectTextAnimation::UUIEffectTextAnimation()
 {
 	PrimaryComponentTick.bCanEverTick = false;
@@ -25,6 +30,19 @@ bool UUIEffectTextAnimation::CheckUIText()
 void UUIEffectTextAnimation::BeginPlay()
 {
 	Super::BeginPlay();
+	InitProperties();
+	if (gpuAnimation)
+	{
+		UpdateGPUAnimationMaterial();
+	}
+}
+void UUIEffectTextAnimation::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Super::EndPlay(EndPlayReason);
+	DeinitProperties();
+}
+void UUIEffectTextAnimation::InitProperties()
+{
 	for (auto propertyItem : properties)
 	{
 		if (IsValid(propertyItem))
@@ -33,9 +51,8 @@ void UUIEffectTextAnimation::BeginPlay()
 		}
 	}
 }
-void UUIEffectTextAnimation::EndPlay(const EEndPlayReason::Type EndPlayReason)
+void UUIEffectTextAnimation::DeinitProperties()
 {
-	Super::EndPlay(EndPlayReason);
 	for (auto propertyItem : properties)
 	{
 		if (IsValid(propertyItem))
@@ -59,6 +76,16 @@ void UUIEffectTextAnimation::PostEditChangeProperty(FPropertyChangedEvent& Prope
 				selector->SetOffset(selectorOffset);
 			}
 		}
+		else if (PropertyName == GET_MEMBER_NAME_CHECKED(UUIEffectTextAnimation, gpuAnimation)
+			|| PropertyName == GET_MEMBER_NAME_CHECKED(UUIEffectTextAnimation, gpuAnimationUVChannel)
+			|| PropertyName == GET_MEMBER_NAME_CHECKED(UUIEffectTextAnimation, gpuAnimationPivotUVChannel)
+			)
+		{
+			if (CheckUIText())
+			{
+				uiText->MarkVerticesDirty(true, true, true, true);
+			}
+		}
 	}
 }
 #endif
@@ -71,22 +98,176 @@ void UUIEffectTextAnimation::ModifyUIGeometry(
 	if (InGeometry.vertices.Num() <= 0)return;
 	if (InTriangleChanged || InUVChanged || InColorChanged || InVertexPositionChanged)
 	{
-		if (IsValid(selector))
+		bool hasSelection = IsValid(selector) && selector->Select(uiText, selection);
+		if (gpuAnimation)
 		{
-			if (selector->Select(uiText, selection))
+			BakeGPUAnimationData(InGeometry, hasSelection);
+		}
+		if (hasSelection)
+		{
+			if (InGeometry.vertices.Num() <= 0)return;
+			for (auto propertyItem : properties)
 			{
-				if (InGeometry.vertices.Num() <= 0)return;
-				for (auto propertyItem : properties)
+				if (IsValid(propertyItem))
 				{
-					if (IsValid(propertyItem))
-					{
-						propertyItem->ApplyProperty(uiText, selection, &InGeometry);
-					}
+					if (gpuAnimation && propertyItem->SupportGPUAnimation())continue;//driven by material
+					propertyItem->ApplyProperty(uiText, selection, &InGeometry);
 				}
 			}
 		}
 	}
 }
+void UUIEffectTextAnimation::BakeGPUAnimationData(UIGeometry& InGeometry, bool InHasSelection)
+{
+	auto renderCanvas = uiText->GetRenderCanvas();
+	if (!renderCanvas)return;
+	auto checkUVChannel = [renderCanvas](uint8 InChannel) {
+		bool result = false;
+		switch (InChannel)
+		{
+		case 1: result = renderCanvas->GetRequireUV1(); break;
+		case 2: result = renderCanvas->GetRequireUV2(); break;
+		case 3: result = renderCanvas->GetRequireUV3(); break;
+		}
+		if (!result)
+		{
+			UE_LOG(LGUI, Error, TEXT("[%s].%d LGUICanvas/AdditionalShaderChannel/UV%d should be checked!"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, InChannel);
+		}
+		return result;
+	};
+	if (!checkUVChannel(gpuAnimationUVChannel))return;
+	bool bakePivot = gpuAnimationPivotUVChannel > 0 && gpuAnimationPivotUVChannel != gpuAnimationUVChannel && checkUVChannel(gpuAnimationPivotUVChannel);
+
+	auto& vertices = InGeometry.vertices;
+	auto& originVertices = InGeometry.originVertices;
+	auto& charProperties = uiText->GetCharPropertyArray();
+	for (int charIndex = 0; charIndex < charProperties.Num(); charIndex++)
+	{
+		auto& charPropertyItem = charProperties[charIndex];
+		int startVertIndex = charPropertyItem.StartVertIndex;
+		int endVertIndex = charPropertyItem.StartVertIndex + charPropertyItem.VertCount;
+		if (charPropertyItem.VertCount <= 0 || endVertIndex > vertices.Num())continue;
+		//glyph not selected got 0, so material animation will not affect it
+		float selectValue = 1.0f;
+		if (InHasSelection)
+		{
+			selectValue = (charIndex >= selection.startCharIndex && charIndex < selection.endCharCount)
+				? FMath::Clamp(selection.lerpValueArray[charIndex - selection.startCharIndex], 0.0f, 1.0f)
+				: 0.0f;
+		}
+		auto glyphData = FVector2f(charIndex, selectValue);
+		for (int vertIndex = startVertIndex; vertIndex < endVertIndex; vertIndex++)
+		{
+			vertices[vertIndex].TextureCoordinate[gpuAnimationUVChannel] = glyphData;
+		}
+		if (bakePivot)
+		{
+			auto charCenterPos = originVertices[startVertIndex].Position;
+			for (int vertIndex = startVertIndex + 1; vertIndex < endVertIndex; vertIndex++)
+			{
+				charCenterPos += originVertices[vertIndex].Position;
+			}
+			charCenterPos /= charPropertyItem.VertCount;
+			for (int vertIndex = startVertIndex; vertIndex < endVertIndex; vertIndex++)
+			{
+				auto& pos = originVertices[vertIndex].Position;
+				vertices[vertIndex].TextureCoordinate[gpuAnimationPivotUVChannel] = FVector2f(pos.Y - charCenterPos.Y, pos.Z - charCenterPos.Z);
+			}
+		}
+	}
+	if (gpuAnimationGlyphCount != charProperties.Num())
+	{
+		gpuAnimationGlyphCount = charProperties.Num();
+		if (auto material = GetGPUAnimationMaterial())
+		{
+			material->SetScalarParameterValue(GlyphCountParameterName, gpuAnimationGlyphCount);
+		}
+	}
+}
+UMaterialInstanceDynamic* UUIEffectTextAnimation::GetGPUAnimationMaterial()
+{
+	//only create MaterialInstanceDynamic in game, so it will not be saved into level
+	auto world = this->GetWorld();
+	if (!world || !world->IsGameWorld())return nullptr;
+	if (!CheckUIText())return nullptr;
+	auto customMaterial = uiText->GetCustomUIMaterial();
+	if (!IsValid(customMaterial))
+	{
+		UE_LOG(LGUI, Warning, TEXT("[%s].%d GPU animation need UIText's CustomUIMaterial to read baked glyph data, component: %s"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *this->GetPathName());
+		return nullptr;
+	}
+	if (customMaterial != gpuAnimationMaterial)
+	{
+		gpuAnimationMaterial = Cast<UMaterialInstanceDynamic>(customMaterial);
+		if (!gpuAnimationMaterial)
+		{
+			gpuAnimationMaterial = UMaterialInstanceDynamic::Create(customMaterial, this);
+			uiText->SetCustomUIMaterial(gpuAnimationMaterial);
+		}
+	}
+	return gpuAnimationMaterial;
+}
+void UUIEffectTextAnimation::UpdateGPUAnimationMaterial()
+{
+	if (!gpuAnimation)return;
+	if (auto material = GetGPUAnimationMaterial())
+	{
+		material->SetScalarParameterValue(GlyphCountParameterName, gpuAnimationGlyphCount);
+		for (auto propertyItem : properties)
+		{
+			if (IsValid(propertyItem) && propertyItem->SupportGPUAnimation())
+			{
+				propertyItem->ApplyMaterialParameter(material);
+			}
+		}
+	}
+}
+void UUIEffectTextAnimation::SetGPUAnimation(bool value)
+{
+	if (gpuAnimation != value)
+	{
+		//properties may change update method, eg: wave property not need to update every frame
+		bool isPlaying = HasBegunPlay();
+		if (isPlaying)
+		{
+			DeinitProperties();
+		}
+		gpuAnimation = value;
+		if (isPlaying)
+		{
+			InitProperties();
+			UpdateGPUAnimationMaterial();
+		}
+		if (CheckUIText())
+		{
+			uiText->MarkVerticesDirty(true, true, true, true);
+		}
+	}
+}
+void UUIEffectTextAnimation::SetGPUAnimationUVChannel(uint8 value)
+{
+	value = FMath::Clamp(value, (uint8)1, (uint8)3);
+	if (gpuAnimationUVChannel != value)
+	{
+		gpuAnimationUVChannel = value;
+		if (gpuAnimation && CheckUIText())
+		{
+			uiText->MarkVerticesDirty(true, true, true, true);
+		}
+	}
+}
+void UUIEffectTextAnimation::SetGPUAnimationPivotUVChannel(uint8 value)
+{
+	value = FMath::Min(value, (uint8)3);
+	if (gpuAnimationPivotUVChannel != value)
+	{
+		gpuAnimationPivotUVChannel = value;
+		if (gpuAnimation && CheckUIText())
+		{
+			uiText->MarkVerticesDirty(true, true, true, true);
+		}
+	}
+}
 UUIText* UUIEffectTextAnimation::GetUIText()
 {
 	CheckUIText();
@@ -115,6 +296,7 @@ void UUIEffectTextAnimation::SetSelector(UUIEffectTextAnimation_Selector* value)
 void UUIEffectTextAnimation::SetProperties(const TArray<UUIEffectTextAnimation_Property*>& value)
 {
 	properties = value;
+	UpdateGPUAnimationMaterial();
 	if (CheckUIText())
 	{
 		uiText->MarkVerticesDirty(true, true, true, true);
@@ -130,6 +312,7 @@ void UUIEffectTextAnimation::SetProperty(int index, UUIEffectTextAnimation_Prope
 	if (properties[index] != value)
 	{
 		properties[index] = value;
+		UpdateGPUAnimationMaterial();
 		if (CheckUIText())
 		{
 			uiText->MarkVerticesDirty(true, true, true, true);
@@ -195,17 +378,29 @@ void UUIEffectTextAnimation::SetSelectorOffset(float value)
 
 UUIText* UUIEffectTextAnimation_Property::GetUIText()
 {
-	if (auto outter = this->GetOuter())
+	if (auto uiTextAnimation = GetUIEffectTextAnimation())
 	{
-		if (auto uiTextAnimation = Cast<UUIEffectTextAnimation>(outter))
-		{
-			return uiTextAnimation->GetUIText();
-		}
+		return uiTextAnimation->GetUIText();
 	}
 	return nullptr;
 }
+UUIEffectTextAnimation* UUIEffectTextAnimation_Property::GetUIEffectTextAnimation()
+{
+	return Cast<UUIEffectTextAnimation>(this->GetOuter());
+}
+bool UUIEffectTextAnimation_Property::IsDrivenByMaterial()
+{
+	if (!SupportGPUAnimation())return false;
+	auto uiTextAnimation = GetUIEffectTextAnimation();
+	return uiTextAnimation != nullptr && uiTextAnimation->GetGPUAnimation();
+}
 void UUIEffectTextAnimation_Property::MarkUITextPositionDirty()
 {
+	if (IsDrivenByMaterial())
+	{
+		GetUIEffectTextAnimation()->UpdateGPUAnimationMaterial();
+		return;
+	}
 	if (auto uiText = GetUIText())
 	{
 		uiText->MarkVertexPositionDirty();
@@ -574,6 +574,7 @@ UUIDropdownItemComponent::UUIDropdownItemComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
 	Toggle = FLGUIComponentReference(UUIToggleComponent::StaticClass());
+	MarkUpdateNotOverriddenBy(UUIDropdownItemComponent::StaticClass());
 }
 
 void UUIDropdownItemComponent::Init(int32 Index, const FUIDropdownOptionData& Data, const TFunction<void()>& OnSelect)
@@ -296,7 +296,7 @@ void UUIRecyclableScrollViewComponent::ScrollToByDataIndex(int InDataIndex, bool
         {
             auto tweener = ULTweenManager::To(this, FLTweenFloatGetterFunction::CreateWeakLambda(this
                 , [=] {
-                    auto ContentLocation = ContentUIItem->GetRelativeLocation();
+                    auto ContentLocation = GetContentPosition();
                     return ContentLocation.Y;
                 })
                 , FLTweenFloatSetterFunction::CreateWeakLambda(this, [=](float value) {
@@ -356,7 +356,7 @@ void UUIRecyclableScrollViewComponent::ScrollToByDataIndex(int InDataIndex, bool
         {
             auto tweener = ULTweenManager::To(this, FLTweenFloatGetterFunction::CreateWeakLambda(this
                 , [=] {
-                    auto ContentLocation = ContentUIItem->GetRelativeLocation();
+                    auto ContentLocation = GetContentPosition();
                     return ContentLocation.Z;
                 })
                 , FLTweenFloatSetterFunction::CreateWeakLambda(this, [=](float value) {
@@ -639,7 +639,8 @@ void UUIRecyclableScrollViewComponent::InitializeOnDataSource()
     }
     MinCellDataIndex = 0;
 
-    PrevContentPosition = FVector2D(ContentUIItem->GetRelativeLocation().Y, ContentUIItem->GetRelativeLocation().Z);
+    const auto ContentLocation = GetContentPosition();
+    PrevContentPosition = FVector2D(ContentLocation.Y, ContentLocation.Z);
     OnScrollEventDelegateHandle = this->RegisterScrollEvent(FLGUIVector2Delegate::CreateUObject(this, &UUIRecyclableScrollViewComponent::OnScrollCallback));
     //this->SetScrollProgress(PrevProgress);
 }
@@ -650,11 +651,12 @@ void UUIRecyclableScrollViewComponent::OnScrollCallback(FVector2D value)
     if (DataItemCount == 0)return;
 
     IUIRecyclableScrollViewDataSource::Execute_BeforeSetCell(DataSource);
-    const auto ContentPosition = FVector2D(ContentUIItem->GetRelativeLocation().Y, ContentUIItem->GetRelativeLocation().Z);
+    const auto ContentLocation = GetContentPosition();//include render offset
+    const auto ContentPosition = FVector2D(ContentLocation.Y, ContentLocation.Z);
     if (Horizontal)
     {
         auto CellWidth = WorkingCellTemplateSize.X;
-        auto PointToScrollViewSpaceOffset = ContentUIItem->GetRelativeLocation().Y;
+        auto PointToScrollViewSpaceOffset = ContentLocation.Y;
         if (ContentPosition.X > PrevContentPosition.X)//scroll from left to right
         {
             while (MinCellDataIndex > 0 || (bInfiniteLoop && Rows == 1))
@@ -742,7 +744,7 @@ void UUIRecyclableScrollViewComponent::OnScrollCallback(FVector2D value)
     else
     {
         auto CellHeight = WorkingCellTemplateSize.Y;
-        auto PointToScrollViewSpaceOffset = ContentUIItem->GetRelativeLocation().Z;
+        auto PointToScrollViewSpaceOffset = ContentLocation.Z;
         if (ContentPosition.Y < PrevContentPosition.Y)//scroll from top to bottom
         {
             while (MinCellDataIndex > 0 || (bInfiniteLoop && Columns == 1))
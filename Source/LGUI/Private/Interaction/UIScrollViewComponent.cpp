@@ -6,6 +6,7 @@
 #include "Core/Actor/UIBaseActor.h"
 #include "Utils/LGUIUtils.h"
 #include "Core/LGUISettings.h"
+#include "Core/ActorComponent/LGUICanvas.h"
 
 void UUIScrollViewHelper::Awake()
 {
@@ -58,6 +59,8 @@ void UUIScrollViewComponent::Update(float DeltaTime)
     Super::Update(DeltaTime);
     if (bCanUpdateAfterDrag)
         UpdateAfterDrag(DeltaTime);
+    else if (ContentCanvas.IsValid() && GFrameCounter > ContentRenderOffsetFrame + 1)//not moved since last frame (eg: scrollbar released), commit render offset to Content's location
+        ApplyContentRenderOffset();
 }
 
 #if WITH_EDITOR
@@ -72,6 +75,11 @@ void UUIScrollViewComponent::PostEditChangeProperty(FPropertyChangedEvent &Prope
         {
             ApplyContentPositionWithProgress();
         }
+        else if (Property->GetFName() == GET_MEMBER_NAME_CHECKED(UUIScrollViewComponent, ScrollByRenderOffset))
+        {
+            ApplyContentRenderOffset();
+            CheckContentCanvas();
+        }
     }
 }
 #endif
@@ -106,7 +114,7 @@ void UUIScrollViewComponent::RecalculateRange()
         }
         else
         {
-            auto Position = ContentUIItem->GetRelativeLocation();
+            auto Position = GetContentPosition();
             if (
                 (bAllowHorizontalScroll && (Position.Y < HorizontalRange.X || Position.Y > HorizontalRange.Y))
                 || (bAllowVerticalScroll && (Position.Z < VerticalRange.X || Position.Z > VerticalRange.Y))
@@ -129,6 +137,10 @@ void UUIScrollViewComponent::OnUIActiveInHierachy(bool ativeOrInactive)
         bRangeCalculated = false;
         RecalculateRange();
     }
+    else
+    {
+        ApplyContentRenderOffset();
+    }
 }
 void UUIScrollViewComponent::OnUIDimensionsChanged(bool horizontalPositionChanged, bool verticalPositionChanged, bool widthChanged, bool heightChanged)
 {
@@ -153,6 +165,7 @@ bool UUIScrollViewComponent::CheckParameters()
         return false;
     ContentUIItem = Content->GetUIItem();
     ContentParentUIItem = contentParentActor->GetUIItem();
+    CheckContentCanvas();
     if (ContentParentUIItem != nullptr)
     {
         auto contentParentHelperComp = NewObject<UUIScrollViewHelper>(contentParentActor);
@@ -165,6 +178,56 @@ bool UUIScrollViewComponent::CheckParameters()
     return false;
 }
 
+void UUIScrollViewComponent::CheckContentCanvas()
+{
+    ContentCanvas = nullptr;
+    if (ScrollByRenderOffset && Content.IsValid())
+    {
+        auto Canvas = Content->FindComponentByClass<ULGUICanvas>();
+        if (Canvas != nullptr && Canvas->GetUIItem() == Content->GetUIItem())
+        {
+            ContentCanvas = Canvas;
+        }
+        else
+        {
+            UE_LOG(LGUI, Warning, TEXT("[%s].%d ScrollByRenderOffset need a LGUICanvas on Content, will move Content instead. ScrollView: %s"), ANSI_TO_TCHAR(__FUNCTION__), __LINE__, *this->GetPathName());
+        }
+    }
+}
+FVector UUIScrollViewComponent::GetContentPosition()const
+{
+    auto Position = ContentUIItem->GetRelativeLocation();
+    if (ContentCanvas.IsValid())
+    {
+        const auto& RenderOffset = ContentCanvas->GetRenderOffset();
+        Position += ContentUIItem->GetRelativeTransform().TransformVector(FVector(0, RenderOffset.X, RenderOffset.Y));
+    }
+    return Position;
+}
+void UUIScrollViewComponent::SetContentPosition(const FVector& InPosition)
+{
+    if (ContentCanvas.IsValid())
+    {
+        //only offset render result, so UI elements inside Content no need to update transform and geometry
+        auto LocalOffset = ContentUIItem->GetRelativeTransform().InverseTransformVector(InPosition - ContentUIItem->GetRelativeLocation());
+        ContentCanvas->SetRenderOffset(FVector2D(LocalOffset.Y, LocalOffset.Z));
+        ContentRenderOffsetFrame = GFrameCounter;
+    }
+    else
+    {
+        ContentUIItem->SetRelativeLocation(InPosition);
+    }
+}
+void UUIScrollViewComponent::ApplyContentRenderOffset()
+{
+    if (ContentCanvas.IsValid() && ContentUIItem.IsValid() && ContentCanvas->GetRenderOffset() != FVector2D::ZeroVector)
+    {
+        auto Position = GetContentPosition();
+        ContentCanvas->SetRenderOffset(FVector2D::ZeroVector);
+        ContentUIItem->SetRelativeLocation(Position);
+    }
+}
+
 bool UUIScrollViewComponent::CheckValidHit(USceneComponent *InHitComp)
 {
     return (InHitComp->IsAttachedTo(RootUIComp.Get()) || InHitComp == RootUIComp); //make sure hit component is child of this or is this
@@ -203,6 +266,7 @@ bool UUIScrollViewComponent::OnPointerBeginDrag_Implementation(ULGUIPointerEvent
             }
         }
         bCanUpdateAfterDrag = false;
+        ApplyContentRenderOffset();//raycast and drag use Content's actual location
         OnPointerDrag_Implementation(eventData);
     }
     else
@@ -216,7 +280,7 @@ bool UUIScrollViewComponent::OnPointerDrag_Implementation(ULGUIPointerEventData
 {
     if (!ContentUIItem.IsValid())
         return AllowEventBubbleUp;
-    auto Position = ContentUIItem->GetRelativeLocation();
+    auto Position = GetContentPosition();
     auto CurrentPointerPosition = eventData->GetWorldPointInPlane();
     auto localMoveDelta = eventData->pressWorldToLocalTransform.TransformVector(CurrentPointerPosition - PrevPointerPosition);
     PrevPointerPosition = CurrentPointerPosition;
@@ -232,7 +296,7 @@ bool UUIScrollViewComponent::OnPointerDrag_Implementation(ULGUIPointerEventData
             Position.Y = predict;
         }
         bCanUpdateAfterDrag = false;
-        ContentUIItem->SetRelativeLocation(Position);
+        SetContentPosition(Position);
         UpdateProgress();
     }
     if (bAllowVerticalScroll)
@@ -247,7 +311,7 @@ bool UUIScrollViewComponent::OnPointerDrag_Implementation(ULGUIPointerEventData
             Position.Z = predict;
         }
         bCanUpdateAfterDrag = false;
-        ContentUIItem->SetRelativeLocation(Position);
+        SetContentPosition(Position);
         UpdateProgress();
     }
     return AllowEventBubbleUp;
@@ -255,7 +319,7 @@ bool UUIScrollViewComponent::OnPointerDrag_Implementation(ULGUIPointerEventData
 
 bool UUIScrollViewComponent::OnPointerEndDrag_Implementation(ULGUIPointerEventData *eventData)
 {
-    auto Position = ContentUIItem->GetRelativeLocation();
+    auto Position = GetContentPosition();
     auto CurrentPointerPosition = eventData->GetWorldPointInPlane();
     const auto localMoveDelta = eventData->pressWorldToLocalTransform.TransformVector(CurrentPointerPosition - PrevPointerPosition);
     if (bAllowHorizontalScroll)
@@ -301,7 +365,7 @@ bool UUIScrollViewComponent::OnPointerScroll_Implementation(ULGUIPointerEventDat
                 }
             }
 
-            auto Position = ContentUIItem->GetRelativeLocation();
+            auto Position = GetContentPosition();
             if (bAllowHorizontalScroll)
             {
                 auto delta = eventData->scrollAxisValue.X * ScrollSensitivity;
@@ -316,7 +380,7 @@ bool UUIScrollViewComponent::OnPointerScroll_Implementation(ULGUIPointerEventDat
                     Position.Y += delta;
                     Velocity.X = delta / GetWorld()->DeltaTimeSeconds;
                 }
-                ContentUIItem->SetRelativeLocation(Position);
+                SetContentPosition(Position);
             }
             if (bAllowVerticalScroll)
             {
@@ -332,7 +396,7 @@ bool UUIScrollViewComponent::OnPointerScroll_Implementation(ULGUIPointerEventDat
                     Position.Z += delta;
                     Velocity.Y = delta / GetWorld()->DeltaTimeSeconds;
                 }
-                ContentUIItem->SetRelativeLocation(Position);
+                SetContentPosition(Position);
             }
         }
     }
@@ -378,12 +442,22 @@ void UUIScrollViewComponent::SetOutOfRangeDamper(float value)
     }
 }
 
+void UUIScrollViewComponent::SetScrollByRenderOffset(bool value)
+{
+    if (ScrollByRenderOffset != value)
+    {
+        ApplyContentRenderOffset();
+        ScrollByRenderOffset = value;
+        CheckContentCanvas();
+    }
+}
+
 void UUIScrollViewComponent::SetScrollDelta(FVector2D value)
 {
     if (CheckParameters())
     {
         auto delta = value;
-        auto Position = ContentUIItem->GetRelativeLocation();
+        auto Position = GetContentPosition();
         if (Horizontal)
 		{
 			bAllowHorizontalScroll = true;
@@ -398,7 +472,7 @@ void UUIScrollViewComponent::SetScrollDelta(FVector2D value)
 				Position.Y += delta.X;
 				Velocity.X = delta.X / GetWorld()->DeltaTimeSeconds;
 			}
-			ContentUIItem->SetRelativeLocation(Position);
+			SetContentPosition(Position);
 		}
 		if (Vertical)
 		{
@@ -414,7 +488,7 @@ void UUIScrollViewComponent::SetScrollDelta(FVector2D value)
 				Position.Z += delta.Y;
 				Velocity.Y = delta.Y / GetWorld()->DeltaTimeSeconds;
 			}
-			ContentUIItem->SetRelativeLocation(Position);
+			SetContentPosition(Position);
 		}
     }
 }
@@ -422,14 +496,14 @@ void UUIScrollViewComponent::SetScrollValue(FVector2D value)
 {
     if (CheckParameters())
     {
-        auto Position = ContentUIItem->GetRelativeLocation();
+        auto Position = GetContentPosition();
         if (Horizontal)
 		{
 			bAllowHorizontalScroll = true;
 			bCanUpdateAfterDrag = true;
 			Position.Y = value.X;
 			Velocity.X = 0;
-			ContentUIItem->SetRelativeLocation(Position);
+			SetContentPosition(Position);
             UpdateProgress();
         }
 		if (Vertical)
@@ -438,7 +512,7 @@ void UUIScrollViewComponent::SetScrollValue(FVector2D value)
 			bCanUpdateAfterDrag = true;
 			Position.Z = value.Y;
 			Velocity.Y = 0;
-			ContentUIItem->SetRelativeLocation(Position);
+			SetContentPosition(Position);
             UpdateProgress();
 		}
     }
@@ -448,7 +522,7 @@ void UUIScrollViewComponent::SetScrollProgress(FVector2D value)
 {
     if (CheckParameters())
     {
-        auto Position = ContentUIItem->GetRelativeLocation();
+        auto Position = GetContentPosition();
         if (Horizontal)
         {
             bCanUpdateAfterDrag = true;
@@ -457,7 +531,7 @@ void UUIScrollViewComponent::SetScrollProgress(FVector2D value)
             RecalculateRange();
             value.X = FMath::Clamp(value.X, 0.0f, 1.0f);
             Position.Y = FMath::Lerp(HorizontalRange.X, HorizontalRange.Y, value.X);
-            ContentUIItem->SetRelativeLocation(Position);
+            SetContentPosition(Position);
             UpdateProgress();
         }
         if (Vertical)
@@ -468,7 +542,7 @@ void UUIScrollViewComponent::SetScrollProgress(FVector2D value)
             RecalculateRange();
             value.Y = FMath::Clamp(value.Y, 0.0f, 1.0f);
             Position.Z = FMath::Lerp(VerticalRange.X, VerticalRange.Y, value.Y);
-            ContentUIItem->SetRelativeLocation(Position);
+            SetContentPosition(Position);
             UpdateProgress();
         }
     }
@@ -487,7 +561,7 @@ void UUIScrollViewComponent::ScrollTo(UUIItem* InChild, bool InEaseAnimation, fl
     {
         auto tweener = ULTweenManager::To(this, FLTweenVector2DGetterFunction::CreateWeakLambda(this
             , [=] {
-                auto ContentLocation = ContentUIItem->GetRelativeLocation();
+                auto ContentLocation = GetContentPosition();
                 return FVector2D(ContentLocation.Y, ContentLocation.Z);
             })
             , FLTweenVector2DSetterFunction::CreateWeakLambda(this, [=](FVector2D value) {
@@ -522,7 +596,7 @@ void UUIScrollViewComponent::ScrollTo(UUIItem* InChild, bool InEaseAnimation, fl
 #define POSITION_THRESHOLD 0.001f
 void UUIScrollViewComponent::UpdateAfterDrag(float deltaTime)
 {
-    auto Position = ContentUIItem->GetRelativeLocation();
+    auto Position = GetContentPosition();
     if (FMath::Abs(Velocity.X) > KINDA_SMALL_NUMBER || FMath::Abs(Velocity.Y) > KINDA_SMALL_NUMBER//speed larger than threshold
         || (bAllowHorizontalScroll && (Position.Y < HorizontalRange.X || Position.Y > HorizontalRange.Y))//horizontal out of range
         || (bAllowVerticalScroll && (Position.Z < VerticalRange.X || Position.Z > VerticalRange.Y)))//vertical out of range
@@ -656,12 +730,13 @@ void UUIScrollViewComponent::UpdateAfterDrag(float deltaTime)
         if (canMove)
         {
             UpdateProgress();
-            ContentUIItem->SetRelativeLocation(Position);
+            SetContentPosition(Position);
         }
     }
     else
     {
         bCanUpdateAfterDrag = false;
+        ApplyContentRenderOffset();
     }
 }
 
@@ -669,7 +744,7 @@ void UUIScrollViewComponent::ApplyContentPositionWithProgress()
 {
     if (CheckParameters())
     {
-        auto Position = ContentUIItem->GetRelativeLocation();
+        auto Position = GetContentPosition();
         if (Horizontal)
         {
             bCanUpdateAfterDrag = true;
@@ -677,7 +752,7 @@ void UUIScrollViewComponent::ApplyContentPositionWithProgress()
 
             Progress.X = FMath::Clamp(Progress.X, 0.0f, 1.0f);
             Position.Y = FMath::Lerp(HorizontalRange.X, HorizontalRange.Y, 1.0f - Progress.X);
-            ContentUIItem->SetRelativeLocation(Position);
+            SetContentPosition(Position);
         }
         if (Vertical)
         {
@@ -686,7 +761,7 @@ void UUIScrollViewComponent::ApplyContentPositionWithProgress()
 
             Progress.Y = FMath::Clamp(Progress.Y, 0.0f, 1.0f);
             Position.Z = FMath::Lerp(VerticalRange.X, VerticalRange.Y, Progress.Y);
-            ContentUIItem->SetRelativeLocation(Position);
+            SetContentPosition(Position);
         }
     }
 }
@@ -696,7 +771,7 @@ void UUIScrollViewComponent::UpdateProgress(bool InFireEvent)
 {
     if (!ContentUIItem.IsValid())
         return;
-    auto relativeLocation = ContentUIItem->GetRelativeLocation();
+    auto relativeLocation = GetContentPosition();
     if (bAllowHorizontalScroll)
     {
         if (FMath::Abs(HorizontalRange.Y - HorizontalRange.X) > KINDA_SMALL_NUMBER)
@@ -421,9 +421,9 @@ void UUIScrollViewWithScrollbarComponent::OnHorizontalScrollbar(float InScrollVa
 	bAllowHorizontalScroll = true;
 
 	InScrollValue = FMath::Clamp(InScrollValue, 0.0f, 1.0f);
-	auto Position = ContentUIItem->GetRelativeLocation();
+	auto Position = GetContentPosition();
 	Position.Y = FMath::Lerp(HorizontalRange.X, HorizontalRange.Y, 1.0f - InScrollValue);
-	ContentUIItem->SetRelativeLocation(Position);
+	SetContentPosition(Position);
 	Super::UpdateProgress();//use parent's function, skip the set scrollbar code
 }
 void UUIScrollViewWithScrollbarComponent::OnVerticalScrollbar(float InScrollValue)
@@ -433,9 +433,9 @@ void UUIScrollViewWithScrollbarComponent::OnVerticalScrollbar(float InScrollValu
 	bAllowVerticalScroll = true;
 
 	InScrollValue = FMath::Clamp(InScrollValue, 0.0f, 1.0f);
-	auto Position = ContentUIItem->GetRelativeLocation();
+	auto Position = GetContentPosition();
 	Position.Z = FMath::Lerp(VerticalRange.X, VerticalRange.Y, InScrollValue);
-	ContentUIItem->SetRelativeLocation(Position);
+	SetContentPosition(Position);
 	Super::UpdateProgress();//use parent's function, skip the set scrollbar code
 }
 void UUIScrollViewWithScrollbarComponent::SetHorizontalScrollbarVisibility(EScrollViewScrollbarVisibility value)
@@ -134,6 +134,7 @@ void UUITextInputComponent::PostEditChangeProperty(FPropertyChangedEvent& Proper
 			UE_LOG(LGUI, Error, TEXT("[UUITextInputComponent::PostEditChangeProperty]Input text should not change by culture, set it to not localizable."));
 		}
 	}
+	bFullTextLayoutDirty = true;//any property could change, so set full text again
 	UpdateUITextComponent();
 	UpdatePlaceHolderComponent();
 }
@@ -732,7 +733,7 @@ bool UUITextInputComponent::DeleteSelection(bool InFireEvent)
 	if (SelectionPropertyArray.Num() != 0)//delete selection frist
 	{
 		int32 startIndex = PressCaretPositionIndex > CaretPositionIndex ? CaretPositionIndex : PressCaretPositionIndex;
-		Text.RemoveAt(startIndex, FMath::Abs(CaretPositionIndex - PressCaretPositionIndex));
+		ReplaceTextRange(startIndex, FMath::Abs(CaretPositionIndex - PressCaretPositionIndex), FString());
 		CaretPositionIndex = PressCaretPositionIndex > CaretPositionIndex ? CaretPositionIndex : PressCaretPositionIndex;
 		UpdateAfterTextChange(InFireEvent);
 		return true;
@@ -742,53 +743,50 @@ bool UUITextInputComponent::DeleteSelection(bool InFireEvent)
 void UUITextInputComponent::InsertCharAtCaretPosition(TCHAR c)
 {
 	if (bReadOnly)return;
-	TextActor->GetUIText()->SetText(FText::FromString(GetReplaceText()));
-	auto CharIndex = TextActor->GetUIText()->GetCharIndexByCaretIndex(CaretPositionIndex);
-	Text.InsertAt(CharIndex, c);
-	TextActor->GetUIText()->SetText(FText::FromString(GetReplaceText()));
-	CaretPositionIndex = TextActor->GetUIText()->GetCaretIndexByCharIndex(CharIndex) + 1;
+	if (!UpdateFullTextLayout())return;
+	auto CharIndex = FullTextLayout.GetCharIndexByCaretIndex(CaretPositionIndex);
+	ReplaceTextRange(CharIndex, 0, FString::ChrN(1, c));
+	CaretPositionIndex = FullTextLayout.GetCaretIndexByCharIndex(CharIndex) + 1;
 	PressCaretPositionIndex = CaretPositionIndex;
 }
 void UUITextInputComponent::InsertStringAtCaretPosition(const FString& value)
 {
 	if (bReadOnly)return;
-	TextActor->GetUIText()->SetText(FText::FromString(GetReplaceText()));
-	auto CharIndex = TextActor->GetUIText()->GetCharIndexByCaretIndex(CaretPositionIndex);
-	Text.InsertAt(CharIndex, value);
+	if (!UpdateFullTextLayout())return;
+	auto CharIndex = FullTextLayout.GetCharIndexByCaretIndex(CaretPositionIndex);
+	ReplaceTextRange(CharIndex, 0, value);
 	CharIndex += value.Len();
-	TextActor->GetUIText()->SetText(FText::FromString(GetReplaceText()));
-	CaretPositionIndex = TextActor->GetUIText()->GetCaretIndexByCharIndex(CharIndex) + 1;
+	CaretPositionIndex = FullTextLayout.GetCaretIndexByCharIndex(CharIndex) + 1;
 	PressCaretPositionIndex = CaretPositionIndex;
 }
 
 void UUITextInputComponent::BackSpace()
 {
 	if (bReadOnly)return;
+	if (!UpdateFullTextLayout())return;
 	if (SelectionPropertyArray.Num() == 0)//no selection mask, use caret
 	{
 		if (CaretPositionIndex > 0)
 		{
 			CaretPositionIndex--;
-			TextActor->GetUIText()->SetText(FText::FromString(GetReplaceText()));
-			auto CharIndex = TextActor->GetUIText()->GetCharIndexByCaretIndex(CaretPositionIndex);
+			auto CharIndex = FullTextLayout.GetCharIndexByCaretIndex(CaretPositionIndex);
 			int RemoveCount = 1;
 			if (CharIndex + 1 < Text.Len())//not end char, could be rich text, so check delete count
 			{
-				auto NextCharIndex = TextActor->GetUIText()->GetCharIndexByCaretIndex(CaretPositionIndex + 1);
+				auto NextCharIndex = FullTextLayout.GetCharIndexByCaretIndex(CaretPositionIndex + 1);
 				RemoveCount = NextCharIndex - CharIndex;
 			}
-			Text.RemoveAt(CharIndex, RemoveCount);
+			ReplaceTextRange(CharIndex, RemoveCount, FString());
 			UpdateAfterTextChange(true);
 			PressCaretPositionIndex = CaretPositionIndex;
 		}
 	}
 	else//selection mask, delete 
 	{
-		TextActor->GetUIText()->SetText(FText::FromString(GetReplaceText()));
-		auto CharIndexAtPressCaretPosition = TextActor->GetUIText()->GetCharIndexByCaretIndex(PressCaretPositionIndex);
-		auto CharIndexAtCaretPosition = TextActor->GetUIText()->GetCharIndexByCaretIndex(CaretPositionIndex);
+		auto CharIndexAtPressCaretPosition = FullTextLayout.GetCharIndexByCaretIndex(PressCaretPositionIndex);
+		auto CharIndexAtCaretPosition = FullTextLayout.GetCharIndexByCaretIndex(CaretPositionIndex);
 		int32 TempCharIndex = CharIndexAtPressCaretPosition > CharIndexAtCaretPosition ? CharIndexAtCaretPosition : CharIndexAtPressCaretPosition;
-		Text.RemoveAt(TempCharIndex, FMath::Abs(CharIndexAtPressCaretPosition - CharIndexAtCaretPosition));
+		ReplaceTextRange(TempCharIndex, FMath::Abs(CharIndexAtPressCaretPosition - CharIndexAtCaretPosition), FString());
 		CaretPositionIndex = PressCaretPositionIndex > CaretPositionIndex ? CaretPositionIndex : PressCaretPositionIndex;
 		UpdateAfterTextChange(true);
 		PressCaretPositionIndex = CaretPositionIndex;
@@ -797,30 +795,29 @@ void UUITextInputComponent::BackSpace()
 void UUITextInputComponent::ForwardSpace()
 {
 	if (bReadOnly)return;
+	if (!UpdateFullTextLayout())return;
 	if (SelectionPropertyArray.Num() == 0)//no selection mask, use caret
 	{
-		TextActor->GetUIText()->SetText(FText::FromString(GetReplaceText()));
-		auto CharIndex = TextActor->GetUIText()->GetCharIndexByCaretIndex(CaretPositionIndex);
+		auto CharIndex = FullTextLayout.GetCharIndexByCaretIndex(CaretPositionIndex);
 		int RemoveCount = 1;
 		if (CharIndex + 1 < Text.Len())//not end char, could be rich text, so check delete count
 		{
-			auto NextCharIndex = TextActor->GetUIText()->GetCharIndexByCaretIndex(CaretPositionIndex + 1);
+			auto NextCharIndex = FullTextLayout.GetCharIndexByCaretIndex(CaretPositionIndex + 1);
 			RemoveCount = NextCharIndex - CharIndex;
 		}
 		if (CharIndex < Text.Len() && CharIndex + RemoveCount <= Text.Len())
 		{
-			Text.RemoveAt(CharIndex, RemoveCount);
+			ReplaceTextRange(CharIndex, RemoveCount, FString());
 			UpdateAfterTextChange(true);
 			PressCaretPositionIndex = CaretPositionIndex;
 		}
 	}
 	else//selection mask, delete 
 	{
-		TextActor->GetUIText()->SetText(FText::FromString(GetReplaceText()));
-		auto CharIndexAtPressCaretPosition = TextActor->GetUIText()->GetCharIndexByCaretIndex(PressCaretPositionIndex);
-		auto CharIndexAtCaretPosition = TextActor->GetUIText()->GetCharIndexByCaretIndex(CaretPositionIndex);
+		auto CharIndexAtPressCaretPosition = FullTextLayout.GetCharIndexByCaretIndex(PressCaretPositionIndex);
+		auto CharIndexAtCaretPosition = FullTextLayout.GetCharIndexByCaretIndex(CaretPositionIndex);
 		int32 TempCharIndex = CharIndexAtPressCaretPosition > CharIndexAtCaretPosition ? CharIndexAtCaretPosition : CharIndexAtPressCaretPosition;
-		Text.RemoveAt(TempCharIndex, FMath::Abs(CharIndexAtPressCaretPosition - CharIndexAtCaretPosition));
+		ReplaceTextRange(TempCharIndex, FMath::Abs(CharIndexAtPressCaretPosition - CharIndexAtCaretPosition), FString());
 		CaretPositionIndex = PressCaretPositionIndex > CaretPositionIndex ? CaretPositionIndex : PressCaretPositionIndex;
 		UpdateAfterTextChange(true);
 		PressCaretPositionIndex = CaretPositionIndex;
@@ -833,14 +830,12 @@ void UUITextInputComponent::Copy()
 		)return;//not allow copy password
 	if (SelectionPropertyArray.Num() != 0)//have selection
 	{
-		TextActor->GetUIText()->SetText(FText::FromString(Text));
-		auto CharIndexAtPressCaretPosition = TextActor->GetUIText()->GetCharIndexByCaretIndex(PressCaretPositionIndex);
-		auto CharIndexAtCaretPosition = TextActor->GetUIText()->GetCharIndexByCaretIndex(CaretPositionIndex);
+		if (!UpdateFullTextLayout())return;//password is not allowed to copy, so replace text is same as text
+		auto CharIndexAtPressCaretPosition = FullTextLayout.GetCharIndexByCaretIndex(PressCaretPositionIndex);
+		auto CharIndexAtCaretPosition = FullTextLayout.GetCharIndexByCaretIndex(CaretPositionIndex);
 		int32 TempCharIndex = CharIndexAtPressCaretPosition > CharIndexAtCaretPosition ? CharIndexAtCaretPosition : CharIndexAtPressCaretPosition;
 		auto CopyText = Text.Mid(TempCharIndex, FMath::Abs(CharIndexAtPressCaretPosition - CharIndexAtCaretPosition));
 		FPlatformApplicationMisc::ClipboardCopy(*CopyText);
-		
-		UpdateUITextComponent();
 	}
 }
 void UUITextInputComponent::Paste()
@@ -945,37 +940,102 @@ void UUITextInputComponent::UpdateAfterTextChange(bool InFireEvent)
 	}
 }
 
-FString UUITextInputComponent::GetReplaceText()const
+bool UUITextInputComponent::IsPasswordMode()const
 {
-	FString replaceText;
-	if (InputType == ELGUITextInputType::Password
-		|| DisplayType == ELGUITextInputDisplayType::Password)
+	return InputType == ELGUITextInputType::Password
+		|| DisplayType == ELGUITextInputDisplayType::Password;
+}
+const FString& UUITextInputComponent::GetReplaceText()const
+{
+	if (IsPasswordMode())
 	{
-		int len = Text.Len();
-		replaceText.Reset(len);
+		//mask chars are all same, so only add or remove the changed count
 		auto psChar = PasswordChar[0];
-		for (int i = 0; i < len; i++)
+		if (PasswordMaskText.Len() > 0 && PasswordMaskText[0] != psChar)
+		{
+			PasswordMaskText.Reset();
+		}
+		int len = Text.Len();
+		if (PasswordMaskText.Len() > len)
+		{
+			PasswordMaskText.LeftInline(len, false);
+		}
+		else
 		{
-			replaceText.AppendChar(psChar);
+			while (PasswordMaskText.Len() < len)
+			{
+				PasswordMaskText.AppendChar(psChar);
+			}
 		}
+		return PasswordMaskText;
 	}
-	else
+	return Text;
+}
+bool UUITextInputComponent::UpdateFullTextLayout()
+{
+	if (TextActor == nullptr)return false;
+	auto uiText = TextActor->GetUIText();
+	if (!uiText->GetRenderCanvas())return false;//need render canvas to calculate geometry
+	if (!IsValid(uiText->GetFont()))return false;
+	if (FullTextLayout.GetUIText() != uiText)
+	{
+		FullTextLayout = FTextGeometryCache(uiText, true);
+		bFullTextLayoutDirty = true;
+	}
+	const auto& replaceText = bFullTextLayoutDirty ? GetReplaceText() : FullTextLayout.GetContent();//not dirty means content is edited in place, no need to copy and compare the whole string
+	FullTextLayout.SetInputParameters(
+		replaceText
+		, bFullTextLayoutDirty ? UUIText::VisibleCharCountInString(replaceText) : FullTextLayout.GetVisibleCharCount()
+		, uiText->GetWidth()
+		, uiText->GetHeight()
+		, FVector2f(uiText->GetPivot().X, 1.0f)//vertical align from top, so height not affect layout and edit can apply in place. caret's Y position is not used in full text
+		, uiText->GetColor()
+		, FVector2f(uiText->GetFontSpace())
+		, uiText->GetFontSize()
+		, uiText->GetParagraphHorizontalAlignment()
+		, EUITextParagraphVerticalAlign::Top
+		, uiText->GetOverflowType()
+		, uiText->GetMaxHorizontalWidth()
+		, uiText->GetUseKerning()
+		, uiText->GetFontStyle()
+		, uiText->GetRichText()
+		, uiText->GetRichTextTagFilterFlags()
+		, uiText->GetFont()
+	);
+	bFullTextLayoutDirty = false;
+	FullTextLayout.ConditaionalCalculateGeometry();
+	return true;
+}
+void UUITextInputComponent::ReplaceTextRange(int32 InStartIndex, int32 InRemoveCount, const FString& InInsertString)
+{
+	if (!bFullTextLayoutDirty)//apply same change to full text layout, so it only layout the edited lines
 	{
-		replaceText = Text;
+		FString InsertReplaceText = IsPasswordMode() ? FString::ChrN(InInsertString.Len(), PasswordChar[0]) : InInsertString;
+		const auto& LayoutContent = FullTextLayout.GetContent();
+		int32 VisibleCharCountDelta = UUIText::VisibleCharCountInString(InsertReplaceText);
+		for (int i = InStartIndex, EndIndex = FMath::Min(InStartIndex + InRemoveCount, LayoutContent.Len()); i < EndIndex; i++)
+		{
+			if (UUIText::IsVisibleChar(LayoutContent[i]))
+			{
+				VisibleCharCountDelta--;
+			}
+		}
+		if (!FullTextLayout.ReplaceContent(InStartIndex, InRemoveCount, InsertReplaceText, VisibleCharCountDelta, FullTextLayout.GetGeometry()))
+		{
+			bFullTextLayoutDirty = true;//not support edit in place (eg: rich text or pixel perfect), layout full text again
+		}
 	}
-	return replaceText;
+	Text.RemoveAt(InStartIndex, InRemoveCount, false);
+	Text.InsertAt(InStartIndex, InInsertString);
+	UpdateFullTextLayout();
 }
 
 void UUITextInputComponent::MoveCaret(int32 moveType, bool withSelection)
 {
-	auto uiText = TextActor->GetUIText();
-	auto originText = uiText->GetText();
-	auto replaceText = GetReplaceText();
-	uiText->SetText(FText::FromString(replaceText));
-
+	if (!UpdateFullTextLayout())return;
 	auto CaretPosition3D = CaretObject->GetRelativeLocation();
 	auto CaretPosition = FVector2f(CaretPosition3D.Y, CaretPosition3D.Z);
-	if (uiText->MoveCaret(moveType, CaretPositionIndex, CaretPositionLineIndex, CaretPosition))
+	if (FullTextLayout.MoveCaret(moveType, CaretPositionIndex, CaretPositionLineIndex, CaretPosition))
 	{
 		UpdateUITextComponent();
 
@@ -983,7 +1043,7 @@ void UUITextInputComponent::MoveCaret(int32 moveType, bool withSelection)
 
 		if (withSelection)
 		{
-			uiText->GetSelectionProperty(PressCaretPositionIndex - VisibleCaretStartIndex, CaretPositionIndex - VisibleCaretStartIndex, SelectionPropertyArray);
+			TextActor->GetUIText()->GetSelectionProperty(PressCaretPositionIndex - VisibleCaretStartIndex, CaretPositionIndex - VisibleCaretStartIndex, SelectionPropertyArray);
 			UpdateSelection();
 		}
 		else
@@ -991,10 +1051,6 @@ void UUITextInputComponent::MoveCaret(int32 moveType, bool withSelection)
 			PressCaretPositionIndex = CaretPositionIndex;
 		}
 	}
-	else
-	{
-		uiText->SetText(originText);
-	}
 }
 
 void UUITextInputComponent::FireOnValueChangeEvent()
@@ -1007,11 +1063,12 @@ void UUITextInputComponent::UpdateUITextComponent()
 	if (TextActor != nullptr)
 	{
 		auto uiText = TextActor->GetUIText();
-		if (!uiText->GetRenderCanvas())return;//need render canvas to calculate geometry
-		auto replaceText = GetReplaceText();
-		//set to full text
-		uiText->SetText(FText::FromString(replaceText));
-		
+		//caret and visible range are calculated in full text layout, UIText only show visible part
+		if (!UpdateFullTextLayout())return;
+
+		int VisibleCharStartIndex = 0;
+		int VisibleCharCount = 0;
+		bool bOutOfRange = false;
 		if (bAllowMultiLine)//multi line, handle out of range chars
 		{
 			//recalculate MaxVisibleLineCount
@@ -1022,12 +1079,7 @@ void UUITextInputComponent::UpdateUITextComponent()
 					/ (SingleLineHeight + uiText->GetFontSpace().Y));
 			}
 
-			int VisibleCharStartIndex = 0;
-			int VisibleCharCount = 0;
-			if (uiText->GetVisibleCharRangeForMultiLine(CaretPositionIndex, CaretPositionLineIndex, VisibleCaretStartLineIndex, VisibleCaretStartIndex, MaxLineCount, VisibleCharStartIndex, VisibleCharCount))
-			{
-				replaceText = replaceText.Mid(VisibleCharStartIndex, VisibleCharCount);
-			}
+			bOutOfRange = FullTextLayout.GetVisibleCharRangeForMultiLine(CaretPositionIndex, CaretPositionLineIndex, VisibleCaretStartLineIndex, VisibleCaretStartIndex, MaxLineCount, VisibleCharStartIndex, VisibleCharCount);
 		}
 		else//single line, handle out of range chars
 		{
@@ -1036,14 +1088,16 @@ void UUITextInputComponent::UpdateUITextComponent()
 				: MaxLineWidth
 				;
 
-			int VisibleCharStartIndex = 0;
-			int VisibleCharCount = 0;
-			if (uiText->GetVisibleCharRangeForSingleLine(CaretPositionIndex, VisibleCaretStartIndex, maxWidth, VisibleCharStartIndex, VisibleCharCount))
-			{
-				replaceText = replaceText.Mid(VisibleCharStartIndex, VisibleCharCount);
-			}
+			bOutOfRange = FullTextLayout.GetVisibleCharRangeForSingleLine(CaretPositionIndex, VisibleCaretStartIndex, maxWidth, VisibleCharStartIndex, VisibleCharCount);
+		}
+		if (bOutOfRange)//only show visible chars
+		{
+			uiText->SetText(FText::FromString(GetReplaceText().Mid(VisibleCharStartIndex, VisibleCharCount)));
+		}
+		else//all chars are visible
+		{
+			uiText->SetText(FText::FromString(GetReplaceText()));
 		}
-		uiText->SetText(FText::FromString(replaceText));
 		
 #if WITH_EDITOR
 		if (auto world = this->GetWorld())
@@ -1361,8 +1415,10 @@ void UUITextInputComponent::ActivateInput(ULGUIPointerEventData* eventData)
 	if (bInputActive)
 	{
 		//if already active, then update caret position
-		TextActor->GetUIText()->SetText(FText::FromString(GetReplaceText()));
-		CaretPositionIndex = TextActor->GetUIText()->GetLastCaret();
+		if (UpdateFullTextLayout())
+		{
+			CaretPositionIndex = FullTextLayout.GetLastCaret();
+		}
 		UpdateUITextComponent();
 		UpdateCaretPosition();
 		return;
@@ -1638,6 +1694,7 @@ bool UUITextInputComponent::SetText(const FString& InText, bool InFireEvent)
 		}
 		
 		CaretPositionIndex = 0;
+		bFullTextLayoutDirty = true;
 		UpdateAfterTextChange(InFireEvent);
 	}
 	return true;
@@ -1648,6 +1705,7 @@ void UUITextInputComponent::SetInputType(ELGUITextInputType newValue)
 	{
 		InputType = newValue;
 		CaretPositionIndex = 0;
+		bFullTextLayoutDirty = true;
 		UpdateUITextComponent();
 	}
 }
@@ -1669,6 +1727,7 @@ void UUITextInputComponent::SetDisplayType(ELGUITextInputDisplayType newValue)
 	{
 		DisplayType = newValue;
 		CaretPositionIndex = 0;
+		bFullTextLayoutDirty = true;
 		UpdateUITextComponent();
 	}
 }
@@ -1681,8 +1740,9 @@ void UUITextInputComponent::SetPasswordChar(const FString& value)
 			return;
 		}
 		PasswordChar = value;
-		if (InputType == ELGUITextInputType::Password || DisplayType == ELGUITextInputDisplayType::Password)
+		if (IsPasswordMode())
 		{
+			bFullTextLayoutDirty = true;
 			UpdateUITextComponent();
 		}
 	}
@@ -2028,18 +2088,17 @@ void UUITextInputComponent::FTextInputMethodContext::GetTextInRange(const uint32
 }
 void UUITextInputComponent::FTextInputMethodContext::SetTextInRange(const uint32 BeginIndex, const uint32 Length, const FString& InString)
 {
-	InputComp->Text.RemoveAt(BeginIndex, Length);
-	int InsertCharCount = 0;
+	FString verifiedString;
 	for (int i = 0; i < InString.Len(); i++)
 	{
 		TCHAR c = InString[i];
 		if (InputComp->IsValidChar(c))
 		{
-			InputComp->Text.InsertAt(BeginIndex + InsertCharCount, c);
-			InsertCharCount++;
+			verifiedString.AppendChar(c);
 		}
 	}
-	InputComp->CaretPositionIndex = BeginIndex + InsertCharCount;
+	InputComp->ReplaceTextRange(BeginIndex, Length, verifiedString);
+	InputComp->CaretPositionIndex = BeginIndex + verifiedString.Len();
 	InputComp->UpdateAfterTextChange(false);
 #if LGUI_LOG_TextInputMethodContext
 	UE_LOG(LGUI, Log, TEXT("SetTextInRange, BeginIndex:%d, Length:%d, InString:%s"), BeginIndex, Length, *(InString));
@@ -8,6 +8,7 @@
 UUIToggleGroupComponent::UUIToggleGroupComponent()
 {
 	OnToggle = FLGUIEventDelegate(ELGUIEventDelegateParameterType::Int32);
+	MarkUpdateNotOverriddenBy(UUIToggleGroupComponent::StaticClass());
 }
 void UUIToggleGroupComponent::AddToggleComponent(UUIToggleComponent* InComp)
 {
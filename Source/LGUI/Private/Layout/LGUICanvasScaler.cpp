@@ -36,6 +36,7 @@ void ULGUICanvasScalerCustomScale::CalculateSizeAndScale(class ULGUICanvasScaler
 ULGUICanvasScaler::ULGUICanvasScaler()
 {
 	PrimaryComponentTick.bCanEverTick = false;
+	MarkUpdateNotOverriddenBy(ULGUICanvasScaler::StaticClass());
 }
 
 void ULGUICanvasScaler::Awake()
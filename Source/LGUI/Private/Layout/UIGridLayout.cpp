@@ -127,6 +127,8 @@ void UUIGridLayout::OnRebuildLayout()
 	const auto& uiChildrenList = GetLayoutUIItemChildren();
 	int childrenCount = uiChildrenList.Num();
 	float childWidth = CellSize.X, childHeight = CellSize.Y;
+	//cell's position and size only depend on it's index, so children before dirty one can keep last result
+	int arrangeStartIndex = GetArrangeStartIndex(true);
 
 	int maxItemCountInOneLine = FMath::Max(0, (int)LineCount);
 	if (!DependOnSizeOrCount)//depend on count
@@ -417,8 +419,6 @@ void UUIGridLayout::OnRebuildLayout()
 			{
 				RootUIItemHeight = tempActuralRange.Y + Padding.Top + Padding.Bottom;
 				ActuralRange = tempActuralRange;
-
-				ApplyHeightWithAnimation(tempAnimationType, RootUIItemHeight, RootUIComp.Get());
 			}
 		}
 	}
@@ -430,12 +430,23 @@ void UUIGridLayout::OnRebuildLayout()
 			{
 				RootUIItemWidth = tempActuralRange.X + Padding.Left + Padding.Right;
 				ActuralRange = tempActuralRange;
-
-				ApplyWidthWithAnimation(tempAnimationType, RootUIItemWidth, RootUIComp.Get());
 			}
 		}
 	}
 
+	BeginArrangeChildren();
+	//only apply size when changed, so parent layout will not be marked dirty
+	if (RootUIItemWidth != RootUIComp->GetWidth())
+	{
+		arrangeStartIndex = 0;
+		ApplyWidthWithAnimation(tempAnimationType, RootUIItemWidth, RootUIComp.Get());
+	}
+	if (RootUIItemHeight != RootUIComp->GetHeight())
+	{
+		arrangeStartIndex = 0;
+		ApplyHeightWithAnimation(tempAnimationType, RootUIItemHeight, RootUIComp.Get());
+	}
+
 	float posX = startPosition.X + posOffsetX, posY = startPosition.Y - posOffsetY;
 	tempItemCountPerLine = 0;
 	int tempLineIndex = 1;
@@ -491,6 +502,7 @@ void UUIGridLayout::OnRebuildLayout()
 			anchorOffsetY = posY - (1.0f - uiItem->GetPivot().Y) * childHeight;
 			posY -= childHeight + Spacing.Y;
 		}
+		if (i < arrangeStartIndex)continue;
 
 		auto AnchorMin = uiItem->GetAnchorMin();
 		auto AnchorMax = uiItem->GetAnchorMax();
@@ -506,6 +518,7 @@ void UUIGridLayout::OnRebuildLayout()
 		ApplyWidthWithAnimation(tempAnimationType, childWidth, uiItem.Get());
 		ApplyHeightWithAnimation(tempAnimationType, childHeight, uiItem.Get());
 	}
+	EndArrangeChildren(arrangeStartIndex);
 
 	if (tempAnimationType == EUILayoutAnimationType::EaseAnimation)
 	{
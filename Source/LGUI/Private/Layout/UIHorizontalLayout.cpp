@@ -16,11 +16,11 @@ void UUIHorizontalLayout::OnUIChildDimensionsChanged(UUIItem* child, bool horizo
     if (child->GetIsUIActiveInHierarchy())
     {
         if (horizontalPositionChanged || verticalPositionChanged
-            || (ExpandChildWidthArea && widthChanged)
+            || widthChanged//children after it need to move
             || (ExpandChildHeightArea && heightChanged)
             )
         {
-			MarkNeedRebuildLayout();
+            MarkNeedRebuildLayoutFromChild(child);
         }
     }
 }
@@ -137,6 +137,9 @@ void UUIHorizontalLayout::OnRebuildLayout()
     const auto& uiChildrenList = GetLayoutUIItemChildren();
     int childrenCount = uiChildrenList.Num();
     float childHeight = rectSize.Y;
+    bool bIsLeftAlign = Align == ELGUILayoutAlignmentType::UpperLeft || Align == ELGUILayoutAlignmentType::MiddleLeft || Align == ELGUILayoutAlignmentType::LowerLeft;
+    //if left align and not expand, child's position is only affected by children before it, so children before dirty one can keep last result
+    int arrangeStartIndex = childrenWidthList.Num() == childrenCount ? GetArrangeStartIndex(!ExpandChildWidthArea && bIsLeftAlign) : 0;
     childrenWidthList.SetNumUninitialized(childrenCount);
     if (ExpandChildWidthArea)
     {
@@ -147,25 +150,17 @@ void UUIHorizontalLayout::OnRebuildLayout()
         {
             auto& item = uiChildrenList[i];
             float tempChildWidth = 0;
-            if (item.LayoutInterface.IsValid())
-            {
-                auto layoutType = ILGUILayoutElementInterface::Execute_GetLayoutType(item.LayoutInterface.Get());
-                switch (layoutType)
-                {
-                case ELayoutElementType::AutoSize:
-                    autoSizeChildrenCount++;
-                    break;
-                case ELayoutElementType::ConstantSize:
-                    tempChildWidth = ILGUILayoutElementInterface::Execute_GetConstantSize(item.LayoutInterface.Get(), ELayoutElementSizeType::Horizontal);
-                    break;
-                case ELayoutElementType::RatioSize:
-                    tempChildWidth = ILGUILayoutElementInterface::Execute_GetRatioSize(item.LayoutInterface.Get(), ELayoutElementSizeType::Horizontal) * sizeWithoutSpacing;
-                    break;
-                }
-            }
-            else
+            switch (item.LayoutType)
             {
+            case ELayoutElementType::AutoSize:
                 autoSizeChildrenCount++;
+                break;
+            case ELayoutElementType::ConstantSize:
+                tempChildWidth = ILGUILayoutElementInterface::Execute_GetConstantSize(item.LayoutInterface.Get(), ELayoutElementSizeType::Horizontal);
+                break;
+            case ELayoutElementType::RatioSize:
+                tempChildWidth = ILGUILayoutElementInterface::Execute_GetRatioSize(item.LayoutInterface.Get(), ELayoutElementSizeType::Horizontal) * sizeWithoutSpacing;
+                break;
             }
             if (UseChildScaleOnWidth)
             {
@@ -180,17 +175,7 @@ void UUIHorizontalLayout::OnRebuildLayout()
         for (int i = 0; i < childrenCount; i++)
         {
             auto& item = uiChildrenList[i];
-            bool bCanCollectSize = false;
-            if (item.LayoutInterface != nullptr)
-            {
-                auto layoutType = ILGUILayoutElementInterface::Execute_GetLayoutType(item.LayoutInterface.Get());
-                bCanCollectSize = layoutType == ELayoutElementType::AutoSize;
-            }
-            else
-            {
-                bCanCollectSize = true;
-            }
-            if (bCanCollectSize)
+            if (item.LayoutType == ELayoutElementType::AutoSize)
             {
                 autoSizeChildScaleSum += UseChildScaleOnWidth ? item.ChildUIItem->GetRelativeScale3D().Y : 1.0f;
             }
@@ -202,17 +187,7 @@ void UUIHorizontalLayout::OnRebuildLayout()
             for (int i = 0; i < childrenCount; i++)
             {
                 auto& item = uiChildrenList[i];
-                bool bCanSetSize = false;
-                if (item.LayoutInterface != nullptr)
-                {
-                    auto layoutType = ILGUILayoutElementInterface::Execute_GetLayoutType(item.LayoutInterface.Get());
-                    bCanSetSize = layoutType == ELayoutElementType::AutoSize;
-                }
-                else
-                {
-                    bCanSetSize = true;
-                }
-                if (bCanSetSize)
+                if (item.LayoutType == ELayoutElementType::AutoSize)
                 {
                     auto childWidth = childAverangeWidth;
                     childrenWidthList[i].Width = childWidth;
@@ -230,17 +205,7 @@ void UUIHorizontalLayout::OnRebuildLayout()
             for (int i = 0; i < childrenCount; i++)
             {
                 auto& item = uiChildrenList[i];
-                bool bCanCollectSize = false;
-                if (item.LayoutInterface != nullptr)
-                {
-                    auto layoutType = ILGUILayoutElementInterface::Execute_GetLayoutType(item.LayoutInterface.Get());
-                    bCanCollectSize = layoutType == ELayoutElementType::AutoSize;
-                }
-                else
-                {
-                    bCanCollectSize = true;
-                }
-                if (bCanCollectSize)
+                if (item.LayoutType == ELayoutElementType::AutoSize)
                 {
                     auto childWidth = item.ChildUIItem->GetWidth();
                     if (UseChildScaleOnWidth)
@@ -255,17 +220,7 @@ void UUIHorizontalLayout::OnRebuildLayout()
             for (int i = 0; i < childrenCount; i++)
             {
                 auto& item = uiChildrenList[i];
-                bool bCanCollectSize = false;
-                if (item.LayoutInterface != nullptr)
-                {
-                    auto layoutType = ILGUILayoutElementInterface::Execute_GetLayoutType(item.LayoutInterface.Get());
-                    bCanCollectSize = layoutType == ELayoutElementType::AutoSize;
-                }
-                else
-                {
-                    bCanCollectSize = true;
-                }
-                if (bCanCollectSize)
+                if (item.LayoutType == ELayoutElementType::AutoSize)
                 {
                     auto childWidth = item.ChildUIItem->GetWidth();
                     float extraChildWidth;
@@ -334,20 +289,10 @@ void UUIHorizontalLayout::OnRebuildLayout()
         break;
         }
 
-        for (int i = 0; i < childrenCount; i++)
+        for (int i = arrangeStartIndex; i < childrenCount; i++)
         {
             auto& item = uiChildrenList[i];
-            bool bCanCollectSize = false;
-            if (item.LayoutInterface != nullptr)
-            {
-                auto layoutType = ILGUILayoutElementInterface::Execute_GetLayoutType(item.LayoutInterface.Get());
-                bCanCollectSize = layoutType == ELayoutElementType::AutoSize;
-            }
-            else
-            {
-                bCanCollectSize = true;
-            }
-            if (bCanCollectSize)
+            if (item.LayoutType == ELayoutElementType::AutoSize)
             {
                 auto childWidth = item.ChildUIItem->GetWidth();
                 childrenWidthList[i].Width = childWidth;
@@ -381,6 +326,10 @@ void UUIHorizontalLayout::OnRebuildLayout()
             childHeight = ChildUIItem->GetHeight();
         }
 
+        if (i == arrangeStartIndex)
+        {
+            posX = startPosition.X + tempActuralHorizontalRange + Spacing * i;
+        }
         tempActuralHorizontalRange += childWidthArea;
         if (tempVerticalMinSize > childHeight)
         {
@@ -402,17 +351,32 @@ void UUIHorizontalLayout::OnRebuildLayout()
     if (WidthFitToChildren && !ExpandChildWidthArea)
     {
         RootUIItemWidth = tempActuralHorizontalRange + Padding.Left + Padding.Right;
-        ApplyWidthWithAnimation(tempAnimationType, RootUIItemWidth, RootUIComp.Get());
     }
     if (HeightFitToChildren && !ExpandChildHeightArea)
     {
         tempVerticalMinSize += Padding.Bottom + Padding.Top;
         tempVerticalMaxSize += Padding.Bottom + Padding.Top;
         RootUIItemHeight = FMath::Lerp(tempVerticalMinSize, tempVerticalMaxSize, HeightFitToChildrenFromMinToMax);
+    }
+
+    BeginArrangeChildren();
+    //only apply size when changed, so parent layout will not be marked dirty
+    if (RootUIItemWidth != RootUIComp->GetWidth())
+    {
+        arrangeStartIndex = 0;
+        ApplyWidthWithAnimation(tempAnimationType, RootUIItemWidth, RootUIComp.Get());
+    }
+    if (RootUIItemHeight != RootUIComp->GetHeight())
+    {
+        arrangeStartIndex = 0;
         ApplyHeightWithAnimation(tempAnimationType, RootUIItemHeight, RootUIComp.Get());
     }
+    if (arrangeStartIndex == 0)
+    {
+        posX = startPosition.X;
+    }
 
-    for (int i = 0; i < childrenCount; i++)
+    for (int i = arrangeStartIndex; i < childrenCount; i++)
     {
         auto ChildUIItem = uiChildrenList[i].ChildUIItem;
         float childWidthArea = childrenWidthList[i].AreaWidth;
@@ -517,6 +481,7 @@ void UUIHorizontalLayout::OnRebuildLayout()
 
         posX += childWidthArea + Spacing;
     }
+    EndArrangeChildren(arrangeStartIndex);
 
 	if (tempAnimationType == EUILayoutAnimationType::EaseAnimation)
 	{
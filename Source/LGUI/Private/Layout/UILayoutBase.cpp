@@ -81,11 +81,15 @@ void UUILayoutBase::MarkNeedRebuildLayout()
 void UUILayoutBase::OnUIDimensionsChanged(bool horizontalPositionChanged, bool verticalPositionChanged, bool widthChanged, bool heightChanged)
 {
     Super::OnUIDimensionsChanged(horizontalPositionChanged, verticalPositionChanged, widthChanged, heightChanged);
-    if (horizontalPositionChanged || verticalPositionChanged || widthChanged || heightChanged)
+    if (NeedRebuildLayoutOnDimensionsChanged(horizontalPositionChanged, verticalPositionChanged, widthChanged, heightChanged))
     {
         MarkNeedRebuildLayout();
     }
 }
+bool UUILayoutBase::NeedRebuildLayoutOnDimensionsChanged(bool horizontalPositionChanged, bool verticalPositionChanged, bool widthChanged, bool heightChanged)const
+{
+    return horizontalPositionChanged || verticalPositionChanged || widthChanged || heightChanged;
+}
 void UUILayoutBase::OnUIAttachmentChanged()
 {
     Super::OnUIAttachmentChanged();
@@ -4,6 +4,7 @@
 #include "LGUI.h"
 #include "Core/ActorComponent/UIItem.h"
 #include "LTweenManager.h"
+#include "LTweener.h"
 #include "LTweenBPLibrary.h"
 #include "Core/LGUISettings.h"
 
@@ -73,17 +74,18 @@ void UUILayoutWithAnimation::BeginSetupAnimations()
 }
 void UUILayoutWithAnimation::CancelAllAnimations(bool callComplete)
 {
-	if (TweenerArray.Num() > 0)
+	if (IsValid(EaseAnimationTweener))
 	{
-		for (auto item : TweenerArray)
+		if (callComplete)
 		{
-			if (IsValid(item))
-			{
-				ULTweenBPLibrary::KillIfIsTweening(this, item, callComplete);
-			}
+			UpdateEaseAnimation(1.0f);
 		}
-		TweenerArray.Reset();
+		auto Tweener = EaseAnimationTweener;
+		EaseAnimationTweener = nullptr;
+		ULTweenBPLibrary::KillIfIsTweening(this, Tweener, callComplete);
 	}
+	EaseAnimationTweener = nullptr;
+	EaseAnimationItemArray.Reset();
 	bIsAnimationPlaying = false;
 }
 
@@ -93,16 +95,11 @@ void UUILayoutWithAnimation::EndSetupAnimations()
 	{
 		CustomAnimation->EndSetupAnimations();
 	}
+	if (EaseAnimationItemArray.Num() == 0)return;//nothing changed, no need to wait for animation
+
 	bIsAnimationPlaying = true;
-	auto Tweener = ULTweenManager::VirtualTo(this, AnimationDuration)->OnComplete(FSimpleDelegate::CreateWeakLambda(this, [this] {
-		bIsAnimationPlaying = false;
-		if (bShouldRebuildLayoutAfterAnimation)
-		{
-			bShouldRebuildLayoutAfterAnimation = false;
-			MarkNeedRebuildLayout();
-		}
-		}));
-	if (Tweener)
+	EaseAnimationTweener = ULTweenManager::VirtualTo(this, AnimationDuration);
+	if (EaseAnimationTweener)
 	{
 		bool bAffectByGamePause = false;
 		bool bAffectByTimeDilation = false;
@@ -119,11 +116,80 @@ void UUILayoutWithAnimation::EndSetupAnimations()
 				bAffectByTimeDilation = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByTimeDilation;
 			}
 		}
-		Tweener->SetAffectByGamePause(bAffectByGamePause)->SetAffectByTimeDilation(bAffectByTimeDilation);
-		TweenerArray.Add(Tweener);
+		EaseAnimationTweener
+			->OnUpdate(FLTweenUpdateDelegate::CreateUObject(this, &UUILayoutWithAnimation::UpdateEaseAnimation))
+			->OnComplete(FSimpleDelegate::CreateUObject(this, &UUILayoutWithAnimation::OnEaseAnimationComplete))
+			->SetAffectByGamePause(bAffectByGamePause)->SetAffectByTimeDilation(bAffectByTimeDilation);
+	}
+	else//can't create tweener, eg: no LTween instance, just jump to end
+	{
+		UpdateEaseAnimation(1.0f);
+		OnEaseAnimationComplete();
 	}
 }
 
+UUILayoutWithAnimation::FEaseAnimationItem& UUILayoutWithAnimation::GetEaseAnimationItem(UUIItem* Target)
+{
+	//layout apply all values of a target before next target, so check last one is enough
+	if (EaseAnimationItemArray.Num() > 0 && EaseAnimationItemArray.Last().Target.Get() == Target)
+	{
+		return EaseAnimationItemArray.Last();
+	}
+	auto& Item = EaseAnimationItemArray.AddDefaulted_GetRef();
+	Item.Target = Target;
+	return Item;
+}
+void UUILayoutWithAnimation::UpdateEaseAnimation(float InProgress)
+{
+	float Alpha = ULTweener::InOutSine(1.0f, 0.0f, InProgress, 1.0f);
+	TGuardValue<bool> ApplyingGuard(bIsApplyingEaseAnimation, true);
+	for (auto& Item : EaseAnimationItemArray)
+	{
+		auto Target = Item.Target.Get();
+		if (Target == nullptr)continue;
+		if (Item.bAnimateWidth)
+		{
+			Target->SetWidth(FMath::Lerp(Item.StartWidth, Item.EndWidth, Alpha));
+		}
+		if (Item.bAnimateHeight)
+		{
+			Target->SetHeight(FMath::Lerp(Item.StartHeight, Item.EndHeight, Alpha));
+		}
+		if (Item.bAnimateSizeDelta)
+		{
+			Target->SetSizeDelta(FMath::Lerp(Item.StartSizeDelta, Item.EndSizeDelta, Alpha));
+		}
+		if (Item.bAnimateAnchoredPosition)
+		{
+			Target->SetAnchoredPosition(FMath::Lerp(Item.StartAnchoredPosition, Item.EndAnchoredPosition, Alpha));
+		}
+		if (Item.bAnimateRotator)
+		{
+			Target->SetRelativeRotation(Item.StartRotator + (Item.EndRotator - Item.StartRotator) * Alpha);
+		}
+	}
+}
+void UUILayoutWithAnimation::OnEaseAnimationComplete()
+{
+	EaseAnimationTweener = nullptr;
+	EaseAnimationItemArray.Reset();
+	bIsAnimationPlaying = false;
+	if (bShouldRebuildLayoutAfterAnimation)
+	{
+		bShouldRebuildLayoutAfterAnimation = false;
+		MarkNeedRebuildLayoutAfterAnimation();
+	}
+}
+void UUILayoutWithAnimation::MarkNeedRebuildLayoutAfterAnimation()
+{
+	MarkNeedRebuildLayout();
+}
+bool UUILayoutWithAnimation::NeedRebuildLayoutOnDimensionsChanged(bool horizontalPositionChanged, bool verticalPositionChanged, bool widthChanged, bool heightChanged)const
+{
+	if (bIsApplyingEaseAnimation)return false;
+	return Super::NeedRebuildLayoutOnDimensionsChanged(horizontalPositionChanged, verticalPositionChanged, widthChanged, heightChanged);
+}
+
 void UUILayoutWithAnimation::ApplyAnchoredPositionWithAnimation(EUILayoutAnimationType tempAnimationType, FVector2D Value, UUIItem* Target)
 {
 	switch (tempAnimationType)
@@ -138,30 +204,10 @@ void UUILayoutWithAnimation::ApplyAnchoredPositionWithAnimation(EUILayoutAnimati
 	{
 		if (Target->GetAnchoredPosition() != Value)
 		{
-			auto Tweener = ULTweenManager::To(Target
-				, FLTweenVector2DGetterFunction::CreateUObject(Target, &UUIItem::GetAnchoredPosition)
-				, FLTweenVector2DSetterFunction::CreateUObject(Target, &UUIItem::SetAnchoredPosition)
-				, Value, AnimationDuration);
-			if (Tweener)
-			{
-				bool bAffectByGamePause = false;
-				bool bAffectByTimeDilation = false;
-				if (this->GetRootUIComponent())
-				{
-					if (this->GetRootUIComponent()->IsScreenSpaceOverlayUI())
-					{
-						bAffectByGamePause = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByGamePause;
-						bAffectByTimeDilation = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByTimeDilation;
-					}
-					else
-					{
-						bAffectByGamePause = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByGamePause;
-						bAffectByTimeDilation = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByTimeDilation;
-					}
-				}
-				Tweener->SetEase(ELTweenEase::InOutSine)->SetAffectByGamePause(bAffectByGamePause)->SetAffectByTimeDilation(bAffectByTimeDilation);
-				TweenerArray.Add(Tweener);
-			}
+			auto& Item = GetEaseAnimationItem(Target);
+			Item.bAnimateAnchoredPosition = true;
+			Item.StartAnchoredPosition = Target->GetAnchoredPosition();
+			Item.EndAnchoredPosition = Value;
 		}
 	}
 	break;
@@ -194,27 +240,10 @@ void UUILayoutWithAnimation::ApplyRotatorWithAnimation(EUILayoutAnimationType te
 	{
 		if (Target->GetRelativeRotation() != Value)
 		{
-			auto Tweener = ULTweenBPLibrary::LocalRotatorTo(Target, Value, false, AnimationDuration, 0, ELTweenEase::InOutSine);
-			if (Tweener)
-			{
-				bool bAffectByGamePause = false;
-				bool bAffectByTimeDilation = false;
-				if (this->GetRootUIComponent())
-				{
-					if (this->GetRootUIComponent()->IsScreenSpaceOverlayUI())
-					{
-						bAffectByGamePause = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByGamePause;
-						bAffectByTimeDilation = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByTimeDilation;
-					}
-					else
-					{
-						bAffectByGamePause = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByGamePause;
-						bAffectByTimeDilation = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByTimeDilation;
-					}
-				}
-				Tweener->SetAffectByGamePause(bAffectByGamePause)->SetAffectByTimeDilation(bAffectByTimeDilation);
-				TweenerArray.Add(Tweener);
-			}
+			auto& Item = GetEaseAnimationItem(Target);
+			Item.bAnimateRotator = true;
+			Item.StartRotator = Target->GetRelativeRotation();
+			Item.EndRotator = Value;
 		}
 	}
 	break;
@@ -247,30 +276,10 @@ void UUILayoutWithAnimation::ApplyWidthWithAnimation(EUILayoutAnimationType temp
 	{
 		if (Target->GetWidth() != Value)
 		{
-			auto Tweener = ULTweenManager::To(Target
-				, FLTweenFloatGetterFunction::CreateUObject(Target, &UUIItem::GetWidth)
-				, FLTweenFloatSetterFunction::CreateUObject(Target, &UUIItem::SetWidth)
-				, Value, AnimationDuration);
-			if (Tweener)
-			{
-				bool bAffectByGamePause = false;
-				bool bAffectByTimeDilation = false;
-				if (this->GetRootUIComponent())
-				{
-					if (this->GetRootUIComponent()->IsScreenSpaceOverlayUI())
-					{
-						bAffectByGamePause = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByGamePause;
-						bAffectByTimeDilation = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByTimeDilation;
-					}
-					else
-					{
-						bAffectByGamePause = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByGamePause;
-						bAffectByTimeDilation = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByTimeDilation;
-					}
-				}
-				Tweener->SetEase(ELTweenEase::InOutSine)->SetAffectByGamePause(bAffectByGamePause)->SetAffectByTimeDilation(bAffectByTimeDilation);
-				TweenerArray.Add(Tweener);
-			}
+			auto& Item = GetEaseAnimationItem(Target);
+			Item.bAnimateWidth = true;
+			Item.StartWidth = Target->GetWidth();
+			Item.EndWidth = Value;
 		}
 	}
 	break;
@@ -303,30 +312,10 @@ void UUILayoutWithAnimation::ApplyHeightWithAnimation(EUILayoutAnimationType tem
 	{
 		if (Target->GetHeight() != Value)
 		{
-			auto Tweener = ULTweenManager::To(Target
-				, FLTweenFloatGetterFunction::CreateUObject(Target, &UUIItem::GetHeight)
-				, FLTweenFloatSetterFunction::CreateUObject(Target, &UUIItem::SetHeight)
-				, Value, AnimationDuration);
-			if (Tweener)
-			{
-				bool bAffectByGamePause = false;
-				bool bAffectByTimeDilation = false;
-				if (this->GetRootUIComponent())
-				{
-					if (this->GetRootUIComponent()->IsScreenSpaceOverlayUI())
-					{
-						bAffectByGamePause = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByGamePause;
-						bAffectByTimeDilation = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByTimeDilation;
-					}
-					else
-					{
-						bAffectByGamePause = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByGamePause;
-						bAffectByTimeDilation = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByTimeDilation;
-					}
-				}
-				Tweener->SetEase(ELTweenEase::InOutSine)->SetAffectByGamePause(bAffectByGamePause)->SetAffectByTimeDilation(bAffectByTimeDilation);
-				TweenerArray.Add(Tweener);
-			}
+			auto& Item = GetEaseAnimationItem(Target);
+			Item.bAnimateHeight = true;
+			Item.StartHeight = Target->GetHeight();
+			Item.EndHeight = Value;
 		}
 	}
 	break;
@@ -359,30 +348,10 @@ void UUILayoutWithAnimation::ApplySizeDeltaWithAnimation(EUILayoutAnimationType
 	{
 		if (Target->GetSizeDelta() != Value)
 		{
-			auto Tweener = ULTweenManager::To(Target
-				, FLTweenVector2DGetterFunction::CreateUObject(Target, &UUIItem::GetSizeDelta)
-				, FLTweenVector2DSetterFunction::CreateUObject(Target, &UUIItem::SetSizeDelta)
-				, Value, AnimationDuration);
-			if (Tweener)
-			{
-				bool bAffectByGamePause = false;
-				bool bAffectByTimeDilation = false;
-				if (this->GetRootUIComponent())
-				{
-					if (this->GetRootUIComponent()->IsScreenSpaceOverlayUI())
-					{
-						bAffectByGamePause = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByGamePause;
-						bAffectByTimeDilation = GetDefault<ULGUISettings>()->bScreenSpaceUIAffectByTimeDilation;
-					}
-					else
-					{
-						bAffectByGamePause = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByGamePause;
-						bAffectByTimeDilation = GetDefault<ULGUISettings>()->bWorldSpaceUIAffectByTimeDilation;
-					}
-				}
-				Tweener->SetEase(ELTweenEase::InOutSine)->SetAffectByGamePause(bAffectByGamePause)->SetAffectByTimeDilation(bAffectByTimeDilation);
-				TweenerArray.Add(Tweener);
-			}
+			auto& Item = GetEaseAnimationItem(Target);
+			Item.bAnimateSizeDelta = true;
+			Item.StartSizeDelta = Target->GetSizeDelta();
+			Item.EndSizeDelta = Value;
 		}
 	}
 	break;
@@ -9,6 +9,7 @@ UUILayoutWithChildren::UUILayoutWithChildren()
 {
 	bNeedRebuildChildrenList = true;
 	bNeedSortChildrenList = true;
+	bIsArrangingChildren = false;
 }
 
 void UUILayoutWithChildren::Awake()
@@ -52,17 +53,11 @@ void UUILayoutWithChildren::RebuildChildrenList()const
             if (UIChild->GetIsUIActiveInHierarchy())
             {
                 if (UIChild->GetOwner()->GetRootComponent() != UIChild)continue;//only use root component
-                UObject* layoutElement = nullptr;
-                bool ignoreLayout = false;
-                GetLayoutElement(UIChild, layoutElement, ignoreLayout);
-                if (ignoreLayout)
+                FLayoutChild child;
+                if (!MakeLayoutChild(UIChild, child))
                 {
                     continue;
                 }
-
-                FLayoutChild child;
-                child.ChildUIItem = UIChild;
-                child.LayoutInterface = layoutElement;
                 LayoutUIItemChildrenArray.Add(child);
             }
         }
@@ -72,7 +67,7 @@ void UUILayoutWithChildren::RebuildChildrenList()const
 
 void UUILayoutWithChildren::SortChildrenList()const
 {
-    LayoutUIItemChildrenArray.Sort([](FLayoutChild A, FLayoutChild B) //sort children by HierarchyIndex
+    LayoutUIItemChildrenArray.Sort([](const FLayoutChild& A, const FLayoutChild& B) //sort children by HierarchyIndex
         {
             if (A.ChildUIItem->GetHierarchyIndex() < B.ChildUIItem->GetHierarchyIndex())
                 return true;
@@ -90,17 +85,34 @@ void UUILayoutWithChildren::GetLayoutElement(UUIItem* InChild, UObject*& OutLayo
     }
 }
 
+bool UUILayoutWithChildren::MakeLayoutChild(UUIItem* InChild, FLayoutChild& OutChild)const
+{
+    UObject* layoutElement = nullptr;
+    bool ignoreLayout = false;
+    GetLayoutElement(InChild, layoutElement, ignoreLayout);
+    if (ignoreLayout)
+    {
+        return false;
+    }
+    OutChild.ChildUIItem = InChild;
+    OutChild.LayoutInterface = layoutElement;
+    OutChild.LayoutType = layoutElement != nullptr ? ILGUILayoutElementInterface::Execute_GetLayoutType(layoutElement) : ELayoutElementType::AutoSize;
+    return true;
+}
+
 const TArray<UUILayoutWithChildren::FLayoutChild>& UUILayoutWithChildren::GetLayoutUIItemChildren()const
 {
     if (bNeedRebuildChildrenList)
     {
         bNeedRebuildChildrenList = false;
         bNeedSortChildrenList = false;
+        DirtyChildIndex = 0;
         RebuildChildrenList();
     }
     else if (bNeedSortChildrenList)
     {
         bNeedSortChildrenList = false;
+        DirtyChildIndex = 0;
         SortChildrenList();
     }
     return LayoutUIItemChildrenArray;
@@ -111,9 +123,15 @@ void UUILayoutWithChildren::OnUIChildDimensionsChanged(UUIItem* child, bool hori
     Super::OnUIChildDimensionsChanged(child, horizontalPositionChanged, verticalPositionChanged, widthChanged, heightChanged);
     if (horizontalPositionChanged || verticalPositionChanged || widthChanged || heightChanged)
     {
-        MarkNeedRebuildLayout();
+        MarkNeedRebuildLayoutFromChild(child);
     }
 }
+bool UUILayoutWithChildren::NeedRebuildLayoutOnDimensionsChanged(bool horizontalPositionChanged, bool verticalPositionChanged, bool widthChanged, bool heightChanged)const
+{
+    if (bIsArrangingChildren)return false;//size is set by layout itself, children already use the new size
+    //children are arranged in local space, so only size change need to rebuild
+    return (widthChanged || heightChanged) && Super::NeedRebuildLayoutOnDimensionsChanged(horizontalPositionChanged, verticalPositionChanged, widthChanged, heightChanged);
+}
 void UUILayoutWithChildren::OnUIChildAcitveInHierarchy(UUIItem* InChild, bool InUIActive)
 {
     Super::OnUIChildAcitveInHierarchy(InChild, InUIActive);
@@ -125,14 +143,10 @@ void UUILayoutWithChildren::OnUIChildAcitveInHierarchy(UUIItem* InChild, bool In
         EnsureChildValid();
         if (!LayoutUIItemChildrenArray.Find(childData, index))
         {
-            UObject* layoutElement = nullptr;
-            bool ignoreLayout = false;
-            GetLayoutElement(InChild, layoutElement, ignoreLayout);
-            if (ignoreLayout)
+            if (!MakeLayoutChild(InChild, childData))
             {
                 return;
             }
-            childData.LayoutInterface = layoutElement;
             LayoutUIItemChildrenArray.Add(childData);
             bNeedSortChildrenList = true;
         }
@@ -159,14 +173,10 @@ void UUILayoutWithChildren::OnUIChildAttachmentChanged(UUIItem* InChild, bool at
         EnsureChildValid();
         if (!LayoutUIItemChildrenArray.Find(childData, index))
         {
-            UObject* layoutElement = nullptr;
-            bool ignoreLayout = false;
-            GetLayoutElement(InChild, layoutElement, ignoreLayout);
-            if (ignoreLayout)
+            if (!MakeLayoutChild(InChild, childData))
             {
                 return;
             }
-            childData.LayoutInterface = layoutElement;
             LayoutUIItemChildrenArray.Add(childData);
             bNeedSortChildrenList = true;
         }
@@ -195,6 +205,118 @@ void UUILayoutWithChildren::OnUIChildHierarchyIndexChanged(UUIItem* InChild)
     MarkNeedRebuildLayout();
 }
 
+void UUILayoutWithChildren::MarkNeedRebuildLayout()
+{
+    DirtyChildIndex = 0;
+    Super::MarkNeedRebuildLayout();
+}
+
+void UUILayoutWithChildren::MarkNeedRebuildLayoutAfterAnimation()
+{
+    Super::MarkNeedRebuildLayout();
+}
+
+void UUILayoutWithChildren::MarkNeedRebuildLayoutFromChild(UUIItem* InChild)
+{
+    if (bIsArrangingChildren || bIsApplyingEaseAnimation)return;//change is made by layout itself
+    if (bNeedRebuildChildrenList || bNeedSortChildrenList)
+    {
+        MarkNeedRebuildLayout();
+        return;
+    }
+    auto Index = LayoutUIItemChildrenArray.IndexOfByPredicate([InChild](const FLayoutChild& Item) {
+        return Item.ChildUIItem.Get() == InChild;
+        });
+    if (Index == INDEX_NONE)return;
+    const auto& Child = LayoutUIItemChildrenArray[Index];
+    const auto& AnchorData = InChild->GetAnchorData();
+    if (Child.bArranged
+        && Child.ArrangedAnchorData.AnchoredPosition == AnchorData.AnchoredPosition
+        && Child.ArrangedAnchorData.Pivot == AnchorData.Pivot
+        && Child.ArrangedAnchorData.AnchorMin == AnchorData.AnchorMin
+        && Child.ArrangedAnchorData.AnchorMax == AnchorData.AnchorMax
+        && Child.ArrangedSize.X == InChild->GetWidth()
+        && Child.ArrangedSize.Y == InChild->GetHeight()
+        && Child.ArrangedScale == InChild->GetRelativeScale3D()
+        )
+    {
+        return;//not changed since last arrange, eg: parent's transform change
+    }
+    DirtyChildIndex = FMath::Min(DirtyChildIndex, Index);
+    if (bIsAnimationPlaying)//arranged values are animation targets, rebuild from this child after animation
+    {
+        bShouldRebuildLayoutAfterAnimation = true;
+        return;
+    }
+    Super::MarkNeedRebuildLayout();
+}
+
+int32 UUILayoutWithChildren::GetArrangeStartIndex(bool bCanArrangePartially)const
+{
+    if (!bCanArrangePartially || DirtyChildIndex == MAX_int32)//MAX_int32 means no dirty mark since last arrange, rebuild is called directly, so arrange all
+    {
+        return 0;
+    }
+    return FMath::Min(DirtyChildIndex, LayoutUIItemChildrenArray.Num());
+}
+
+void UUILayoutWithChildren::BeginArrangeChildren()
+{
+    bIsArrangingChildren = true;
+}
+
+void UUILayoutWithChildren::EndArrangeChildren(int32 InStartIndex)
+{
+    bIsArrangingChildren = false;
+    for (int i = InStartIndex; i < LayoutUIItemChildrenArray.Num(); i++)
+    {
+        auto& Child = LayoutUIItemChildrenArray[i];
+        if (auto ChildUIItem = Child.ChildUIItem.Get())
+        {
+            Child.bArranged = true;
+            Child.ArrangedAnchorData = ChildUIItem->GetAnchorData();
+            Child.ArrangedSize = FVector2D(ChildUIItem->GetWidth(), ChildUIItem->GetHeight());
+            Child.ArrangedScale = ChildUIItem->GetRelativeScale3D();
+        }
+    }
+    //EaseAnimation only start tween after arrange, so record target values, otherwise child will be treated as changed when tween finish
+    for (const auto& Item : EaseAnimationItemArray)
+    {
+        auto Target = Item.Target.Get();
+        if (Target == nullptr)continue;
+        auto Index = LayoutUIItemChildrenArray.IndexOfByPredicate([Target](const FLayoutChild& Child) {
+            return Child.ChildUIItem.Get() == Target;
+            });
+        if (Index < InStartIndex)continue;//also skip INDEX_NONE
+        auto& Child = LayoutUIItemChildrenArray[Index];
+        if (Item.bAnimateAnchoredPosition)
+        {
+            Child.ArrangedAnchorData.AnchoredPosition = Item.EndAnchoredPosition;
+        }
+        if (Item.bAnimateSizeDelta)
+        {
+            Child.ArrangedAnchorData.SizeDelta = Item.EndSizeDelta;
+            if (Child.ArrangedAnchorData.AnchorMin.X == Child.ArrangedAnchorData.AnchorMax.X)
+            {
+                Child.ArrangedSize.X = Item.EndSizeDelta.X;
+            }
+            if (Child.ArrangedAnchorData.AnchorMin.Y == Child.ArrangedAnchorData.AnchorMax.Y)
+            {
+                Child.ArrangedSize.Y = Item.EndSizeDelta.Y;
+            }
+        }
+        if (Item.bAnimateWidth)
+        {
+            Child.ArrangedSize.X = Item.EndWidth;
+        }
+        if (Item.bAnimateHeight)
+        {
+            Child.ArrangedSize.Y = Item.EndHeight;
+        }
+    }
+    DirtyChildIndex = MAX_int32;
+}
+
 void UUILayoutWithChildren::MarkRebuildLayout_Implementation()
 {
     Super::MarkRebuildLayout_Implementation();
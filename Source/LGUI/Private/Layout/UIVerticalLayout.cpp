@@ -17,10 +17,10 @@ void UUIVerticalLayout::OnUIChildDimensionsChanged(UUIItem* child, bool horizont
     {
         if (horizontalPositionChanged || verticalPositionChanged
             || (ExpandChildWidthArea && widthChanged)
-            || (ExpandChildHeightArea && heightChanged)
+            || heightChanged//children after it need to move
             )
         {
-            MarkNeedRebuildLayout();
+            MarkNeedRebuildLayoutFromChild(child);
         }
     }
 }
@@ -137,6 +137,9 @@ void UUIVerticalLayout::OnRebuildLayout()
     const auto& uiChildrenList = GetLayoutUIItemChildren();
     int childrenCount = uiChildrenList.Num();
     float childWidth = rectSize.X;
+    bool bIsUpperAlign = Align == ELGUILayoutAlignmentType::UpperLeft || Align == ELGUILayoutAlignmentType::UpperCenter || Align == ELGUILayoutAlignmentType::UpperRight;
+    //if upper align and not expand, child's position is only affected by children before it, so children before dirty one can keep last result
+    int arrangeStartIndex = childrenHeightList.Num() == childrenCount ? GetArrangeStartIndex(!ExpandChildHeightArea && bIsUpperAlign) : 0;
     childrenHeightList.SetNumUninitialized(childrenCount);
     if (ExpandChildHeightArea)
     {
@@ -147,25 +150,17 @@ void UUIVerticalLayout::OnRebuildLayout()
         {
             auto& item = uiChildrenList[i];
             float tempChildHeight = 0;
-            if (item.LayoutInterface != nullptr)
-            {
-                auto layoutType = ILGUILayoutElementInterface::Execute_GetLayoutType(item.LayoutInterface.Get());
-                switch (layoutType)
-                {
-                case ELayoutElementType::AutoSize:
-                    autoSizeChildrenCount++;
-                    break;
-                case ELayoutElementType::ConstantSize:
-                    tempChildHeight = ILGUILayoutElementInterface::Execute_GetConstantSize(item.LayoutInterface.Get(), ELayoutElementSizeType::Vertical);
-                    break;
-                case ELayoutElementType::RatioSize:
-                    tempChildHeight = ILGUILayoutElementInterface::Execute_GetRatioSize(item.LayoutInterface.Get(), ELayoutElementSizeType::Vertical) * sizeWithoutSpacing;
-                    break;
-                }
-            }
-            else
+            switch (item.LayoutType)
             {
+            case ELayoutElementType::AutoSize:
                 autoSizeChildrenCount++;
+                break;
+            case ELayoutElementType::ConstantSize:
+                tempChildHeight = ILGUILayoutElementInterface::Execute_GetConstantSize(item.LayoutInterface.Get(), ELayoutElementSizeType::Vertical);
+                break;
+            case ELayoutElementType::RatioSize:
+                tempChildHeight = ILGUILayoutElementInterface::Execute_GetRatioSize(item.LayoutInterface.Get(), ELayoutElementSizeType::Vertical) * sizeWithoutSpacing;
+                break;
             }
             if (UseChildScaleOnHeight)
             {
@@ -180,17 +175,7 @@ void UUIVerticalLayout::OnRebuildLayout()
         for (int i = 0; i < childrenCount; i++)
         {
             auto& item = uiChildrenList[i];
-            bool bCanCollectSize = false;
-            if (item.LayoutInterface != nullptr)
-            {
-                auto layoutType = ILGUILayoutElementInterface::Execute_GetLayoutType(item.LayoutInterface.Get());
-                bCanCollectSize = layoutType == ELayoutElementType::AutoSize;
-            }
-            else
-            {
-                bCanCollectSize = true;
-            }
-            if (bCanCollectSize)
+            if (item.LayoutType == ELayoutElementType::AutoSize)
             {
                 autoSizeChildScaleSum += UseChildScaleOnHeight ? item.ChildUIItem->GetRelativeScale3D().Z : 1.0f;
             }
@@ -202,17 +187,7 @@ void UUIVerticalLayout::OnRebuildLayout()
             for (int i = 0; i < childrenCount; i++)
             {
                 auto& item = uiChildrenList[i];
-                bool bCanSetSize = false;
-                if (item.LayoutInterface != nullptr)
-                {
-                    auto layoutType = ILGUILayoutElementInterface::Execute_GetLayoutType(item.LayoutInterface.Get());
-                    bCanSetSize = layoutType == ELayoutElementType::AutoSize;
-                }
-                else
-                {
-                    bCanSetSize = true;
-                }
-                if (bCanSetSize)
+                if (item.LayoutType == ELayoutElementType::AutoSize)
                 {
                     auto childHeight = childAverangeHeight;
                     childrenHeightList[i].Height = childHeight;
@@ -230,17 +205,7 @@ void UUIVerticalLayout::OnRebuildLayout()
             for (int i = 0; i < childrenCount; i++)
             {
                 auto& item = uiChildrenList[i];
-                bool bCanCollectSize = false;
-                if (item.LayoutInterface != nullptr)
-                {
-                    auto layoutType = ILGUILayoutElementInterface::Execute_GetLayoutType(item.LayoutInterface.Get());
-                    bCanCollectSize = layoutType == ELayoutElementType::AutoSize;
-                }
-                else
-                {
-                    bCanCollectSize = true;
-                }
-                if (bCanCollectSize)
+                if (item.LayoutType == ELayoutElementType::AutoSize)
                 {
                     auto childHeight = item.ChildUIItem->GetHeight();
                     if (UseChildScaleOnHeight)
@@ -255,17 +220,7 @@ void UUIVerticalLayout::OnRebuildLayout()
             for (int i = 0; i < childrenCount; i++)
             {
                 auto& item = uiChildrenList[i];
-                bool bCanCollectSize = false;
-                if (item.LayoutInterface != nullptr)
-                {
-                    auto layoutType = ILGUILayoutElementInterface::Execute_GetLayoutType(item.LayoutInterface.Get());
-                    bCanCollectSize = layoutType == ELayoutElementType::AutoSize;
-                }
-                else
-                {
-                    bCanCollectSize = true;
-                }
-                if (bCanCollectSize)
+                if (item.LayoutType == ELayoutElementType::AutoSize)
                 {
                     auto childHeight = item.ChildUIItem->GetHeight();
                     float extraChildHeight;
@@ -334,20 +289,10 @@ void UUIVerticalLayout::OnRebuildLayout()
         break;
         }
 
-        for (int i = 0; i < childrenCount; i++)
+        for (int i = arrangeStartIndex; i < childrenCount; i++)
         {
             auto& item = uiChildrenList[i];
-            bool bCanCollectSize = false;
-            if (item.LayoutInterface != nullptr)
-            {
-                auto layoutType = ILGUILayoutElementInterface::Execute_GetLayoutType(item.LayoutInterface.Get());
-                bCanCollectSize = layoutType == ELayoutElementType::AutoSize;
-            }
-            else
-            {
-                bCanCollectSize = true;
-            }
-            if (bCanCollectSize)
+            if (item.LayoutType == ELayoutElementType::AutoSize)
             {
                 auto childHeight = item.ChildUIItem->GetHeight();
                 childrenHeightList[i].Height = childHeight;
@@ -381,6 +326,10 @@ void UUIVerticalLayout::OnRebuildLayout()
         }
         float childHeightArea = childrenHeightList[i].AreaHeight;
 
+        if (i == arrangeStartIndex)
+        {
+            posY = startPosition.Y - tempActuralVerticalRange - Spacing * i;
+        }
         tempActuralVerticalRange += childHeightArea;
         if (tempHorizontalMinSize > childWidth)
         {
@@ -401,17 +350,32 @@ void UUIVerticalLayout::OnRebuildLayout()
     if (HeightFitToChildren && !ExpandChildHeightArea)
     {
         RootUIItemHeight = tempActuralVerticalRange + Padding.Top + Padding.Bottom;
-        ApplyHeightWithAnimation(tempAnimationType, RootUIItemHeight, RootUIComp.Get());
     }
     if (WidthFitToChildren && !ExpandChildWidthArea)
     {
         tempHorizontalMinSize += Padding.Left + Padding.Right;
         tempHorizontalMaxSize += Padding.Left + Padding.Right;
         RootUIItemWidth = FMath::Lerp(tempHorizontalMinSize, tempHorizontalMaxSize, WidthFitToChildrenFromMinToMax);
+    }
+
+    BeginArrangeChildren();
+    //only apply size when changed, so parent layout will not be marked dirty
+    if (RootUIItemHeight != RootUIComp->GetHeight())
+    {
+        arrangeStartIndex = 0;
+        ApplyHeightWithAnimation(tempAnimationType, RootUIItemHeight, RootUIComp.Get());
+    }
+    if (RootUIItemWidth != RootUIComp->GetWidth())
+    {
+        arrangeStartIndex = 0;
         ApplyWidthWithAnimation(tempAnimationType, RootUIItemWidth, RootUIComp.Get());
     }
+    if (arrangeStartIndex == 0)
+    {
+        posY = startPosition.Y;
+    }
 
-    for (int i = 0; i < childrenCount; i++)
+    for (int i = arrangeStartIndex; i < childrenCount; i++)
     {
         auto ChildUIItem = uiChildrenList[i].ChildUIItem;
         if (ExpandChildWidthArea)
@@ -515,6 +479,7 @@ void UUIVerticalLayout::OnRebuildLayout()
 
         posY -= childHeightArea + Spacing;
     }
+    EndArrangeChildren(arrangeStartIndex);
 
 	if (tempAnimationType == EUILayoutAnimationType::EaseAnimation)
 	{
@@ -107,6 +107,20 @@ public:
 		TArray<TObjectPtr<UMaterialInstanceDynamic>> MaterialList;
 };
 
+/** One instance of canvas's rendered result, see ULGUICanvas::SetRenderInstances */
+USTRUCT(BlueprintType)
+struct FLGUICanvasRenderInstance
+{
+	GENERATED_BODY()
+public:
+	/** Transform relative to the canvas */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = LGUI)
+		FTransform Transform;
+	/** Multiply to vertex color */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = LGUI)
+		FColor Color = FColor::White;
+};
+
 struct FLGUICacheTransformContainer
 {
 public:
@@ -176,7 +190,7 @@ public:
 	void MarkCanvasUpdateRecursive(bool bMaterialOrTextureChanged, bool bTransformOrVertexPositionChanged, bool bHierarchyOrderChanged, bool bForceRebuildDrawcall = false);
 	void MarkItemTransformOrVertexPositionChanged(UUIBaseRenderable* InRenderable);
 
-	/** is point visible in Canvas. may not visible if use clip. texture clip just return true. rect clip will ignore feather value */
+	/** is point visible in Canvas. may not visible if use clip. texture clip use a cached alpha mask of clip texture. rect clip will ignore feather value */
 	bool CalculatePointVisibilityOnClip(const FVector& worldPoint);
 	/** calculate rect clip range */
 	void ConditionalCalculateRectRange();
@@ -304,7 +318,11 @@ protected:
 		FVector2D clipFeather = FVector2D(4, 4);
 	UPROPERTY(EditAnywhere, Category = LGUI)
 		FMargin clipRectOffset = FMargin(0);
-	/** Clip content with a black-white texture (acturally the red channel of the texture). Not support nested clip. */
+	/**
+	 * Clip content with a black-white texture (acturally the red channel of the texture). Not support nested clip.
+	 * Hit test need to read the texture's pixels on cpu side, which works best with an uncompressed texture (eg. TC_VectorDisplacementmap) and NeverStream checked.
+	 * Otherwise pixels are read back from gpu once per texture, and if that also fails then hit test ignore the clip texture.
+	 */
 	UPROPERTY(EditAnywhere, Category = LGUI, meta = (DisplayThumbnail = "false"))
 		TObjectPtr<UTexture2D> clipTexture = nullptr;
 	/** Threshold for line trace interaction test, if transparent value less then this threshold then hit test return false. */
@@ -571,6 +589,27 @@ public:
 
 	float GetLastRenderTime()const;
 	ULGUIMeshComponent* GetUIMesh()const { CheckUIMesh(); return UIMesh.Get(); }
+
+	/**
+	 * Offset rendered result of this canvas (and children canvases) in this canvas's local space, without moving any UI element.
+	 * Only UIMesh's location and rect clip parameter is updated, no transform or vertex change, so the cost not depend on UI element count.
+	 * Note UI elements still stay at their actual location, so layout not take this offset. Raycaster offset the ray by GetWorldRenderOffset, so UI elements are hit where they are rendered.
+	 */
+	void SetRenderOffset(const FVector2D& InOffset);
+	const FVector2D& GetRenderOffset()const { return RenderOffset; }
+	/** Render offset of this canvas plus parent canvas's, in world space */
+	FVector GetWorldRenderOffset()const;
+
+	/**
+	 * Draw rendered result of this canvas once for every instance with instanced draw, all instances share the same geometry, so this is cheap for many same UI, eg: health bars.
+	 * Only work with WorldSpace_LGUI render mode. Children canvases that render inside this canvas (not override sorting) are drawn with the same instances, children canvases that use override sorting are drawn once.
+	 * Note raycast only hit the canvas itself, not instances. Instances are drawn in array order.
+	 * Empty array means no instancing, draw the canvas once.
+	 */
+	UFUNCTION(BlueprintCallable, Category = LGUI)
+		void SetRenderInstances(const TArray<FLGUICanvasRenderInstance>& InInstances);
+	UFUNCTION(BlueprintCallable, Category = LGUI)
+		const TArray<FLGUICanvasRenderInstance>& GetRenderInstances()const { return RenderInstances; }
 public:
 	static FName LGUI_MainTextureMaterialParameterName;
 	static FName LGUI_RectClipOffsetAndSize_MaterialParameterName;
@@ -582,6 +621,15 @@ public:
 private:
 	void SetSortOrderAdditionalValueRecursive(int32 InAdditionalValue);
 	void UpdateRenderTarget(bool CallEvent);
+	/**
+	 * Get pixel rect of render target that need to redraw, from changed region of all UIMesh in hierarchy.
+	 * @param	OutDirtyRect	empty rect means whole render target
+	 * @return	false if nothing need to redraw
+	 */
+	bool CalculateRenderTargetDirtyRect(FIntRect& OutDirtyRect);
+	void CollectRenderTargetDirtyRegion_Recursive(FBox& InOutDirtyBox, bool& InOutRedrawWhole);
+	/** dirty rect of prev render target update, redraw it again at next update, same reason as bPrevAnythingChangedForRenderTarget */
+	FIntRect PrevRenderTargetDirtyRect;
 	/** Check if any invalid in list. Currently use in editor after undo check or rebuild. */
 	void EnsureDrawcallObjectReference();
 public:
@@ -605,6 +653,8 @@ private:
 	uint32 bRequestUpdateForRenderTarget : 1;//request update when RenderTargetUpdateMode is WhenRequest
 	uint32 bAnythingChangedForRenderTarget : 1;//if children canvas anything changed, then mark this property for root canvas, good for RenderTarget mode to update
 	uint32 bPrevAnythingChangedForRenderTarget : 1;//same as upper one, but the prev frame
+	uint32 bRenderTargetNeedFullRedraw : 1;//change that can't be represented by UIMesh's dirty region, need to redraw whole render target
+	uint32 bPrevRenderTargetFullRedraw : 1;//same as upper one, but the prev render target update
 	uint32 bHasSetIntialStateforLGUIWorldSpaceRenderer : 1;//is LGUI world space renderer's initial state set
 	uint32 bNeedToVerifyMaterials : 1;
 	uint32 bRootCanvasNeedToUpdateChildrenCanvasBounds : 1;//if child canvas's UIMesh's bounds change, then need to notify root canvas to update it's UIMesh's bounds
@@ -647,6 +697,20 @@ private:
 	TArray<TObjectPtr<UUIItem>> UIItemList;//All UIItem that belongs to this canvas
 	TSharedPtr<UUIDrawcall> DrawcallAsChildCanvas = nullptr;//Drawcall that represent this canvas when the canvas is render as child.
 
+	/** cpu side alpha mask of clipTexture for hit test, shared by all canvas which use the same clip texture */
+	TSharedPtr<struct FLGUIClipTextureHitTestMask> ClipTextureHitTestMask = nullptr;
+	/** get or create alpha mask for clipTexture. return nullptr if texture's pixel data is not accessible or gpu read back is not finished yet, the failure is cached per texture */
+	const FLGUIClipTextureHitTestMask* GetClipTextureHitTestMask();
+
+	/** render offset set by SetRenderOffset */
+	FVector2D RenderOffset = FVector2D(0, 0);
+	/** RenderOffset plus parent canvas's offset, in this canvas's local space, UIMesh is placed at this location */
+	FVector2D ActualRenderOffset = FVector2D(0, 0);
+	void UpdateActualRenderOffset_Recursive();
+
+	TArray<FLGUICanvasRenderInstance> RenderInstances;
+	void UpdateUIMeshInstanceData()const;
+
 	/** rect clip's min position */
 	FVector2D clipRectMin = FVector2D(0, 0);
 	/** rect clip's max position */
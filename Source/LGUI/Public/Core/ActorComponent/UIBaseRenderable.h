@@ -157,10 +157,10 @@ public:
 		void SetCustomRaycastObject(UUIRenderableCustomRaycast* Value);
 
 	uint8 GetFinalAlpha()const;
-	/** get final alpha, calculated with CanvasGroup's alpha */
+	/** get final alpha, calculated with CanvasGroup's alpha. (When called inside OnUpdateGeometry of UIBatchMeshRenderable, CanvasGroup's alpha is not included, because it is applied by drawcall) */
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		float GetFinalAlpha01()const;
-	/** get final color, calculated with CanvasGroup's alpha */
+	/** get final color, calculated with CanvasGroup's alpha. (When called inside OnUpdateGeometry of UIBatchMeshRenderable, CanvasGroup's alpha is not included, because it is applied by drawcall) */
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		FColor GetFinalColor()const;
 
@@ -189,6 +189,8 @@ public:
 protected:
 	uint8 bColorChanged : 1;
 	uint8 bTransformChanged : 1;
+	/** CanvasGroup's alpha is applied when drawcall combine mesh, so ignore it when create geometry. */
+	uint8 bIgnoreCanvasGroupAlpha : 1;
 public:
 #pragma region TweenAnimation
 	UFUNCTION(BlueprintCallable, meta = (AdvancedDisplay = "delay,ease"), Category = "LTweenLGUI")
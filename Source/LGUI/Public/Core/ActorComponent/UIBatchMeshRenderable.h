@@ -149,6 +149,7 @@ public:
 	void SortGeometryModifier();
 
 	virtual void MarkAllDirty()override;
+	virtual void OnCanvasGroupAlphaChange()override;
 	UIGeometry* GetGeometry()const { return geometry.Get(); }
 
 	virtual bool LineTraceUI(FHitResult& OutHit, const FVector& Start, const FVector& End)override;
@@ -358,18 +358,36 @@ protected:
 	/** hierarchy index, hierarchy order, render order */
 	UPROPERTY(EditAnywhere, Category = LGUI)
 		int32 hierarchyIndex = INDEX_NONE;
+	/**
+	 * Order key in flatten hierarchy, only valid for comparison between UIItems.
+	 * Keys are assigned with gaps, so insert/reorder/reparent an UIItem only need to renumber it's own sub-tree inside the gap.
+	 */
 	UPROPERTY(Transient, VisibleAnywhere, Category = LGUI, AdvancedDisplay)
 	mutable int32 flattenHierarchyIndex = 0;
 	void MarkFlattenHierarchyIndexDirty();
 private:
-	/** Only for RootUIItem */
+	/** Only for RootUIItem. Items that need to renumber their sub-tree */
+	mutable TArray<TWeakObjectPtr<const UUIItem>> FlattenHierarchyIndexDirtyItems;
+	/** Only for RootUIItem. Renumber whole hierarchy */
 	void RecalculateFlattenHierarchyIndex()const;
-	void CalculateFlattenHierarchyIndex_Recursive(int& index)const;
+	/** Only for RootUIItem. Renumber dirty sub-trees, fallback to whole hierarchy if gap is not enough */
+	void UpdateFlattenHierarchyIndex()const;
+	/** Renumber this sub-tree between prev and next item's key. return false if gap is not enough or neighbour key is not valid */
+	bool RecalculateFlattenHierarchyIndexInGap()const;
+	void CalculateFlattenHierarchyIndex_Recursive(int64& index, int64 stride)const;
+	int32 CountFlattenHierarchyItems_Recursive()const;
+	/** is this or any up parent need to renumber */
+	bool IsFlattenHierarchyIndexStale()const;
+	/** prev item in flatten hierarchy, nullptr if this is root */
+	const UUIItem* GetFlattenHierarchyPrevItem()const;
+	/** next item in flatten hierarchy after this sub-tree, nullptr if this is the last one */
+	const UUIItem* GetFlattenHierarchyNextItem()const;
+	int32 GetValidUIChildIndex(const UUIItem* InChild)const;
 	void ApplyHierarchyIndex();
 public:
 	UFUNCTION(BlueprintCallable, Category = LGUI)
 		int32 GetHierarchyIndex() const { return hierarchyIndex; }
-	/** Get flatten hierarchy index, calculate from the first top most UIItem. */
+	/** Get flatten hierarchy index, calculate from the first top most UIItem. Value is not continuous, only use it to compare order between UIItems. */
 	UFUNCTION(BlueprintCallable, Category = LGUI)
 		int32 GetFlattenHierarchyIndex()const;
 	UFUNCTION(BlueprintCallable, Category = LGUI)
@@ -378,6 +396,11 @@ public:
 		void SetAsFirstHierarchy();
 	UFUNCTION(BlueprintCallable, Category = LGUI)
 		void SetAsLastHierarchy();
+	/**
+	 * Build a temporary UI tree, then randomly reorder/reparent/insert UIItems and query flatten hierarchy index after each change, log the time and verify the order.
+	 * Also available as console command "lgui.UIItem.FlattenHierarchyIndexBenchmark [NodeCount] [ChurnCount]".
+	 */
+	static void BenchmarkFlattenHierarchyIndex(UWorld* InWorld, int32 InNodeCount, int32 InChurnCount);
 #pragma endregion HierarchyIndex
 
 #pragma region Name
@@ -463,7 +486,7 @@ protected:
 	UPROPERTY(Transient) mutable uint8 bIsCanvasUIItem:1;
 	uint8 bCanSetAnchorFromTransform : 1;
 
-	/** Only for RootUIItem, if dirty then we need to recalculate it */
+	/** This sub-tree need to renumber flatten hierarchy index. For RootUIItem means whole hierarchy need to recalculate */
 	mutable uint8 bFlattenHierarchyIndexDirty : 1;
 #if WITH_EDITOR
 	uint8 bUIActiveStateDirty : 1;
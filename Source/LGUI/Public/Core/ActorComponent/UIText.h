@@ -93,6 +93,15 @@ protected:
 		float maxHorizontalWidth = 100;
 	UPROPERTY(EditAnywhere, Category = "LGUI")
 		EUITextFontStyle fontStyle = EUITextFontStyle::None;
+	/**
+	 * Only show first count of visible chars, -1 means show all. Useful for typewriter effect.
+	 * Full text is layout once, change this value will only add or remove revealed glyphs, not layout again.
+	 */
+	UPROPERTY(EditAnywhere, Category = "LGUI", meta = (ClampMin = "-1"))
+		int32 revealCharCount = -1;
+	/** All digit chars (0-9) use the widest digit's width and no kerning, so changing number will not move other chars. Useful for score, timer and counter. */
+	UPROPERTY(EditAnywhere, Category = "LGUI")
+		bool fixedWidthDigit = false;
 	/**
 	 * rich text support, eg:
 	 * <b>Bold</b>
@@ -132,6 +141,12 @@ private:
 	/** visible/renderable char count of current text. -1 means not set yet */
 	mutable int visibleCharCount = -1;
 	bool bTextLayoutDirty = false;
+	/** numeric text and AppendText/ReplaceText change geometry and layout cache content directly, text property is not sync yet. */
+	mutable bool bTextPropertyDirty = false;
+	/** text appended by AppendText when geometry is not ready, append to text property when needed, so multiple append before layout not copy the whole text. */
+	mutable FString PendingAppendText;
+	/** Set numeric text that formatted in stack buffer, change digits in place if possible, otherwise same as SetText. */
+	void SetNumericText(const TCHAR* InChars, int32 InLength);
 	void MarkTextLayoutDirty();
 	void ConditionalMarkTextLayoutDirty();
 	FVector2f PrevScale2DForUIText = FVector2f::One();
@@ -181,7 +196,7 @@ public:
 	void GenerateRichTextImageObject();
 public:
 	UFUNCTION(BlueprintCallable, Category = "LGUI") ULGUIFontData_BaseObject* GetFont()const { return font; }
-	UFUNCTION(BlueprintCallable, Category = "LGUI")	const FText& GetText()const { return text; }
+	UFUNCTION(BlueprintCallable, Category = "LGUI")	const FText& GetText()const;
 	UE_DEPRECATED(4.24, "Use GetFontSize instead")
 	UFUNCTION(BlueprintCallable, Category = "LGUI", meta = (DeprecatedFunction, DeprecationMessage = "Use GetFontSize instead"))
 		float GetSize()const { return size; }
@@ -201,8 +216,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LGUI") ULGUIRichTextImageData_BaseObject* GetRichTextImageData()const { return richTextImageData; }
 	UFUNCTION(BlueprintCallable, Category = "LGUI") EUITextParagraphHorizontalAlign GetParagraphHorizontalAlignment()const { return hAlign; }
 	UFUNCTION(BlueprintCallable, Category = "LGUI") EUITextParagraphVerticalAlign GetParagraphVerticalAlignment()const { return vAlign; }
+	UFUNCTION(BlueprintCallable, Category = "LGUI") int32 GetRevealCharCount()const { return revealCharCount; }
+	UFUNCTION(BlueprintCallable, Category = "LGUI") bool GetFixedWidthDigit()const { return fixedWidthDigit; }
 
 	UFUNCTION(BlueprintCallable, Category = "LGUI") FVector2D GetTextRealSize()const;
+	/**
+	 * Create temporary UITexts with default font, layout many short labels and a long rich text document, log the time.
+	 * Also available as console command "lgui.UIText.LayoutBenchmark [LabelCount] [RichTextDocumentSize]".
+	 */
+	static void BenchmarkTextLayout(UWorld* InWorld, int32 InLabelCount, int32 InRichTextDocumentSize);
 	UE_DEPRECATED(4.24, "Use GetTextRealSize instead")
 	UFUNCTION(BlueprintCallable, Category = "LGUI", meta = (DeprecatedFunction, DeprecationMessage = "Use GetTextRealSize instead"))
 		FVector2D GetRealSize() { return GetTextRealSize(); }
@@ -211,6 +233,47 @@ public:
 		void SetFont(ULGUIFontData_BaseObject* newFont);
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		void SetText(const FText& newText);
+	/**
+	 * Append text to the end, useful for log or chat.
+	 * If possible, only the last line (last paragraph when font use kerning) and appended text will be layout, other lines and geometry will be kept.
+	 * Multiple append in same frame also work in this way.
+	 * Support none rich text with HorizontalOverflow or VerticalOverflow and vertical align Top, without pixel perfect, reveal or enabled GeometryModifier; otherwise the whole text will layout again.
+	 * For VerticalOverflow with adjustHeight, set pivot.Y to 1 so height change will not cause layout.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		void AppendText(const FString& appendText);
+	/**
+	 * Remove chars and insert text at char index, useful for text editing.
+	 * If possible, only the edited paragraphs (between '\n' before and after the edit) will be layout, following lines are moved without layout.
+	 * Support same case as AppendText; otherwise the whole text will layout again. For wrapped lines, layout start from the line before edited line.
+	 * @param startCharIndex char index in text to start remove and insert
+	 * @param removeCharCount chars to remove at startCharIndex
+	 * @param insertText text to insert at startCharIndex after remove
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		void ReplaceText(int32 startCharIndex, int32 removeCharCount, const FString& insertText);
+	/**
+	 * Set integer as text, eg: score, counter. Formatted without heap allocation.
+	 * If text length not change and only digits change, then only changed digit's vertex position and uv are updated, no layout. Use fixedWidthDigit so changed digit will not move other chars.
+	 * Support none rich text without pixel perfect, reveal, ClampContent or enabled GeometryModifier; otherwise same as SetText.
+	 * @param minDigitCount pad zero at left if digit count is less than this value
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		void SetIntegerText(int64 value, int32 minDigitCount = 1);
+	/**
+	 * Set number with fixed fraction digit count as text, eg: 12.50. Work like SetIntegerText.
+	 * @param fractionDigitCount digit count after decimal point, 0-9
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		void SetFixedPointText(double value, int32 fractionDigitCount = 2);
+	/**
+	 * Set time as text, format: mm:ss, or hh:mm:ss if showHour, with fraction of second if fractionDigitCount > 0, eg: 05:09.25. Work like SetIntegerText.
+	 * @param seconds time in seconds, negative value is treated as 0
+	 * @param showHour if false then minutes can be more than 59
+	 * @param fractionDigitCount digit count of second's fraction, 0-3
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		void SetTimeText(double seconds, bool showHour = false, int32 fractionDigitCount = 0);
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		void SetFontSize(float newSize);
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
@@ -239,6 +302,11 @@ public:
 		void SetRichTextImageData(ULGUIRichTextImageData_BaseObject* value);
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		void SetRichTextCustomStyleData(ULGUIRichTextCustomStyleData* value);
+	/** Only show first count of visible chars, -1 means show all. Only change revealed glyphs, no need to layout again. */
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		void SetRevealCharCount(int32 value);
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		void SetFixedWidthDigit(bool value);
 private:
 	void ClearCreatedRichTextImageObject();
 protected:
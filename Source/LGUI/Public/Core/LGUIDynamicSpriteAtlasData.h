@@ -4,48 +4,85 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
-#include "Utils/MaxRectsBinPack/MaxRectsBinPack.h"
+#include "Utils/MaxRectsBinPack/RectPacker.h"
 #include "Engine/Texture2D.h"
+#include "Tickable.h"
 #include "LGUIDynamicSpriteAtlasData.generated.h"
 
 
 class ULGUISpriteData;
 class IUISpriteRenderableInterface;
 
-/** Data container for dyanmically generated sprite atlas */
+/** One texture of dynamic sprite atlas */
 USTRUCT()
-struct LGUI_API FLGUIDynamicSpriteAtlasData
+struct LGUI_API FLGUIDynamicSpriteAtlasPage
 {
 	GENERATED_BODY()
 	/** atlasTexture is the real texture for render */
 	UPROPERTY(VisibleAnywhere, Transient, Category = "LGUI")
 	TObjectPtr<UTexture2D> atlasTexture = nullptr;
 	/** information needed when insert a sprite */
-	rbp::MaxRectsBinPack atlasBinPack;
-	/** sprites belong to this atlas */
+	TSharedPtr<rbp::RectPacker> atlasBinPack;
+	/** sprites belong to this page */
 	UPROPERTY(VisibleAnywhere, Category = "LGUI")
 	TArray<TObjectPtr<ULGUISpriteData>> spriteDataArray;
+	/** sprite is removed from this page, free space is fragmented */
+	bool bNeedDefragment = false;
+};
+
+/** Data container for dyanmically generated sprite atlas */
+USTRUCT()
+struct LGUI_API FLGUIDynamicSpriteAtlasData
+{
+	GENERATED_BODY()
+	/** atlas textures. Page start from initial size and expand until max page size, then new page is created */
+	UPROPERTY(VisibleAnywhere, Category = "LGUI")
+	TArray<FLGUIDynamicSpriteAtlasPage> pages;
 	/** collection of all objects that use this atlas to render. Object must implement IUISpriteRenderableInterface. */
 	UPROPERTY(VisibleAnywhere, Transient, Category = "LGUI", AdvancedDisplay)
 	TArray<TWeakObjectPtr<UObject>> renderSpriteArray;
+	/** packed sprites that not used by any object in renderSpriteArray, least recently used first. these sprites can be removed to make space. Sprite may be destroyed, so use weak pointer */
+	TArray<TWeakObjectPtr<ULGUISpriteData>> unusedSpriteArray;
 
 	void EnsureAtlasTexture(const FName& packingTag);
-	void CreateAtlasTexture(const FName& packingTag, int oldTextureSize, int newTextureSize);
-	/** create a new texture with size * 2 */
-	int32 ExpendTextureSize(const FName& packingTag);
-	int32 GetWillExpendTextureSize()const;
+	void CreateAtlasTexture(const FName& packingTag, int32 pageIndex, int oldTextureSize, int newTextureSize);
+	/** create a new texture with size * 2 for the page */
+	int32 ExpendTextureSize(const FName& packingTag, int32 pageIndex);
+	int32 GetWillExpendTextureSize(int32 pageIndex)const;
+	/** add a new page with initial size, return page index */
+	int32 AddPage(const FName& packingTag);
+	int32 FindPageIndex(const UTexture2D* InAtlasTexture)const;
 	void CheckSprite(const FName& packingTag);
 
+	void AddRenderSprite(ULGUISpriteData* InSpriteData, UObject* InRenderSprite);
+	void RemoveRenderSprite(ULGUISpriteData* InSpriteData, UObject* InRenderSprite);
+	/** remove sprite from atlas, it will be packed again when it is used */
+	void EvictSprite(ULGUISpriteData* InSpriteData);
+	/**
+	 * Remove unused sprites (least recently used first) until a page have enough space for the rect, then defragment that page.
+	 * @return false if no sprite is removed
+	 */
+	bool EvictUnusedSpritesForSpace(const FName& packingTag, int32 InWidth, int32 InHeight);
+	/** remove all unused sprites, return removed count. Pages will be defragmented in background */
+	int32 EvictAllUnusedSprites();
+	/** repack sprites of page into a new texture, so fragmented free space become continuous */
+	bool DefragmentPage(const FName& packingTag, int32 pageIndex);
+	/** defragment or remove one page that need it. return true if any page is processed */
+	bool ConditionalDefragmentOnePage(const FName& packingTag);
+
 	class FLGUIAtlasTextureExpandEvent : public TMulticastDelegate<void(UTexture2D*, int32)>//why not use DECLARE_EVENT here? because DECLARE_EVENT use "friend class XXX", but I need "friend struct"
 	{
 		friend struct FLGUIDynamicSpriteAtlasData;
 	};
 	/** atlas texture size may change when dynamic packing, this event will be called when that happen. */
 	FLGUIAtlasTextureExpandEvent OnTextureSizeExpanded;
+private:
+	/** tell objects that render sprite in the page */
+	void NotifyRenderSprites(const UTexture2D* InPageTexture, bool InIsScaleUp);
 };
 
 UCLASS(NotBlueprintable, NotBlueprintType)
-class LGUI_API ULGUIDynamicSpriteAtlasManager :public UObject
+class LGUI_API ULGUIDynamicSpriteAtlasManager :public UObject, public FTickableGameObject
 {
 	GENERATED_BODY()
 public:
@@ -55,6 +92,14 @@ private:
 		TMap<FName, FLGUIDynamicSpriteAtlasData> atlasMap;
 protected:
 	virtual void BeginDestroy()override;
+public:
+	//begin TickableObject interface
+	/** defragment one atlas page per frame */
+	virtual void Tick(float DeltaTime)override;
+	virtual bool IsTickable() const { return Instance == this; }
+	virtual bool IsTickableInEditor()const { return Instance == this; }
+	virtual TStatId GetStatId() const override;
+	//end TickableObject interface
 public:
 	static bool InitCheck();
 	const TMap<FName, FLGUIDynamicSpriteAtlasData>& GetAtlasMap() { return atlasMap; }
@@ -69,6 +114,13 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "LGUI", meta = (WorldContext = "WorldContextObject"))
 		static void DisposeAtlasByPackingTag(FName inPackingTag);
+	/**
+	 * Remove sprites that not used by any UI element from atlas, so the space can be used by other sprites. Removed sprite will be packed again when it is used.
+	 * Atlas page will be defragmented in background.
+	 * @return removed sprite count
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		static int32 EvictUnusedSprites(FName inPackingTag);
 
 	DECLARE_EVENT(ULGUIDynamicSpriteAtlasManager, FLGUIAtlasMapChangeEvent);
 
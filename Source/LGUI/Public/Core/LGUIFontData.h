@@ -46,15 +46,14 @@ public:
 	//Begin ULGUIFreeTypeRenderFontData interface
 	virtual void PushCharData(
 		TCHAR charCode, const FVector2f& lineOffset, const FVector2f& fontSpace, const FLGUICharData_HighPrecision& charData,
-		const LGUIRichTextParser::RichTextParseResult& richTextProperty,
+		const LGUIRichTextParser::RichTextParseResult& richTextProperty, const FLGUIFontPushCharDataParams& params,
 		int verticesStartIndex, int indicesStartIndex,
 		int& outAdditionalVerticesCount, int& outAdditionalIndicesCount,
 		TArray<FLGUIOriginVertexData>& originVertices, TArray<FLGUIMeshVertex>& vertices, TArray<FLGUIMeshIndexBufferType>& triangleIndices
 	)override;
-	virtual void PrepareForPushCharData(UUIText* InText)override;
+	virtual void PrepareForPushCharData(UUIText* InText, FLGUIFontPushCharDataParams& OutParams)override;
 	//End ULGUIFreeTypeRenderFontData interface
 protected:
-	float boldSize; float italicSlop;
 	TMap<FLGUIFontKeyData, FLGUICharData> charDataMap;
 	virtual UTexture2D* CreateFontTexture(int InTextureSize)override;
 	virtual void ApplyPackingAtlasTextureExpand(UTexture2D* newTexture, int newTextureSize)override;
@@ -64,6 +63,7 @@ protected:
 	virtual void ScaleDownUVofCachedChars()override;
 	virtual bool RenderGlyph(const TCHAR& charCode, const float& charSize, FGlyphBitmap& OutResult)override;
 	virtual void ClearCharDataCache()override;
+	virtual void GetCachedCharDataArray(TArray<FLGUICharData>& OutCharDataArray)const override;
 
 	virtual bool GetSupportDynamicPixelsPerUnit() { return true; }
 public:
@@ -76,6 +76,19 @@ struct FLGUICharData_HighPrecision
 		return FVector2f(uv3X, uv0Y);
 	}
 };
+/**
+ * Values of a UIText that font use to create char geometry, calculated by PrepareForPushCharData.
+ * Kept by text layout context and passed to PushCharData, so font object is not changed when layout a text.
+ */
+struct FLGUIFontPushCharDataParams
+{
+	/** tan of italic angle */
+	float ItalicSlop = 0.0f;
+	/** bold offset of font that create bold geometry by copy char */
+	float BoldSize = 0.0f;
+	/** max axis of UIText's world scale, for font that need object scale */
+	float ObjectScale = 1.0f;
+};
 
 class UTexture2D;
 class UUIText;
@@ -103,12 +116,12 @@ public:
 	virtual bool GetNeedObjectScale() { return false; }
 	virtual bool GetSupportDynamicPixelsPerUnit() { return false; }
 
-	/** this is called every time before create a string of char geometry */
-	virtual void PrepareForPushCharData(UUIText* InText) {};
+	/** this is called every time before create a string of char geometry, calculate values of the text that PushCharData need */
+	virtual void PrepareForPushCharData(UUIText* InText, FLGUIFontPushCharDataParams& OutParams) {};
 	/** create char geometry and push to vertices & triangleIndices array */
 	virtual void PushCharData(
 		TCHAR charCode, const FVector2f& lineOffset, const FVector2f& fontSpace, const FLGUICharData_HighPrecision& charData,
-		const LGUIRichTextParser::RichTextParseResult& richTextProperty,
+		const LGUIRichTextParser::RichTextParseResult& richTextProperty, const FLGUIFontPushCharDataParams& params,
 		int verticesStartIndex, int indicesStartIndex,
 		int& outAdditionalVerticesCount, int& outAdditionalIndicesCount,
 		TArray<FLGUIOriginVertexData>& originVertices, TArray<FLGUIMeshVertex>& vertices, TArray<FLGUIMeshIndexBufferType>& triangleIndices
@@ -117,5 +130,32 @@ public:
 	virtual void AddUIText(UUIText* InText) {}
 	virtual void RemoveUIText(UUIText* InText) {}
 
+	/**
+	 * Same as GetCharData, but chars in Latin-1 range are cached in fast table for each char size, so only query GetCharData once for a char.
+	 * Tables are shared by all UIText that use this font, and cleared by MarkCharDataChanged.
+	 */
+	FLGUICharData_HighPrecision GetCharDataFast(TCHAR charCode, float charSize);
+
 	static ULGUIFontData_BaseObject* GetDefaultFont();
+protected:
+	/** Call this when char data that GetCharData return is changed (eg. uv scale down by texture expand, or cache cleared), so fast table will query again. */
+	void MarkCharDataChanged();
+private:
+	static constexpr int32 FastTableCharCount = 256;
+	/** max count of char size that have fast table, oldest table is replaced when exceed */
+	static constexpr int32 MaxFastTableCount = 8;
+	struct FCharDataFastTable
+	{
+		float CharSize = -1;
+		uint64 ValidBits[FastTableCharCount / 64];
+		FLGUICharData_HighPrecision CharDataArray[FastTableCharCount];
+		void ClearValidBits()
+		{
+			FMemory::Memzero(ValidBits, sizeof(ValidBits));
+		}
+	};
+	TArray<TUniquePtr<FCharDataFastTable>> CharDataFastTables;
+	int32 LastFastTableIndex = 0;
+	int32 NextReplaceFastTableIndex = 0;
+	FCharDataFastTable& FindOrAddFastTable(float charSize);
 };
@@ -5,7 +5,7 @@
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
 #include "RHI.h"
-#include "Utils/MaxRectsBinPack/MaxRectsBinPack.h"
+#include "Utils/MaxRectsBinPack/RectPacker.h"
 #include "Core/LGUIFontData_BaseObject.h"
 #include "LGUISettings.h"
 #include "LGUIFreeTypeRenderFontData.generated.h"
@@ -80,11 +80,18 @@ protected:
 	*/
 	UPROPERTY(EditAnywhere, Category = "LGUI")
 		ELGUIAtlasTextureSizeType initialSize = ELGUIAtlasTextureSizeType::SIZE_1024x1024;
+	/**
+	 * Algorithm to pack glyphs into font texture.
+	 * MaxRects is most compact; Skyline and Shelf are faster when insert thousands of glyphs (eg: CJK), Shelf is the fastest but waste more space.
+	 */
+	UPROPERTY(EditAnywhere, Category = "LGUI")
+		ELGUIRectPackerType rectPackerType = ELGUIRectPackerType::MaxRects;
 	/**
 	 * rect pack use small cells to pack glyph in, and move to next cell if current cell is full. smaller value get better performance, but leave more garbage area.
 	 * this value defines the cell size. must not larger then InitialSize and only allow pow of 2.
+	 * Only valid for MaxRects.
 	 */
-	UPROPERTY(EditAnywhere, Category = "LGUI")
+	UPROPERTY(EditAnywhere, Category = "LGUI", meta = (EditCondition = "rectPackerType == ELGUIRectPackerType::MaxRects"))
 		int32 rectPackCellSize = 256;
 
 	/** Texture of this font */
@@ -130,8 +137,7 @@ protected:
 	FDelegateHandle packingAtlasTextureExpandDelegateHandle;
 
 	/** for rect packing */
-	rbp::MaxRectsBinPack binPack;
-	TArray<rbp::Rect> freeRects;
+	TSharedPtr<rbp::RectPacker> rectPacker;
 	/** current texture size */
 	int32 textureSize;
 	/** 1.0 / textureSize */
@@ -166,7 +172,7 @@ protected:
 	 * Insert rect into area, assign pixel if succeed
 	 * return: if can fit in rect area return true, else false
 	 */
-	bool PackRectAndInsertChar(const FGlyphBitmap& InGlyphBitmap, rbp::MaxRectsBinPack& InOutBinpack, UTexture2D* InTexture, FLGUICharData& OutResult);
+	bool PackRectAndInsertChar(const FGlyphBitmap& InGlyphBitmap, rbp::RectPacker& InOutRectPacker, UTexture2D* InTexture, FLGUICharData& OutResult);
 	void UpdateFontTextureRegion(UTexture2D* Texture, FUpdateTextureRegion2D* Region, uint32 SrcPitch, uint32 SrcBpp, uint8* SrcData);
 	void RenewFontTexture(int oldTextureSize, int newTextureSize);
 
@@ -178,7 +184,14 @@ protected:
 	virtual bool RenderGlyph(const TCHAR& charCode, const float& charSize, FGlyphBitmap& OutResult) { return false; };
 	virtual void ScaleDownUVofCachedChars() {};
 	virtual void ClearCharDataCache() {};
+	virtual void GetCachedCharDataArray(TArray<FLGUICharData>& OutCharDataArray)const {};
 public:
+	/**
+	 * Pack glyphs that already cached in this font with every rect packer type, and log insert time and occupancy.
+	 * Also available as console command "lgui.Font.RectPackerBenchmark FontAssetPath [TextureSize]".
+	 * @param InTextureSize Texture size to pack glyphs in, pack stop when texture is full.
+	 */
+	void BenchmarkRectPackers(int32 InTextureSize);
 #if WITH_EDITOR
 	void ReloadFont();
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
@@ -8,6 +8,18 @@
 
 class USceneComponent;
 
+/** How often LGUILifeCycleBehaviour's Update is called */
+UENUM(BlueprintType, Category = LGUI)
+enum class ELGUILifeCycleBehaviourUpdateRate :uint8
+{
+	/** Call Update every frame */
+	EveryFrame,
+	/** Call Update every N frames, N is UpdateFrameInterval */
+	EveryNFrames,
+	/** Call Update every X seconds, X is UpdateTimeInterval */
+	TimeInterval,
+};
+
 /**
  * Base class for LGUI's life cycle behviour related component.
  * I'm trying to make this ULGUILifeCycleBehaviour more like Unity's MonoBehaviour. You will see it contains function like Awake/Start/Update/OnDestroy/OnEnable/OnDisable.
@@ -33,6 +45,18 @@ protected:
 private:
 	UPROPERTY(EditAnywhere, Category = "LGUILifeCycleBehaviour")
 		bool enable = true;
+	/**
+	 * How often Update is called. Behaviours with same rate are staggered across frames, so they will not update at the same frame.
+	 * DeltaTime of Update is the time since last Update.
+	 */
+	UPROPERTY(EditAnywhere, Category = "LGUILifeCycleBehaviour", AdvancedDisplay)
+		ELGUILifeCycleBehaviourUpdateRate updateRate = ELGUILifeCycleBehaviourUpdateRate::EveryFrame;
+	/** Call Update every N frames. */
+	UPROPERTY(EditAnywhere, Category = "LGUILifeCycleBehaviour", AdvancedDisplay, meta = (ClampMin = "1", EditCondition = "updateRate == ELGUILifeCycleBehaviourUpdateRate::EveryNFrames"))
+		int32 updateFrameInterval = 2;
+	/** Call Update every X seconds. */
+	UPROPERTY(EditAnywhere, Category = "LGUILifeCycleBehaviour", AdvancedDisplay, meta = (ClampMin = "0.0", EditCondition = "updateRate == ELGUILifeCycleBehaviourUpdateRate::TimeInterval"))
+		float updateTimeInterval = 0.1f;
 #if WITH_EDITORONLY_DATA
 	/** This will allow Update function execute in edit mode. */
 	UPROPERTY(EditAnywhere, Category = "LGUILifeCycleBehaviour")
@@ -55,6 +79,31 @@ protected:
 	uint8 bPrevIsRootComponentVisible : 1;
 	/** use this to tell if the class is compiled from blueprint, only blueprint can execute ReceiveXXX. */
 	uint8 bCanExecuteBlueprintEvent : 1;
+	/** Update is overridden in native class. */
+	uint8 bHasNativeUpdate : 1;
+	/** ReceiveUpdate is implemented in blueprint. */
+	uint8 bHasBlueprintUpdate : 1;
+	/** RootComponent is UIItem, cached when add to update, for check game pause. */
+	uint8 bIsRootUIItem : 1;
+	/**
+	 * Call in constructor of native class that not override Update.
+	 * If InNativeClass is the nearest native class of this object, then Update have no native implementation, so this object only need update when blueprint implement ReceiveUpdate.
+	 */
+	void MarkUpdateNotOverriddenBy(UClass* InNativeClass);
+	/** Is there anything to do in Update, if not then no need to add to update. */
+	bool NeedUpdate()const { return bCanExecuteUpdate && (bHasNativeUpdate || bHasBlueprintUpdate); }
+	/** index in LGUIManagerWorldSubsystem's update array, INDEX_NONE if not added */
+	int32 UpdateSlotIndex = INDEX_NONE;
+	/** for updateRate, time since last Update */
+	float UpdateDeltaTimeAccumulator = 0;
+	/** for updateRate, frames since last Update */
+	int32 UpdateFrameCounter = 0;
+	/** for updateRate, time offset of first Update, to stagger behaviours across frames */
+	float UpdateTimePhase = 0;
+	/** Reset update rate state when add to update, InStaggerIndex decide which frame to update first */
+	void ResetUpdateRateState(uint32 InStaggerIndex);
+	/** Call Update according to updateRate */
+	void Call_Update(float DeltaTime);
 protected:
 	friend class ULGUIManagerWorldSubsystem;
 	UPROPERTY(Transient) mutable TWeakObjectPtr<USceneComponent> RootComp = nullptr;
@@ -115,6 +164,19 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "LGUILifeCycleBehaviour")
 		void SetCanExecuteUpdate(bool value);
+	UFUNCTION(BlueprintCallable, Category = "LGUILifeCycleBehaviour")
+		ELGUILifeCycleBehaviourUpdateRate GetUpdateRate()const { return updateRate; }
+	UFUNCTION(BlueprintCallable, Category = "LGUILifeCycleBehaviour")
+		int32 GetUpdateFrameInterval()const { return updateFrameInterval; }
+	UFUNCTION(BlueprintCallable, Category = "LGUILifeCycleBehaviour")
+		float GetUpdateTimeInterval()const { return updateTimeInterval; }
+	/** Set how often Update is called. */
+	UFUNCTION(BlueprintCallable, Category = "LGUILifeCycleBehaviour")
+		void SetUpdateRate(ELGUILifeCycleBehaviourUpdateRate value);
+	UFUNCTION(BlueprintCallable, Category = "LGUILifeCycleBehaviour")
+		void SetUpdateFrameInterval(int32 value);
+	UFUNCTION(BlueprintCallable, Category = "LGUILifeCycleBehaviour")
+		void SetUpdateTimeInterval(float value);
 
 	UFUNCTION(BlueprintCallable, Category = "LGUILifeCycleBehaviour")
 		void SetEnable(bool value);
@@ -82,6 +82,13 @@ struct FLGUILifeCycleBehaviourArrayContainer
 	TArray<TFunction<void()>> Functions;
 };
 
+/** Packed sort key for canvas: high 32 bits is sort order, low 32 bits is flatten hierarchy index */
+struct FLGUICanvasSortKey
+{
+	int64 Key;
+	TWeakObjectPtr<ULGUICanvas> Canvas;
+};
+
 class ILGUICultureChangedInterface;
 enum class ELGUIRenderMode : uint8;
 
@@ -138,7 +145,10 @@ private:
 	bool bShouldSortWorldSpaceLGUICanvas = true;
 	bool bShouldSortWorldSpaceCanvas = true;
 	bool bShouldSortRenderTargetSpaceCanvas = true;
+	/** reuse the array when sort canvas */
+	TArray<FLGUICanvasSortKey> CanvasSortKeyArray;
 
+	/** Slot array, every behaviour store it's index in UpdateSlotIndex, so add and remove don't need to search */
 	UPROPERTY(VisibleAnywhere, Category = "LGUI")
 		TArray<TWeakObjectPtr<ULGUILifeCycleBehaviour>> LGUILifeCycleBehavioursForUpdate;
 	UPROPERTY(VisibleAnywhere, Category = "LGUI")
@@ -146,7 +156,13 @@ private:
 	bool bIsExecutingStart = false;
 	bool bIsExecutingUpdate = false;
 	int32 CurrentExecutingUpdateIndex = -1;
-	TArray<ULGUILifeCycleBehaviour*> LGUILifeCycleBehavioursNeedToRemoveFromUpdate;
+	/** Some slots are cleared when executing update, should remove them after execute complete */
+	bool bNeedToCompactUpdateArray = false;
+	/** Increase when add behaviour to update, to stagger behaviours that not update every frame */
+	uint32 UpdateStaggerIndex = 0;
+	void AddToUpdateArray(ULGUILifeCycleBehaviour* InComp);
+	void RemoveFromUpdateArray(ULGUILifeCycleBehaviour* InComp);
+	void CompactUpdateArray();
 #if WITH_EDITORONLY_DATA
 	int32 PrevScreenSpaceOverlayCanvasCount = 1;
 #endif
@@ -103,6 +103,12 @@ public:
 	void ClearRenderData();
 
 	void SetUITranslucentSortPriority(int32 NewTranslucentSortPriority);
+	/**
+	 * Draw the whole mesh once for every instance with instanced draw, only work with LGUI renderer in world space.
+	 * Empty array means not instanced, draw the mesh once.
+	 */
+	void SetInstanceData(const TArray<FLGUIMeshInstanceData>& InInstanceDataArray);
+	const TArray<FLGUIMeshInstanceData>& GetInstanceData()const { return InstanceDataArray; }
 
 	void VerifyMaterials();
 	void SetParentCavansMeshComp(ULGUIMeshComponent* InMesh);
@@ -119,12 +125,25 @@ public:
 	/** Update LocalBounds member from the local box of each section */
 	void UpdateLocalBounds();
 	void UpdateChildCanvasSectionBox();
+
+	/** Mark section's area as changed, for render target canvas to redraw the area. Call this when change section's appearance without update section data, eg: material parameter */
+	void MarkRenderSectionDirtyRegion(TSharedPtr<FLGUIRenderSection> InRenderSection);
+	/**
+	 * Get world space region that changed since last call of this function, and reset it. Render target canvas use it to redraw only changed region.
+	 * @return false if the change can't be represented by a region (eg: mesh moved), need to redraw everything.
+	 */
+	bool ConsumeDirtyRegion(FBox& OutDirtyBox);
 private:
 	TArray<TSharedPtr<FLGUIRenderSection>> RenderSections;
 	//~ Begin USceneComponent Interface.
 	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport = ETeleportType::None)override;
 	//~ Begin USceneComponent Interface.
 
+	/** world space region that changed, see ConsumeDirtyRegion */
+	FBox DirtyRegionBox = FBox(EForceInit::ForceInit);
+	bool bDirtyRegionIsWhole = true;
+
 	friend class FLGUIRenderSceneProxy;
 
 protected:
@@ -133,6 +152,7 @@ protected:
 	TWeakObjectPtr<ULGUICanvas> RenderCanvas = nullptr;
 	bool bIsSupportUERenderer = true;
 	TWeakObjectPtr<ULGUIMeshComponent> ParentCanvasMeshComp = nullptr;
+	TArray<FLGUIMeshInstanceData> InstanceDataArray;
 
 public:
 	FLGUIMeshSceneProxyCreateDeleteDelegate OnSceneProxyCreated;
@@ -50,3 +50,57 @@ public:
 };
 LGUI_API FVertexDeclarationRHIRef& GetLGUIMeshVertexDeclaration();
 
+/** Per-instance data for instanced rendering, read from vertex stream 1 */
+struct LGUI_API FLGUIMeshInstanceData
+{
+	FLGUIMeshInstanceData()
+	{
+		SetTransform(FTransform::Identity);
+	}
+	FLGUIMeshInstanceData(const FTransform& InTransform, const FColor& InColor)
+		:Color(InColor)
+	{
+		SetTransform(InTransform);
+	}
+
+	/** Rows of instance's transform relative to mesh, in column-vector convention */
+	FVector4f Transform[3];
+	FColor Color = FColor::White;
+
+	void SetTransform(const FTransform& InTransform)
+	{
+		SetMatrix(InTransform.ToMatrixWithScale());
+	}
+	void SetMatrix(const FMatrix& InMatrix)
+	{
+		const auto Matrix = (FMatrix44f)InMatrix;
+		for (int i = 0; i < 3; i++)
+		{
+			Transform[i] = FVector4f(Matrix.M[0][i], Matrix.M[1][i], Matrix.M[2][i], Matrix.M[3][i]);
+		}
+	}
+	FMatrix GetMatrix()const
+	{
+		FMatrix Result = FMatrix::Identity;
+		for (int i = 0; i < 3; i++)
+		{
+			Result.M[0][i] = Transform[i].X;
+			Result.M[1][i] = Transform[i].Y;
+			Result.M[2][i] = Transform[i].Z;
+			Result.M[3][i] = Transform[i].W;
+		}
+		return Result;
+	}
+};
+
+/** Vertex declaration with FLGUIMeshVertex in stream 0 and FLGUIMeshInstanceData in stream 1 */
+class LGUI_API FLGUIMeshInstancedVertexDeclaration : public FRenderResource
+{
+public:
+	FVertexDeclarationRHIRef VertexDeclarationRHI;
+	virtual ~FLGUIMeshInstancedVertexDeclaration() {}
+	virtual void InitRHI()override;
+	virtual void ReleaseRHI()override;
+};
+LGUI_API FVertexDeclarationRHIRef& GetLGUIMeshInstancedVertexDeclaration();
+
@@ -0,0 +1,167 @@
+﻿// Copyright 2019-Present LexLiu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LGUIProfiler.generated.h"
+
+class ULGUICanvas;
+
+/** Timed stages of LGUI pipeline */
+UENUM(BlueprintType, Category = LGUI)
+enum class ELGUIProfilerTimer :uint8
+{
+	/** ILGUILayoutInterface update */
+	Layout,
+	/** UI element create or update geometry */
+	Geometry,
+	/** Canvas batch drawcall */
+	Batch,
+	/** Canvas update drawcall mesh, push vertex data to render thread */
+	MeshUpload,
+	/** Raycaster hit test */
+	Raycast,
+	/** Input module process input and dispatch event, include raycast */
+	EventDispatch,
+
+	Count		UMETA(Hidden),
+};
+
+/** Work done by a single canvas in one frame */
+USTRUCT(BlueprintType)
+struct LGUI_API FLGUIProfilerCanvasStats
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		FString CanvasName;
+	/** Canvas update time in milliseconds, not include child canvas */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		float UpdateTime = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		int32 DirtyItemCount = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		int32 RebuiltDrawcallCount = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		int32 UploadedVertexCount = 0;
+};
+
+/** Work done by LGUI in one frame */
+USTRUCT(BlueprintType)
+struct LGUI_API FLGUIProfilerFrameStats
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		int64 FrameNumber = 0;
+
+	/** Times in milliseconds */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		float LayoutTime = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		float GeometryTime = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		float BatchTime = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		float MeshUploadTime = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		float RaycastTime = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		float EventDispatchTime = 0;
+
+	/** UI elements that recreate or update geometry */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		int32 DirtyItemCount = 0;
+	/** Drawcalls that combine and upload mesh data */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		int32 RebuiltDrawcallCount = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		int32 UploadedVertexCount = 0;
+	/** Vertex and index data size */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		int64 UploadedBytes = 0;
+	/** Glyphs that render and pack into font texture */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		int32 NewGlyphCount = 0;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		int32 FontTextureExpandCount = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "LGUI")
+		TArray<FLGUIProfilerCanvasStats> CanvasStats;
+
+	float GetTime(ELGUIProfilerTimer InTimer)const;
+	void AddTime(ELGUIProfilerTimer InTimer, float InMilliseconds);
+};
+
+/**
+ * Collect LGUI's per-frame work, only on game thread.
+ * Disabled by default, use console variable "lgui.Profiler.Enable 1" or SetEnabled to turn it on.
+ * Use console command "lgui.Profiler.DumpCSV [FilePath]" to write recorded frames to csv file.
+ */
+class LGUI_API FLGUIProfiler
+{
+public:
+	static bool IsEnabled() { return bEnabled; }
+	static void SetEnabled(bool InEnabled);
+	/** Max frame count in history */
+	static int32 MaxHistoryFrameCount;
+
+	/** Clear current frame and history */
+	static void Reset();
+	/** Get stats of current frame which is still recording */
+	static const FLGUIProfilerFrameStats& GetCurrentFrameStats();
+	/** Get stats of last finished frame */
+	static const FLGUIProfilerFrameStats& GetLastFrameStats();
+	/** Recorded finished frames, from old to new */
+	static const TArray<FLGUIProfilerFrameStats>& GetFrameHistory() { return FrameHistory; }
+	/** Write recorded frames to csv file */
+	static bool DumpToCSV(const FString& InFilePath);
+
+	static void AddTime(ELGUIProfilerTimer InTimer, double InSeconds);
+	static void AddDirtyItem() { if (bEnabled)GetFrame().DirtyItemCount++; }
+	static void AddRebuiltDrawcall(int32 InVertexCount, int64 InBytes);
+	static void AddNewGlyph() { if (bEnabled)GetFrame().NewGlyphCount++; }
+	static void AddFontTextureExpand() { if (bEnabled)GetFrame().FontTextureExpandCount++; }
+	static void AddCanvasStats(const ULGUICanvas* InCanvas, double InSeconds, int32 InDirtyItemCount, int32 InRebuiltDrawcallCount, int32 InUploadedVertexCount);
+private:
+	static bool bEnabled;
+	static FLGUIProfilerFrameStats CurrentFrame;
+	static TArray<FLGUIProfilerFrameStats> FrameHistory;
+	/** Get current frame for write, if engine frame changed then push current frame to history */
+	static FLGUIProfilerFrameStats& GetFrame();
+};
+
+/** Record time of a pipeline stage in scope */
+struct LGUI_API FLGUIProfilerScope
+{
+	FLGUIProfilerScope(ELGUIProfilerTimer InTimer)
+		: Timer(InTimer)
+		, StartTime(FLGUIProfiler::IsEnabled() ? FPlatformTime::Seconds() : 0)
+	{
+	}
+	~FLGUIProfilerScope()
+	{
+		if (StartTime > 0)
+		{
+			FLGUIProfiler::AddTime(Timer, FPlatformTime::Seconds() - StartTime);
+		}
+	}
+private:
+	ELGUIProfilerTimer Timer;
+	double StartTime;
+};
+
+/** Record work done by a canvas in scope, compare frame counters at begin and end */
+struct LGUI_API FLGUIProfilerCanvasScope
+{
+	FLGUIProfilerCanvasScope(const ULGUICanvas* InCanvas);
+	~FLGUIProfilerCanvasScope();
+private:
+	const ULGUICanvas* Canvas;
+	double StartTime = 0;
+	int32 StartDirtyItemCount = 0;
+	int32 StartRebuiltDrawcallCount = 0;
+	int32 StartUploadedVertexCount = 0;
+};
+
+#define LGUI_PROFILER_SCOPE(Timer) FLGUIProfilerScope PREPROCESSOR_JOIN(LGUIProfilerScope_, __LINE__)(ELGUIProfilerTimer::Timer)
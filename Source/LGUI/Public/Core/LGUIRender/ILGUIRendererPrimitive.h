@@ -19,6 +19,9 @@ struct FLGUIMeshBatchContainer
 	FMeshBatch Mesh;
 	FBufferRHIRef VertexBufferRHI;
 	int32 NumVerts = 0;
+	/** Per-instance data (FLGUIMeshInstanceData) buffer, valid if NumInstances > 0 */
+	FBufferRHIRef InstanceBufferRHI;
+	int32 NumInstances = 0;
 
 	FLGUIMeshBatchContainer() {}
 };
@@ -53,6 +56,11 @@ public:
 	virtual FBoxSphereBounds GetWorldBounds()const = 0;
 
 	virtual void CollectRenderData(TArray<FLGUIPrimitiveDataContainer>& OutRenderData, float CurrentWorldTime) = 0;
+	/**
+	 * Get render data which is cached until render sections (or children canvas's) change, so no need to collect every frame.
+	 * PostProcess sections are always included, need to check PostProcess's CanRender when use it.
+	 */
+	virtual const TArray<FLGUIPrimitiveDataContainer>& GetCachedRenderData(float CurrentWorldTime) = 0;
 	virtual void GetMeshElements(const FSceneViewFamily& ViewFamilyclass, FMeshElementCollector* Collector, const FLGUIPrimitiveDataContainer& PrimitiveData, TArray<FLGUIMeshBatchContainer>& ResultArray) = 0;
 	virtual FUIPostProcessRenderProxy* GetPostProcessElement(const void* SectionPtr)const = 0;
 };
@@ -86,7 +86,11 @@ public:
 	void SetScreenSpaceRootCanvas(ULGUICanvas* InCanvas);
 	void ClearScreenSpaceRootCanvas();
 
-	void UpdateRenderTargetRenderer(class UTextureRenderTarget2D* InRenderTarget);
+	/**
+	 * Draw to render target at next frame.
+	 * @param	InDirtyRect	pixel rect to redraw on top of prev content, empty rect means clear and redraw whole render target
+	 */
+	void UpdateRenderTargetRenderer(class UTextureRenderTarget2D* InRenderTarget, const FIntRect& InDirtyRect = FIntRect());
 
 	TWeakObjectPtr<UWorld> GetWorld() { return World; }
 
@@ -134,6 +138,11 @@ private:
 		int DepthFade = 0;
 
 		ILGUIRendererPrimitive* Primitive = nullptr;
+
+		//render priority when sorted
+		int RenderPriority = 0;
+		//distance to camera (sqare) when sorted
+		float DistToCamera = 0;
 	};
 	struct FScreenSpaceRenderParameter
 	{
@@ -156,7 +165,11 @@ private:
 	TArray<FLGUIMeshBatchContainer> MeshBatchArray;
 	//if 'bIsRenderToRenderTarget' is true then we need a render target
 	class FTextureRenderTargetResource* RenderTargetResource = nullptr;
+	//pixel rect of render target to redraw, empty means whole
+	FIntRect RenderTargetDirtyRect;
 	void SortScreenSpacePrimitiveRenderPriority_RenderThread();
+	/** Keep WorldSpaceRenderCanvasParameterArray sorted by render priority and distance to view, full sort only when render priority change */
+	void SortWorldSpacePrimitive_RenderThread(const FVector3f& InViewPosition);
 	void SetRenderCanvasDepthFade_RenderThread(ULGUICanvas* InRenderCanvas, float InBlendDepth, int InDepthFade);
 	//render thread sample count for MSAA
 	uint8 NumSamples_MSAA = 1;
@@ -165,6 +178,19 @@ private:
 	void RenderLGUI_RenderThread(
 		FRDGBuilder& GraphBuilder
 		, FSceneView& InView);
+	/** Draw meshes of world space primitives that share same depth parameters, called inside a render pass */
+	void RenderWorldSpaceMeshes_RenderThread(
+		FRHICommandListImmediate& RHICmdList
+		, const FSceneView* RenderView
+		, const TArray<FLGUIPrimitiveDataContainer>& RenderDataArray
+		, float BlendDepth
+		, int DepthFade
+		, const FVector4f& SceneDepthTexST
+		, FRHITexture* SceneDepthTex
+		, const FIntRect& ViewRect
+		, uint8 NumSamples
+		, float GammaValue
+	);
 #if WITH_EDITORONLY_DATA
 public:
 	static uint32 EditorPreview_ViewKey;
@@ -21,6 +21,16 @@ public:
 	
 	void SetMaterialShaderParameters(FRHICommandList& RHICmdList, const FSceneView& View, const FMaterialRenderProxy* MaterialRenderProxy, const FMaterial* Material, const FMeshBatch& Mesh);
 };
+/** Vertex shader for instanced draw, each instance's transform and color come from vertex stream 1 */
+class FLGUIScreenRenderInstancedVS :public FLGUIScreenRenderVS
+{
+public:
+	DECLARE_SHADER_TYPE(FLGUIScreenRenderInstancedVS, Material);
+
+	FLGUIScreenRenderInstancedVS() {}
+	FLGUIScreenRenderInstancedVS(const FMaterialShaderType::CompiledShaderInitializerType& Initializer);
+	static void ModifyCompilationEnvironment(const FMaterialShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment);
+};
 class FLGUIScreenRenderPS : public FMaterialShader
 {
 public:
@@ -1,4 +1,4 @@
-// Copyright 2019-present LexLiu. All Rights Reserved.
+﻿// Copyright 2019-present LexLiu. All Rights Reserved.
 
 #pragma once
 
@@ -62,15 +62,16 @@ private:
 
 public:
 	//Begin ULGUIFontDataBaseObject interface
+	virtual void InitFont()override;
 	virtual UMaterialInterface* GetFontMaterial(ELGUICanvasClipType clipType)override;
 	virtual void PushCharData(
 		TCHAR charCode, const FVector2f& lineOffset, const FVector2f& fontSpace, const FLGUICharData_HighPrecision& charData,
-		const LGUIRichTextParser::RichTextParseResult& richTextProperty,
+		const LGUIRichTextParser::RichTextParseResult& richTextProperty, const FLGUIFontPushCharDataParams& params,
 		int verticesStartIndex, int indicesStartIndex,
 		int& outAdditionalVerticesCount, int& outAdditionalIndicesCount,
 		TArray<FLGUIOriginVertexData>& originVertices, TArray<FLGUIMeshVertex>& vertices, TArray<FLGUIMeshIndexBufferType>& triangleIndices
 	)override;
-	virtual void PrepareForPushCharData(UUIText* InText)override;
+	virtual void PrepareForPushCharData(UUIText* InText, FLGUIFontPushCharDataParams& OutParams)override;
 	virtual uint8 GetRequireAdditionalShaderChannels()override;
 	virtual float GetKerning(const TCHAR& leftCharIndex, const TCHAR& rightCharIndex, const float& charSize) override;
 	virtual float GetLineHeight(const float& fontSize) override;
@@ -79,7 +80,8 @@ public:
 	virtual bool GetNeedObjectScale() override{ return true; }//sdf font need scale value in material
 	//End ULGUIFontDataBaseObject interface
 protected:
-	float italicSlop = 0.0f; float oneDivideFontSize = 1.0f; float objectScale = 1.0f;
+	/** 1.0 / FontSize, FontSize is constant after font init */
+	float oneDivideFontSize = 1.0f;
 	TMap<TCHAR, FLGUICharData> charDataMap;
 	TMap<FLGUISDFFontKerningPair, int16> KerningPairsMap;
 	virtual UTexture2D* CreateFontTexture(int InTextureSize)override;
@@ -90,6 +92,7 @@ protected:
 	virtual void ScaleDownUVofCachedChars()override;
 	virtual bool RenderGlyph(const TCHAR& charCode, const float& charSize, FGlyphBitmap& OutResult)override;
 	virtual void ClearCharDataCache()override;
+	virtual void GetCachedCharDataArray(TArray<FLGUICharData>& OutCharDataArray)const override;
 
 	//SDF font already have space between glyphs
 	virtual int32 Get_SPACE_NEED_EXPEND()const override { return 0; };
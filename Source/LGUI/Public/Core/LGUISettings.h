@@ -20,6 +20,18 @@ enum class ELGUIAtlasTextureSizeType :uint8
 	SIZE_8192x8192			UMETA(DisplayName = "8192x8192"),
 };
 
+/** Algorithm to pack rects (glyphs or sprites) into atlas texture */
+UENUM(BlueprintType, Category = LGUI)
+enum class ELGUIRectPackerType :uint8
+{
+	/** Best area fit on free rect list. Most compact, but insert become slower when atlas is full of small rects. */
+	MaxRects,
+	/** Bottom-left on skyline. Fast and compact for many rects with similar size. */
+	Skyline,
+	/** Rects with similar height are placed in one row. Fastest, but waste more space when rect heights differ a lot. */
+	Shelf,
+};
+
 UENUM(BlueprintType)
 enum class ELGUIRendererAntiAliasingMethod :uint8
 {
@@ -60,6 +72,18 @@ public:
 	/** space between two sprites when package into atlas */
 	UPROPERTY(EditAnywhere, config, Category = Sprite)
 		int32 spaceBetweenSprites = 2;
+	/**
+	 * Max size of one atlas page. Atlas texture start from atlasTextureInitialSize and expand until this size, after that sprites that not used by any UI element will be removed to make space, if still not enough then a new page (another texture) will be created.
+	 * Sprites in different page can't batch together.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = Sprite)
+		ELGUIAtlasTextureSizeType atlasPageMaxSize = ELGUIAtlasTextureSizeType::SIZE_4096x4096;
+	/** Max page count of atlas, 0 means no limit. */
+	UPROPERTY(EditAnywhere, config, Category = Sprite, meta = (ClampMin = "0"))
+		int32 atlasMaxPageCount = 0;
+	/** Algorithm to pack sprites into atlas. Skyline and Shelf can't reuse space of removed sprite until the page is defragmented. */
+	UPROPERTY(EditAnywhere, config, Category = Sprite)
+		ELGUIRectPackerType atlasRectPacker = ELGUIRectPackerType::MaxRects;
 };
 
 /** for LGUI config */
@@ -132,6 +156,9 @@ public:
 	static bool GetAtlasTextureSRGB(const FName& InPackingTag);
 	static int32 GetAtlasTexturePadding(const FName& InPackingTag);
 	static TextureFilter GetAtlasTextureFilter(const FName& InPackingTag);
+	static int32 GetAtlasPageMaxSize(const FName& InPackingTag);
+	static int32 GetAtlasMaxPageCount(const FName& InPackingTag);
+	static ELGUIRectPackerType GetAtlasRectPacker(const FName& InPackingTag);
 	static const TMap<FName, FLGUIAtlasSettings>& GetAllAtlasSettings();
 	static float GetAutoBatchThreshold();
 	static int32 ConvertAtlasTextureSizeTypeToSize(const ELGUIAtlasTextureSizeType& InType);
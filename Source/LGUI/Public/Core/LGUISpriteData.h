@@ -17,6 +17,9 @@ class ULGUIStaticSpriteAtlasData;
 
 #define WARNING_ATLAS_SIZE 4096
 
+DECLARE_DYNAMIC_DELEGATE_OneParam(FLGUISpriteDataAsyncCreateDynamicDelegate, ULGUISpriteData*, CreatedSprite);
+DECLARE_DELEGATE_OneParam(FLGUISpriteDataAsyncCreateDelegate, ULGUISpriteData*);
+
 /**
  * A sprite-data type that can do automatic packing
  */
@@ -29,6 +32,7 @@ private:
 	friend class ULGUISpriteDataFactory;
 	friend struct FLGUIDynamicSpriteAtlasData;
 	friend class ULGUIStaticSpriteAtlasData;
+	friend class FLGUISpriteDataAsyncCreator;
 	/**
 	 * Texture of this sprite. Sprite is acturally renderred from atlas texture, so spriteTexture is not needed if atlasdata is packed; But! since atlas texture is packed at runtime, we must include spriteTexture inside final package.
 	 * Donot modify spriteTexture's setting unless you know what you doing
@@ -58,10 +62,22 @@ private:
 private:
 	bool isInitialized = false;
 	UPROPERTY(Transient)TObjectPtr<UTexture2D> atlasTexture = nullptr;
+	/** Rect that occupied in dynamic atlas page, include padding space */
+	rbp::Rect atlasPackedRect;
+	/** How many render objects are using this sprite, dynamic atlas can evict this sprite if it is 0 */
+	int32 atlasRenderRefCount = 0;
+	/** Decoded pixels for sprite that created from image file, use this instead of spriteTexture to pack into atlas */
+	TSharedPtr<const TArray<FColor>, ESPMode::ThreadSafe> spritePixels;
+	FIntPoint spritePixelsSize = FIntPoint::ZeroValue;
+	/** Size of spriteTexture or spritePixels */
+	FIntPoint GetSpriteSourceSize()const;
+	FString GetSpriteSourceName()const;
 	bool PackageSprite();
-	bool InsertTexture(FLGUIDynamicSpriteAtlasData* InAtlasData);
+	bool InsertTexture(FLGUIDynamicSpriteAtlasData* InAtlasData, int32 InPageIndex);
 	void CheckSpriteTexture();
 	void CopySpriteTextureToAtlas(rbp::Rect InPackedRect, int32 InAtlasTexturePadding);
+	/** Upload spritePixels (with edge padding) into atlas texture as one region */
+	void CopySpritePixelsToAtlas(rbp::Rect InPackedRect, int32 InAtlasTexturePadding);
 public:
 	bool GetUseEdgePixelPadding()const { return useEdgePixelPadding; }
 	ULGUIStaticSpriteAtlasData* GetPackingAtlas()const { return packingAtlas; }
@@ -93,6 +109,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		static ULGUISpriteData* CreateLGUISpriteData(UObject* Outer, UTexture2D* inSpriteTexture, FVector2D inHorizontalBorder = FVector2D::ZeroVector, FVector2D inVerticalBorder = FVector2D::ZeroVector, FName inPackingTag = TEXT("Main"));
 
+	/**
+	 * Create a LGUISpriteData from image file (png, jpg, bmp...) asynchronously.
+	 * Image is loaded and decoded (and scaled down if need) on worker thread, then packed into dynamic atlas with a single texture region upload, no UTexture2D is created.
+	 * Max concurrent decode count is set by console variable "lgui.SpriteData.MaxConcurrentAsyncCreate".
+	 * @param Outer						Outer of the result LGUISpriteData. If Outer is destroyed before finish, the request is cancelled.
+	 * @param InFilePath				Absolute path or relative to ProjectDir
+	 * @param InCallback				Called on game thread with created LGUISpriteData, or nullptr if something wrong. Not called if cancelled.
+	 * @param InMaxSize					If image width or height is larger than this, image will be scaled down. 0 means no limit.
+	 * @param inPackingTag				Must not be None, because the sprite is only exist in dynamic atlas.
+	 * @return							Request id for CancelAsyncCreateLGUISpriteData, 0 if fail to start.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI", meta = (AdvancedDisplay = "InMaxSize,inHorizontalBorder,inVerticalBorder,inPackingTag"))
+		static int32 CreateLGUISpriteDataFromFileAsync(UObject* Outer, const FString& InFilePath, const FLGUISpriteDataAsyncCreateDynamicDelegate& InCallback, int32 InMaxSize = 0, FVector2D inHorizontalBorder = FVector2D::ZeroVector, FVector2D inVerticalBorder = FVector2D::ZeroVector, FName inPackingTag = TEXT("Main"));
+	static int32 CreateLGUISpriteDataFromFileAsync(UObject* Outer, const FString& InFilePath, const FLGUISpriteDataAsyncCreateDelegate& InCallback, int32 InMaxSize = 0, FVector2D inHorizontalBorder = FVector2D::ZeroVector, FVector2D inVerticalBorder = FVector2D::ZeroVector, FName inPackingTag = TEXT("Main"));
+	/**
+	 * Same as CreateLGUISpriteDataFromFileAsync, but use image file data in memory.
+	 * @param InImageData				Compressed image data, eg: content of png file
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI", meta = (AdvancedDisplay = "InMaxSize,inHorizontalBorder,inVerticalBorder,inPackingTag"))
+		static int32 CreateLGUISpriteDataFromMemoryAsync(UObject* Outer, const TArray<uint8>& InImageData, const FLGUISpriteDataAsyncCreateDynamicDelegate& InCallback, int32 InMaxSize = 0, FVector2D inHorizontalBorder = FVector2D::ZeroVector, FVector2D inVerticalBorder = FVector2D::ZeroVector, FName inPackingTag = TEXT("Main"));
+	static int32 CreateLGUISpriteDataFromMemoryAsync(UObject* Outer, TArray<uint8>&& InImageData, const FLGUISpriteDataAsyncCreateDelegate& InCallback, int32 InMaxSize = 0, FVector2D inHorizontalBorder = FVector2D::ZeroVector, FVector2D inVerticalBorder = FVector2D::ZeroVector, FName inPackingTag = TEXT("Main"));
+	/**
+	 * Cancel a request of CreateLGUISpriteDataFromFileAsync or CreateLGUISpriteDataFromMemoryAsync, callback will not be called.
+	 * @return false if request is already finished or not exist.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		static bool CancelAsyncCreateLGUISpriteData(int32 InRequestId);
+
 	/**
 	 * If texture is changed, use this to reload texture.
 	 * Not support packingAtlas (static packing).
@@ -135,7 +135,10 @@ struct LGUI_API FTextGeometryCache
 {
 public:
 	FTextGeometryCache() {}
-	FTextGeometryCache(UUIText* InUIText);
+	/**
+	 * @param InLayoutOnly write layout result to own geometry instead of UIText's, for text that is not rendered, eg: UITextInputComponent's full text when UIText only show visible part of it. Layout parameters and font still come from UIText.
+	 */
+	FTextGeometryCache(UUIText* InUIText, bool InLayoutOnly = false);
 	/**
 	 * @return true - anything change
 	 */
@@ -146,7 +149,6 @@ public:
 		float InHeight,
 		FVector2f InPivot,
 		FColor InColor,
-		float InCanvasGroupAlpha,
 		FVector2f InFontSpace,
 		float InFontSize,
 		EUITextParagraphHorizontalAlign InParagraphHAlign,
@@ -167,7 +169,6 @@ private:
 	float height = 0;
 	FVector2f pivot = FVector2f::ZeroVector;
 	FColor color = FColor::White;
-	float canvasGroupAlpha = 1.0f;
 	FVector2f fontSpace = FVector2f::ZeroVector;
 	float fontSize = 0;
 	EUITextParagraphHorizontalAlign paragraphHAlign = EUITextParagraphHorizontalAlign::Left;
@@ -184,6 +185,34 @@ private:
 	bool bIsDirty = true;//vertex or triangle data is dirty
 	bool bIsColorDirty = true;//only color data is dirty (no include rich text's color)
 	TWeakObjectPtr<UUIText> UIText = nullptr;
+	/** geometry for layout only cache, not rendered */
+	TSharedPtr<UIGeometry> layoutOnlyGeometry = nullptr;
+
+#pragma region Reveal
+	/** only show first count of visible chars, -1 means show all */
+	int32 revealCharCount = -1;
+	/** triangle indices count that is showing in UIText's geometry */
+	int32 revealIndicesCount = -1;
+	bool bIsRestoreDirty = false;//UIText's geometry is cleared but layout not change, restore it from fullGeometry
+	/** full layout result when use reveal, so reveal count change no need to layout again */
+	TSharedPtr<UIGeometry> fullGeometry = nullptr;
+	int32 GetRevealIndicesCount()const;
+	/** copy layout result to fullGeometry if use reveal, then apply reveal to UIText's geometry */
+	void OnFullGeometryReady(UIGeometry* InGeo);
+#pragma endregion Reveal
+
+#pragma region DigitTemplate
+	/** layout result of "0123456789", for replace digit in place */
+	TSharedPtr<UIGeometry> digitTemplateGeometry = nullptr;
+	FUITextCharProperty digitTemplateCharProperty[10];
+	/** caret position of digit, the char's vertex position relative to it is same at any place */
+	FVector2f digitTemplateCaretPosition[10];
+	float digitTemplateXAdvance[10];
+	bool bDigitTemplateValid = false;
+	/** count of font texture scale up, to detect scale up during template layout */
+	int32 fontTextureScaleUpCount = 0;
+	bool PrepareDigitTemplate();
+#pragma endregion DigitTemplate
 
 public:
 #pragma region OutputResults
@@ -199,4 +228,83 @@ public:
 	void MarkDirty();
 	/** check if dirty before calculate geometry */
 	void ConditaionalCalculateGeometry();
+	/** UIText's geometry is cleared, need to fill it again. If layout not change then use fullGeometry, otherwise layout again */
+	void OnGeometryCleared();
+	/** font texture scale up, uv in fullGeometry should also scale */
+	void ApplyFontTextureScaleUp();
+	/**
+	 * Set reveal char count. Full text is layout once, reveal count change only change triangle indices which use the revealed glyphs.
+	 * @param InGeo UIText's geometry. if it is ready (not dirty), then triangle indices is changed directly, cost is proportional to changed char count.
+	 * @return true if triangle indices is changed in InGeo, false if InGeo need to update.
+	 */
+	bool SetRevealCharCount(int32 InRevealCharCount, UIGeometry* InGeo);
+	int32 GetRevealCharCount()const { return revealCharCount; }
+	/**
+	 * Append content to the end, only layout last line with appended content (last paragraph after '\n' when kerning cross lines), other lines and their geometry are kept, then extend geometry in place.
+	 * Support none rich text with HorizontalOverflow or VerticalOverflow and vertical align Top, not pixel perfect, not use reveal.
+	 * @param InGeo UIText's geometry, must be ready (not dirty, not modified by GeometryModifier).
+	 * @return true if appended. false if not supported, content is not changed.
+	 */
+	bool AppendContent(const FString& InAppendContent, int32 InAppendVisibleCharCount, UIGeometry* InGeo);
+	/**
+	 * Remove chars and insert content at a char index, only layout the edited paragraphs (between '\n' before and after the edit), other lines keep their layout and are moved by line count change.
+	 * Lines before the edited line's previous line keep their layout, so single paragraph with wrapped lines is also supported.
+	 * Same limitation as AppendContent, and not support '\r' around the edit. If all lines need layout then it is faster to just layout again.
+	 * @param InVisibleCharCountDelta visible char count of inserted content minus removed chars
+	 * @param InGeo UIText's geometry, must be ready (not dirty, not modified by GeometryModifier).
+	 * @return true if replaced. false if not supported, content is not changed.
+	 */
+	bool ReplaceContent(int32 InStartCharIndex, int32 InRemoveCharCount, const FString& InInsertContent, int32 InVisibleCharCountDelta, UIGeometry* InGeo);
+	/** height change not affect layout result: vertical align Top with pivot.Y = 1, and not ClampContent */
+	bool IsLayoutIndependentOfHeight()const;
+	/**
+	 * Replace content with same length, only digit (0-9) can be different. Changed digit's vertex position and uv are updated in place, no layout and no allocation.
+	 * Need UIText's fixedWidthDigit, or font without kerning (digits must have same advance). Not support rich text or pixel perfect.
+	 * @param InGeo UIText's geometry, must be ready (not dirty, not modified by GeometryModifier).
+	 * @param OutAnyChanged true if any digit is replaced.
+	 * @return true if replaced or content is same. false if not supported, content is not changed.
+	 */
+	bool ReplaceDigits(const TCHAR* InContent, int32 InLength, UIGeometry* InGeo, bool& OutAnyChanged);
+	const FString& GetContent()const { return content; }
+	int32 GetVisibleCharCount()const { return visibleCharCount; }
+	UUIText* GetUIText()const { return UIText.Get(); }
+	/** Geometry that layout result write to, UIText's geometry or own geometry if layout only */
+	UIGeometry* GetGeometry()const;
+#pragma region UITextInputComponent
+	/**
+	 * Caret queries on layout result, UIText call these after update layout.
+	 * @param moveType 0-left, 1-right, 2-up, 3-down, 4-start, 5-end
+	 * @return true- data changed
+	 */
+	bool MoveCaret(int32 moveType, int32& inOutCaretPositionIndex, int32& inOutCaretPositionLineIndex, FVector2f& inOutCaretPosition)const;
+	int GetCharIndexByCaretIndex(int32 inCaretPositionIndex)const;
+	int GetLastCaret()const;
+	int GetCaretIndexByCharIndex(int32 inCharIndex)const;
+	bool GetVisibleCharRangeForMultiLine(int32& inOutCaretPositionIndex, int32& inOutCaretPositionLineIndex, int32& inOutVisibleCaretStartLineIndex, int32& inOutVisibleCaretStartIndex, int inMaxLineCount, int32& outVisibleCharStartIndex, int32& outVisibleCharCount)const;
+	bool GetVisibleCharRangeForSingleLine(int32& inOutCaretPositionIndex, int32& inOutVisibleCaretStartIndex, float inMaxWidth, int32& outVisibleCharStartIndex, int32& outVisibleCharCount)const;
+#pragma endregion UITextInputComponent
+private:
+	/** if layout result can share with other UIText, see FTextGeometrySharedCache */
+	bool CanUseSharedCache()const;
+};
+
+/**
+ * Layout result shared by all UIText. UIText with same content, font and layout parameters reuse glyph positions and UVs, and only apply it's own transform and color.
+ * A bounded LRU cache, only use on game thread. Console variable "lgui.TextGeometrySharedCache.MaxEntryCount" set capacity (0 to disable), "lgui.TextGeometrySharedCache.Stats" print hit rate and memory.
+ * Text with pixel perfect or font that need object scale (SDF font) will not use this cache, because layout result rely on UIText's transform.
+ */
+struct LGUI_API FTextGeometrySharedCache
+{
+public:
+	/** Remove all cached layout result, call this when font's texture or char data change */
+	static void Clear();
+	static int32 GetEntryCount();
+	/** Allocated memory of all cached layout result, in bytes */
+	static int64 GetMemorySize();
+	static int64 GetHitCount();
+	static int64 GetMissCount();
+	/** Hit count / (hit count + miss count) */
+	static float GetHitRate();
+	/** Reset hit and miss count */
+	static void ResetHitCount();
 };
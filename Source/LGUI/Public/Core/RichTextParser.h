@@ -52,7 +52,6 @@ namespace LGUIRichTextParser
 
 		int originSize;
 		FColor originColor;
-		uint8 originCanvasGroupAlpha;
 		bool originBold;
 		bool originItalic;
 
@@ -62,11 +61,10 @@ namespace LGUIRichTextParser
 		{
 			imageTag = NAME_None;
 		}
-		void Prepare(float inOriginSize, FColor inOriginColor, uint8 inCanvasGroupAlpha, bool inBold, bool inItalic, int32 inFlags, RichTextParseResult& result)
+		void Prepare(float inOriginSize, FColor inOriginColor, bool inBold, bool inItalic, int32 inFlags, RichTextParseResult& result)
 		{
 			originSize = inOriginSize;
 			originColor = inOriginColor;
-			originCanvasGroupAlpha = inCanvasGroupAlpha;
 			originBold = inBold;
 			originItalic = inItalic;
 
@@ -529,61 +527,51 @@ namespace LGUIRichTextParser
 				if (colorString == TEXT("black"))
 				{
 					outColor = FColor::Black;
-					outColor.A = originCanvasGroupAlpha;
 					return true;
 				}
 				else if (colorString == TEXT("white"))
 				{
 					outColor = FColor::White;
-					outColor.A = originCanvasGroupAlpha;
 					return true;
 				}
 				else if (colorString == TEXT("gray"))
 				{
 					outColor = FColor(128, 128, 128);
-					outColor.A = originCanvasGroupAlpha;
 					return true;
 				}
 				else if (colorString == TEXT("silver"))
 				{
 					outColor = FColor(192, 192, 192);
-					outColor.A = originCanvasGroupAlpha;
 					return true;
 				}
 				else if (colorString == TEXT("red"))
 				{
 					outColor = FColor::Red;
-					outColor.A = originCanvasGroupAlpha;
 					return true;
 				}
 				else if (colorString == TEXT("green"))
 				{
 					outColor = FColor::Green;
-					outColor.A = originCanvasGroupAlpha;
 					return true;
 				}
 				else if (colorString == TEXT("blue"))
 				{
 					outColor = FColor::Blue;
-					outColor.A = originCanvasGroupAlpha;
 					return true;
 				}
 				else if (colorString == TEXT("orange"))
 				{
 					outColor = FColor(255, 165, 0);
-					outColor.A = originCanvasGroupAlpha;
 					return true;
 				}
 				else if (colorString == TEXT("purple"))
 				{
 					outColor = FColor(128, 0, 128);
-					outColor.A = originCanvasGroupAlpha;
 					return true;
 				}
 				else if (colorString == TEXT("yellow"))
 				{
 					outColor = FColor(255, 255, 0);
-					outColor.A = originCanvasGroupAlpha;
 					return true;
 				}
 				else if (colorString[0] == '#')
@@ -591,7 +579,7 @@ namespace LGUIRichTextParser
 					const static TArray<TCHAR> hexTable = { '0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f' };
 					if (colorString.Len() == 7 || colorString.Len() == 9)//#ffffff/#ffffff00
 					{
-						outColor.A = originCanvasGroupAlpha;
+						outColor.A = 255;
 						int colorStringLength = colorString.Len();
 						for (int i = 1; i < colorStringLength; i += 2)
 						{
@@ -605,11 +593,7 @@ namespace LGUIRichTextParser
 								case 1:outColor.R = value; break;
 								case 3:outColor.G = value; break;
 								case 5:outColor.B = value; break;
-								case 7:
-								{
-									outColor.A = (uint8)(LGUIUtils::Color255To1_Table[originCanvasGroupAlpha] * value);
-								}
-								break;
+								case 7:outColor.A = value; break;
 								}
 							}
 							else
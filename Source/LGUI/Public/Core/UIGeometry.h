@@ -13,6 +13,7 @@ class ULGUIFontData_BaseObject;
 class ULGUICanvas;
 class UUIItem;
 class UUIBaseRenderable;
+struct FUITextLayoutContext;
 
 /** Origin position/ normal/ tangent stored in UI item's local space */
 struct FLGUIOriginVertexData
@@ -192,7 +193,7 @@ public:
 #pragma region UIText
 public:
 	static void UpdateUIText(const FString& text, int32 visibleCharCount, float width, float height, const FVector2f& pivot
-		, const FColor& color, uint8 canvasGroupAlpha, const FVector2f& fontSpace, UIGeometry* uiGeo, float fontSize
+		, const FColor& color, const FVector2f& fontSpace, UIGeometry* uiGeo, float fontSize
 		, EUITextParagraphHorizontalAlign paragraphHAlign, EUITextParagraphVerticalAlign paragraphVAlign, EUITextOverflowType overflowType
 		, float maxHorizontalWidth, bool kerning
 		, EUITextFontStyle fontStyle, FVector2f& textRealSize
@@ -200,6 +201,17 @@ public:
 		, TArray<FUITextLineProperty>& cacheLinePropertyArray, TArray<FUITextCharProperty>& cacheCharPropertyArray, TArray<FUIText_RichTextCustomTag>& cacheRichTextCustomTagArray
 		, TArray<FUIText_RichTextImageTag>& cacheRichTextImageTagArray
 		, ULGUIFontData_BaseObject* font, bool richText, int32 richTextFilterFlags);
+	/** Layout text with specified context, the context store parser state and scratch buffers instead of function-static variables. Must call on game thread, because font render and cache glyphs during layout, see FUITextLayoutContext */
+	static void UpdateUIText(const FString& text, int32 visibleCharCount, float width, float height, const FVector2f& pivot
+		, const FColor& color, const FVector2f& fontSpace, UIGeometry* uiGeo, float fontSize
+		, EUITextParagraphHorizontalAlign paragraphHAlign, EUITextParagraphVerticalAlign paragraphVAlign, EUITextOverflowType overflowType
+		, float maxHorizontalWidth, bool kerning
+		, EUITextFontStyle fontStyle, FVector2f& textRealSize
+		, ULGUICanvas* renderCanvas, class UUIText* uiComp
+		, TArray<FUITextLineProperty>& cacheLinePropertyArray, TArray<FUITextCharProperty>& cacheCharPropertyArray, TArray<FUIText_RichTextCustomTag>& cacheRichTextCustomTagArray
+		, TArray<FUIText_RichTextImageTag>& cacheRichTextImageTagArray
+		, ULGUIFontData_BaseObject* font, bool richText, int32 richTextFilterFlags
+		, FUITextLayoutContext& context);
 #pragma endregion
 
 public:
@@ -0,0 +1,36 @@
+﻿// Copyright 2019-Present LexLiu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/RichTextParser.h"
+#include "Core/LGUIFontData_BaseObject.h"
+
+/**
+ * Working data for UIGeometry::UpdateUIText, so layout not use function-static buffers.
+ * Layout is not reentrant: font object and it's char data fast tables are shared by all UIText, and glyph is rendered and cached into font texture during layout, so text layout must happen on game thread.
+ */
+struct LGUI_API FUITextLayoutContext
+{
+public:
+	LGUIRichTextParser::RichTextParser RichTextParser;
+	/** parse result of every char in RichTextContent */
+	TArray<LGUIRichTextParser::RichTextParseResult> RichTextPropertyArray;
+	/** text content with rich text tags removed */
+	FString RichTextContent;
+	/** values of current text for font's PushCharData */
+	FLGUIFontPushCharDataParams PushCharDataParams;
+
+	/** Call before layout a text, set font and prepare PushCharDataParams */
+	void Prepare(ULGUIFontData_BaseObject* InFont, UUIText* InText);
+	/** Get char data from font, chars in Latin-1 range use font's fast table */
+	FLGUICharData_HighPrecision GetCharData(TCHAR InCharCode, float InCharSize)
+	{
+		return Font->GetCharDataFast(InCharCode, InCharSize);
+	}
+
+	/** Context for layout text on game thread */
+	static FUITextLayoutContext& GetGameThreadContext();
+private:
+	ULGUIFontData_BaseObject* Font = nullptr;
+};
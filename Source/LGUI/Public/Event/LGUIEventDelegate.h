@@ -130,9 +130,23 @@ private:
 		bool UseNativeParameter = false;
 private:
 	UPROPERTY(Transient) TObjectPtr<UFunction> CacheFunction = nullptr;
+	/** CacheFunction is a native function that can be invoked directly through it's thunk, skip ProcessEvent */
+	bool bCacheFunctionIsNative = false;
+	/** ParamBuffer is already decoded into CacheStringValue/CacheNameValue/CacheTextValue */
+	bool bParamBufferDecoded = false;
+	FString CacheStringValue;
+	FName CacheNameValue;
+	FText CacheTextValue;
 public:
 	void Execute();
 	void Execute(void* InParam, ELGUIEventDelegateParameterType InParameterType);
+	/**
+	 * Resolve target object and function, and decode parameter buffer, so later Execute can call target function directly.
+	 * Will be called automatically by Execute for the first time, call it earlier (eg. BeginPlay) can avoid the cost when first execute.
+	 * @return	true- target function is valid and ready to execute
+	 */
+	bool Prepare();
+	void PostSerialize(const FArchive& Ar);
 #if WITH_EDITOR
 	/**
 	 * Check if function parameter compatible with target function
@@ -142,11 +156,21 @@ public:
 #endif
 private:
 	bool CheckTargetObject();
-	void FindAndExecute(UObject* Target, void* ParamData = nullptr);
+	bool FindTargetFunction(UObject* Target);
+	void DecodeParamBuffer();
 	void ExecuteTargetFunction(UObject* Target, UFunction* Func);
 	void ExecuteTargetFunction(UObject* Target, UFunction* Func, void* ParamData);
 };
 
+template<>
+struct TStructOpsTypeTraits<FLGUIEventDelegateData> : public TStructOpsTypeTraitsBase2<FLGUIEventDelegateData>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
+};
+
 /**
  * event or callback that can edit inside ue4 editor
  */
@@ -171,6 +195,8 @@ private:
 	void LogParameterError(ELGUIEventDelegateParameterType WrongParamType)const;
 public:
 	bool IsBound()const;
+	/** Resolve all event's target function ahead, so the first FireEvent won't need to find them. */
+	void Prepare()const;
 public:
 	void FireEvent()const;
 	void FireEvent(bool InParam)const;
@@ -22,9 +22,12 @@ protected:
 	TWeakObjectPtr<class ULTweener> updateTweener;
 	virtual void OnUpdate(float deltaTime);
 	UPROPERTY(Transient)TObjectPtr<class UUIText> uiText;
+	/** x is frequency, y is speed (negative if flipDirection) */
+	FLinearColor GetWaveMaterialParameterValue()const;
 public:
 	virtual void Init()override;
 	virtual void Deinit()override;
+	virtual bool SupportGPUAnimation()const override { return true; }
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		float GetFrequency()const { return speed; }
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
@@ -41,6 +44,10 @@ private:
 		FVector position;
 public:
 	virtual void ApplyProperty(class UUIText* InUIText, const FUIEffectTextAnimation_SelectResult& InSelection, UIGeometry* InGeometry) override;
+	virtual void ApplyMaterialParameter(UMaterialInstanceDynamic* InMaterial)override;
+
+	static FName ValueParameterName;
+	static FName WaveParameterName;
 
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		FVector GetPosition()const { return position; }
@@ -59,6 +66,10 @@ private:
 		FRotator rotator;
 public:
 	virtual void ApplyProperty(class UUIText* InUIText, const FUIEffectTextAnimation_SelectResult& InSelection, UIGeometry* InGeometry) override;
+	virtual void ApplyMaterialParameter(UMaterialInstanceDynamic* InMaterial)override;
+
+	static FName ValueParameterName;
+	static FName WaveParameterName;
 
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		FRotator GetRotator()const { return rotator; }
@@ -77,10 +88,36 @@ private:
 		FVector scale = FVector::OneVector;
 public:
 	virtual void ApplyProperty(class UUIText* InUIText, const FUIEffectTextAnimation_SelectResult& InSelection, UIGeometry* InGeometry) override;
+	virtual void ApplyMaterialParameter(UMaterialInstanceDynamic* InMaterial)override;
+
+	static FName ValueParameterName;
+	static FName WaveParameterName;
 
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		FVector GetScale()const { return scale; }
 
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		void SetScale(FVector value);
-};
\ No newline at end of file
+};
+
+UCLASS(ClassGroup = (LGUI), BlueprintType, meta = (DisplayName = "AlphaWave Property (UI Effect TextAnimation)"))
+class LGUI_API UUIEffectTextAnimation_AlphaWaveProperty : public UUIEffectTextAnimation_PropertyWithWave
+{
+	GENERATED_BODY()
+private:
+	/** Alpha multiply value at the bottom of sin wave, 0-1 range. Result alpha will change between origin alpha and origin alpha * alpha. */
+	UPROPERTY(EditAnywhere, Category = "Property", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+		float alpha = 0.0f;
+public:
+	virtual void ApplyProperty(class UUIText* InUIText, const FUIEffectTextAnimation_SelectResult& InSelection, UIGeometry* InGeometry) override;
+	virtual void ApplyMaterialParameter(UMaterialInstanceDynamic* InMaterial)override;
+
+	static FName ValueParameterName;
+	static FName WaveParameterName;
+
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		float GetAlpha()const { return alpha; }
+
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		void SetAlpha(float value);
+};
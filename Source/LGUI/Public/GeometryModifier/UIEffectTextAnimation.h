@@ -6,6 +6,8 @@
 #include "LTweener.h"
 #include "UIEffectTextAnimation.generated.h"
 
+class UMaterialInstanceDynamic;
+
 struct FUIEffectTextAnimation_SelectResult
 {
 public:
@@ -47,11 +49,19 @@ class LGUI_API UUIEffectTextAnimation_Property : public UObject
 	GENERATED_BODY()
 protected:
 	class UUIText* GetUIText();
+	class UUIEffectTextAnimation* GetUIEffectTextAnimation();
+	/** Mark UIText to update geometry, or update material parameter if this property is driven by material. */
 	void MarkUITextPositionDirty();
+	/** Is this property driven by material now (UIEffectTextAnimation use GPU animation, and this property support it). */
+	bool IsDrivenByMaterial();
 public:
 	virtual void Init() {};
 	virtual void Deinit() {};
 	virtual void ApplyProperty(class UUIText* InUIText, const FUIEffectTextAnimation_SelectResult& InSelection, UIGeometry* InGeometry) PURE_VIRTUAL(UUIEffectTextAnimation_Property::ApplyEffect, );
+	/** Can this property be driven by material when UIEffectTextAnimation use GPU animation. */
+	virtual bool SupportGPUAnimation()const { return false; }
+	/** Set material parameters for GPU animation. Only called if SupportGPUAnimation return true. */
+	virtual void ApplyMaterialParameter(UMaterialInstanceDynamic* InMaterial) {};
 };
 
 //per character animation control for UIText
@@ -73,9 +83,29 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "LGUI")
 		mutable float selectorOffset = 0.0f;
 
+	/**
+	 * GPU animation. Per glyph data is baked into additional uv channel once when text geometry change, then properties which support GPU animation (wave properties) are driven by UIText's material with time, so no need to update geometry every frame.
+	 * UIText's CustomUIMaterial should read the baked data, see "/Plugin/LGUI/Private/LGUITextAnimation.ush". Properties not support GPU animation still apply on CPU.
+	 */
+	UPROPERTY(EditAnywhere, Category = "GPU Animation")
+		bool gpuAnimation = false;
+	/** Bake glyph index (x) and selector's value (y) into this uv channel. LGUICanvas/AdditionalShaderChannel should contains this uv channel. */
+	UPROPERTY(EditAnywhere, Category = "GPU Animation", meta = (ClampMin = "1", ClampMax = "3", EditCondition = "gpuAnimation"))
+		uint8 gpuAnimationUVChannel = 2;
+	/** Bake vertex position relative to glyph center into this uv channel, so material can rotate and scale glyph. 0 means not bake. LGUICanvas/AdditionalShaderChannel should contains this uv channel. */
+	UPROPERTY(EditAnywhere, Category = "GPU Animation", meta = (ClampMin = "0", ClampMax = "3", EditCondition = "gpuAnimation"))
+		uint8 gpuAnimationPivotUVChannel = 3;
+	/** MaterialInstanceDynamic created from UIText's CustomUIMaterial, so parameters will not affect other UI elements. */
+	UPROPERTY(Transient)TObjectPtr<UMaterialInstanceDynamic> gpuAnimationMaterial;
+	int32 gpuAnimationGlyphCount = 0;
+
 	UPROPERTY(Transient)TObjectPtr<class UUIText> uiText;
 	FUIEffectTextAnimation_SelectResult selection;
 	bool CheckUIText();
+	void InitProperties();
+	void DeinitProperties();
+	void BakeGPUAnimationData(UIGeometry& InGeometry, bool InHasSelection);
+	UMaterialInstanceDynamic* GetGPUAnimationMaterial();
 	virtual void BeginPlay()override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason)override;
 #if WITH_EDITOR
@@ -104,4 +134,22 @@ public:
 		void SetProperty(int index, UUIEffectTextAnimation_Property* value);
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
 		void SetSelectorOffset(float value);
+
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		bool GetGPUAnimation()const { return gpuAnimation; }
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		uint8 GetGPUAnimationUVChannel()const { return gpuAnimationUVChannel; }
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		uint8 GetGPUAnimationPivotUVChannel()const { return gpuAnimationPivotUVChannel; }
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		void SetGPUAnimation(bool value);
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		void SetGPUAnimationUVChannel(uint8 value);
+	UFUNCTION(BlueprintCallable, Category = "LGUI")
+		void SetGPUAnimationPivotUVChannel(uint8 value);
+	/** Set properties's parameters to material. Only valid when use GPU animation. */
+	void UpdateGPUAnimationMaterial();
+
+	/** Glyph count of UIText, for calculate normalized position in material */
+	static FName GlyphCountParameterName;
 };
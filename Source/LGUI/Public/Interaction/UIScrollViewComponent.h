@@ -15,6 +15,8 @@
 
 DECLARE_DYNAMIC_DELEGATE_OneParam(FLGUIScrollViewDynamicDelegate, FVector2D, InVector2);
 
+class ULGUICanvas;
+
 UCLASS(ClassGroup=(LGUI), Transient)
 class LGUI_API UUIScrollViewHelper :public ULGUILifeCycleUIBehaviour
 {
@@ -88,6 +90,13 @@ protected:
 	//progress, 0--1, x for horizontal, y for vertical
 	UPROPERTY(EditAnywhere, Category = "LGUI-ScrollView", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition="KeepProgress"))
 		FVector2D Progress = FVector2D(0, 0);
+	/**
+	 * Scroll by offset Content canvas's render result, instead of move Content. Need a LGUICanvas on Content, otherwise will still move Content.
+	 * When scrolling, UI elements inside Content are not moved, so no transform or vertex update, the cost is same for any element count.
+	 * The offset is applied to Content's location when scroll stop, begin drag, or Content not moved for a frame (eg: scrollbar released). Before that, raycaster take the offset, so UI elements are hit where they are rendered.
+	 */
+	UPROPERTY(EditAnywhere, Category = "LGUI-ScrollView")
+		bool ScrollByRenderOffset = false;
 
 	uint8 bAllowHorizontalScroll: 1, bAllowVerticalScroll: 1;
 	uint8 bCanUpdateAfterDrag: 1;
@@ -99,6 +108,15 @@ protected:
 	virtual bool CheckValidHit(USceneComponent* InHitComp);
 	UPROPERTY(Transient)TWeakObjectPtr<UUIItem> ContentUIItem = nullptr;//drag or scroll Content
 	UPROPERTY(Transient)TWeakObjectPtr<UUIItem> ContentParentUIItem = nullptr;//Content's parent
+	UPROPERTY(Transient)TWeakObjectPtr<ULGUICanvas> ContentCanvas = nullptr;//Content's canvas, only valid when ScrollByRenderOffset
+	void CheckContentCanvas();
+	/** Content's relative location, include render offset */
+	FVector GetContentPosition()const;
+	void SetContentPosition(const FVector& InPosition);
+	/** Apply render offset to Content's relative location */
+	void ApplyContentRenderOffset();
+	/** frame number when render offset is set */
+	uint64 ContentRenderOffsetFrame = 0;
 	virtual void UpdateProgress(bool InFireEvent = true);
 	FVector2D Velocity = FVector2D(0, 0);//drag speed
 	FVector2D HorizontalRange;//horizontal scroll range, x--min, y--max
@@ -154,6 +172,8 @@ public:
 		float GetOutOfRangeDamper()const { return OutOfRangeDamper; }
 	UFUNCTION(BlueprintCallable, Category = "LGUI-ScrollView")
 		FVector2D GetScrollProgress()const { return Progress; }
+	UFUNCTION(BlueprintCallable, Category = "LGUI-ScrollView")
+		bool GetScrollByRenderOffset()const { return ScrollByRenderOffset; }
 	/** Get Content's position range in horizontal. */
 	UFUNCTION(BlueprintCallable, Category = "LGUI-ScrollView")
 		FVector2D GetHorizontalRange()const { return HorizontalRange; }
@@ -179,6 +199,8 @@ public:
 		void SetRestrictRectArea(bool value);
 	UFUNCTION(BlueprintCallable, Category = "LGUI-ScrollView")
 		void SetOutOfRangeDamper(float value);
+	UFUNCTION(BlueprintCallable, Category = "LGUI-ScrollView")
+		void SetScrollByRenderOffset(bool value);
 
 	/** Mannually scroll it with delta value. */
 	UFUNCTION(BlueprintCallable, Category = "LGUI-ScrollView")
@@ -369,7 +369,22 @@ private:
 	void Cut();
 	void SelectAll();
 
-	FString GetReplaceText()const;
+	bool IsPasswordMode()const;
+	/** Text to show in UIText, password mask if in password mode */
+	const FString& GetReplaceText()const;
+	/** mask chars of password, only add or remove the changed count when text change */
+	mutable FString PasswordMaskText;
+	/**
+	 * Layout of full replace text with UIText's parameters, not rendered. Caret and visible range are calculated from it, so UIText only need to show the visible part.
+	 * Edit is applied to it in place, so only the edited lines layout again.
+	 */
+	FTextGeometryCache FullTextLayout;
+	/** FullTextLayout's content is not same as replace text, need to set it again */
+	bool bFullTextLayoutDirty = true;
+	/** @return false if layout is not available (no UIText, render canvas or font) */
+	bool UpdateFullTextLayout();
+	/** Remove and insert chars in Text, then apply the same change to FullTextLayout, so it only layout the edited lines */
+	void ReplaceTextRange(int32 InStartIndex, int32 InRemoveCount, const FString& InInsertString);
 
 	void UpdateAfterTextChange(bool InFireEvent = true);
 
@@ -10,6 +10,7 @@
 #include "LTweener.h"
 #include "Core/LGUISpriteData_BaseObject.h"
 #include "PrefabSystem/LGUIPrefab.h"
+#include "Core/LGUIProfiler.h"
 #include LGUIPREFAB_SERIALIZER_NEWEST_INCLUDE
 #include "LGUIBPLibrary.generated.h"
 
@@ -335,6 +336,20 @@ public:
 		static void LGUIEventDelegate_Name_Unregister(const FLGUIEventDelegate_Name& InEvent, const FLGUIDelegateHandleWrapper& InDelegateHandle);
 #pragma endregion EventDelegate
 
+#pragma region Profiler
+	/** Turn on/off LGUI profiler, same as console variable "lgui.Profiler.Enable" */
+	UFUNCTION(BlueprintCallable, Category = "LGUI|Profiler")
+		static void SetLGUIProfilerEnabled(bool InEnabled) { FLGUIProfiler::SetEnabled(InEnabled); }
+	UFUNCTION(BlueprintPure, Category = "LGUI|Profiler")
+		static bool IsLGUIProfilerEnabled() { return FLGUIProfiler::IsEnabled(); }
+	/** Get work done by LGUI in last finished frame. Profiler must be enabled. */
+	UFUNCTION(BlueprintCallable, Category = "LGUI|Profiler")
+		static FLGUIProfilerFrameStats GetLGUIProfilerLastFrameStats() { return FLGUIProfiler::GetLastFrameStats(); }
+	/** Write recorded frames to csv file, return true if success */
+	UFUNCTION(BlueprintCallable, Category = "LGUI|Profiler")
+		static bool DumpLGUIProfilerToCSV(const FString& InFilePath) { return FLGUIProfiler::DumpToCSV(InFilePath); }
+#pragma endregion Profiler
+
 	/** InComponentType must be the same as InLGUIComponentReference's component type */
 	UFUNCTION(BlueprintPure, Category = LGUI, meta = (DisplayName = "Get Component", CompactNodeTitle = "Component", BlueprintAutocast, DeterminesOutputType = "InComponentType"))
 		static UActorComponent* LGUICompRef_GetComponent(const FLGUIComponentReference& InLGUIComponentReference, TSubclassOf<UActorComponent> InComponentType);
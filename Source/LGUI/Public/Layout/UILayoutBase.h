@@ -56,11 +56,13 @@ public:
 	 * Mark this layout need to be rebuild. Same as MarkRebuildLayout(Interface call).
 	 */
 	UFUNCTION(BlueprintCallable, Category = "LGUI")
-		void MarkNeedRebuildLayout();
+		virtual void MarkNeedRebuildLayout();
 
 protected:
 
 	virtual void OnUIDimensionsChanged(bool horizontalPositionChanged, bool verticalPositionChanged, bool widthChanged, bool heightChanged)override;
+	/** Should this layout rebuild when it's own position or size change. Default is any change. */
+	virtual bool NeedRebuildLayoutOnDimensionsChanged(bool horizontalPositionChanged, bool verticalPositionChanged, bool widthChanged, bool heightChanged)const;
 	virtual void OnUIAttachmentChanged()override;
 	virtual void OnUIActiveInHierachy(bool activeOrInactive)override;
 
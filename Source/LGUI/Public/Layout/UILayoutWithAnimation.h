@@ -68,11 +68,38 @@ protected:
 	/** Will fallback to Immediately if object is not valid */
 	UPROPERTY(EditAnywhere, Instanced, Category = "LGUI", meta = (EditCondition = "AnimationType==EUILayoutAnimationType::Custom"))
 		TObjectPtr<UUILayoutWithAnimation_CustomAnimation> CustomAnimation;
+	/** Single tweener that drive all EaseAnimation of this layout, as a clock. */
 	UPROPERTY(Transient)
-		TArray<TObjectPtr<class ULTweener>> TweenerArray;
+		TObjectPtr<class ULTweener> EaseAnimationTweener = nullptr;
+
+	/** Start and end value of a target for EaseAnimation, only flagged value is animated. */
+	struct FEaseAnimationItem
+	{
+		TWeakObjectPtr<UUIItem> Target;
+		bool bAnimateAnchoredPosition = false;
+		bool bAnimateRotator = false;
+		bool bAnimateWidth = false;
+		bool bAnimateHeight = false;
+		bool bAnimateSizeDelta = false;
+		FVector2D StartAnchoredPosition = FVector2D::ZeroVector, EndAnchoredPosition = FVector2D::ZeroVector;
+		FRotator StartRotator = FRotator::ZeroRotator, EndRotator = FRotator::ZeroRotator;
+		float StartWidth = 0, EndWidth = 0;
+		float StartHeight = 0, EndHeight = 0;
+		FVector2D StartSizeDelta = FVector2D::ZeroVector, EndSizeDelta = FVector2D::ZeroVector;
+	};
+	/** Items of current EaseAnimation, array is reset but not freed, so relayout not need to allocate. */
+	TArray<FEaseAnimationItem> EaseAnimationItemArray;
+	FEaseAnimationItem& GetEaseAnimationItem(UUIItem* Target);
+	void UpdateEaseAnimation(float InProgress);
+	void OnEaseAnimationComplete();
+	/** Called when EaseAnimation complete and something changed during animation. */
+	virtual void MarkNeedRebuildLayoutAfterAnimation();
 
 	bool bIsAnimationPlaying = false;
 	bool bShouldRebuildLayoutAfterAnimation = false;
+	/** Values are set by EaseAnimation, not a change that need rebuild layout. */
+	bool bIsApplyingEaseAnimation = false;
+	virtual bool NeedRebuildLayoutOnDimensionsChanged(bool horizontalPositionChanged, bool verticalPositionChanged, bool widthChanged, bool heightChanged)const override;
 	/** Called before setup any animation when trying to calculate layout. Use this to initialize, eg cancel previous animations. */
 	virtual void BeginSetupAnimations();
 	virtual void ApplyAnchoredPositionWithAnimation(EUILayoutAnimationType AnimationType, FVector2D Value, UUIItem* Target);
@@ -22,6 +22,13 @@ protected:
 	{
 		TWeakObjectPtr<UUIItem> ChildUIItem;
 		TWeakObjectPtr<UObject> LayoutInterface;
+		/** Cached layout type of LayoutInterface, AutoSize if no LayoutInterface. Change layout type will rebuild children list, so no need to query it every time. */
+		ELayoutElementType LayoutType = ELayoutElementType::AutoSize;
+		/** Child's anchor, size and scale after last arrange, use it to tell if child's change is made by layout itself. */
+		bool bArranged = false;
+		FUIAnchorData ArrangedAnchorData;
+		FVector2D ArrangedSize = FVector2D::ZeroVector;
+		FVector ArrangedScale = FVector::OneVector;
 		bool operator == (const FLayoutChild& Other)const
 		{
 			return ChildUIItem.Get() == Other.ChildUIItem.Get();
@@ -30,12 +37,34 @@ protected:
 	mutable uint8 bNeedRebuildChildrenList : 1;
 	mutable uint8 bNeedSortChildrenList : 1;
 	mutable TArray<FLayoutChild> LayoutUIItemChildrenArray;
+	/** Children before this index keep result of last arrange, 0 means all children need to arrange, MAX_int32 means no child is dirty. */
+	mutable int32 DirtyChildIndex = 0;
+	/** Layout is applying size and position, dimensions change of children and self are caused by layout itself. */
+	uint8 bIsArrangingChildren : 1;
 
 	const TArray<FLayoutChild>& GetLayoutUIItemChildren()const;
 	void EnsureChildValid();
 	virtual void RebuildChildrenList()const;
 	virtual void SortChildrenList()const;
 	virtual void GetLayoutElement(UUIItem* InChild, UObject*& OutLayoutElement, bool& OutIgnoreLayout)const;
+	/** Collect layout element of child, return false if child is ignored by layout. */
+	bool MakeLayoutChild(UUIItem* InChild, FLayoutChild& OutChild)const;
+
+	/** Mark layout need to rebuild because of child's change. Children before it can keep last result, and if child's change is made by layout itself then nothing need to do. */
+	void MarkNeedRebuildLayoutFromChild(UUIItem* InChild);
+	/**
+	 * Get index of first child that need to arrange.
+	 * @param bCanArrangePartially	Child's size and position is only affected by children before it, so children before dirty one can keep last result.
+	 */
+	int32 GetArrangeStartIndex(bool bCanArrangePartially)const;
+	/** Call before apply size and position to children and self. */
+	void BeginArrangeChildren();
+	/** Call after apply size and position, cache result of children from InStartIndex. */
+	void EndArrangeChildren(int32 InStartIndex);
+
+	virtual bool NeedRebuildLayoutOnDimensionsChanged(bool horizontalPositionChanged, bool verticalPositionChanged, bool widthChanged, bool heightChanged)const override;
+	/** Keep DirtyChildIndex, so layout can still arrange partially after animation. */
+	virtual void MarkNeedRebuildLayoutAfterAnimation()override;
 
 	virtual void OnUIChildDimensionsChanged(UUIItem* child, bool horizontalPositionChanged, bool verticalPositionChanged, bool widthChanged, bool heightChanged)override;
 	virtual void OnUIChildAcitveInHierarchy(UUIItem* InChild, bool InUIActive)override;
@@ -45,5 +74,6 @@ public:
 	/** Mark layout children changed, so we need RebuildChildrenList when we need to. */
 	void MarkNeedRebuildChildrenList();
 	void MarkNeedSortChildrenList();
+	virtual void MarkNeedRebuildLayout()override;
 	virtual void MarkRebuildLayout_Implementation()override;
 };
@@ -152,6 +152,18 @@ namespace rbp {
 		binWidth = newWidth;
 		binHeight = newHeight;
 	}
+	bool MaxRectsBinPack::Free(const Rect& rect)
+	{
+		int foundIndex = usedRectangles.IndexOfByPredicate([&rect](const Rect& item) {
+			return item.x == rect.x && item.y == rect.y && item.width == rect.width && item.height == rect.height;
+			});
+		if (foundIndex == INDEX_NONE)
+			return false;
+		usedRectangles.RemoveAtSwap(foundIndex);
+		freeRectangles.Add(rect);
+		PruneFreeList();
+		return true;
+	}
 	void MaxRectsBinPack::PrepareExpendSizeForText(int newWidth, int newHeight, TArray<Rect>& outFreeRectangles, int cellSize, bool resetFreeAndUsedRects)
 	{
 		if (binWidth > newWidth || binHeight > newHeight)//new size is smaller
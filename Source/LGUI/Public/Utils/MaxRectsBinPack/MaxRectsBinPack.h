@@ -59,6 +59,10 @@ namespace rbp {
 		/// add by lexliu to expend the binpack size, for uitext, prevent too many small rects
 		void PrepareExpendSizeForText(int newWidth, int newHeight, TArray<Rect>& outFreeRectangles, int cellSize, bool resetFreeAndUsedRects = true);
 		void DoExpendSizeForText(Rect rect);
+		/// add by lexliu to release a used rect so the area can be used again.
+		/// Released area is not merged with neighbour free rects, so the bin become fragmented after many releases.
+		/// @return True if the rect is found in used rects.
+		bool Free(const Rect& rect);
 
 		/// Specifies the different heuristic rules that can be used when deciding where to place a new rectangle.
 		enum FreeRectChoiceHeuristic
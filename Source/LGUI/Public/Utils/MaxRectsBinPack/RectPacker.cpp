@@ -0,0 +1,108 @@
+﻿// Copyright 2019-Present LexLiu. All Rights Reserved.
+
+#include "RectPacker.h"
+#include "SkylineBinPack.h"
+#include "ShelfBinPack.h"
+#include "Core/LGUISettings.h"
+
+namespace rbp {
+
+	TSharedPtr<RectPacker> RectPacker::Create(ELGUIRectPackerType type)
+	{
+		switch (type)
+		{
+		default:
+		case ELGUIRectPackerType::MaxRects: return MakeShared<MaxRectsPacker>();
+		case ELGUIRectPackerType::Skyline: return MakeShared<SkylineBinPack>();
+		case ELGUIRectPackerType::Shelf: return MakeShared<ShelfBinPack>();
+		}
+	}
+
+	void MaxRectsPacker::Init(int width, int height)
+	{
+		binWidth = width;
+		binHeight = height;
+		usedSurfaceArea = 0;
+		freeCells.Reset();
+		if (cellSize > 0)
+		{
+			binPack.Init(cellSize, cellSize);
+			binPack.PrepareExpendSizeForText(width, height, freeCells, cellSize, false);
+		}
+		else
+		{
+			binPack.Init(width, height);
+		}
+	}
+	void MaxRectsPacker::ExpendSize(int newWidth, int newHeight)
+	{
+		if (binWidth > newWidth || binHeight > newHeight)//new size is smaller
+			return;
+		if (cellSize > 0)
+		{
+			//current cell is dropped, new cells are added at the end of the list so they are used first
+			binPack.PrepareExpendSizeForText(newWidth, newHeight, freeCells, cellSize);
+		}
+		else
+		{
+			binPack.ExpendSize(newWidth, newHeight);
+		}
+		binWidth = newWidth;
+		binHeight = newHeight;
+	}
+	Rect MaxRectsPacker::Insert(int width, int height)
+	{
+		while (true)
+		{
+			auto packedRect = binPack.Insert(width, height, MaxRectsBinPack::RectBestAreaFit);
+			if (packedRect.height > 0)
+			{
+				usedSurfaceArea += (int64)packedRect.width * packedRect.height;
+				return packedRect;
+			}
+			if (cellSize <= 0 || freeCells.Num() == 0 || width > cellSize || height > cellSize)
+			{
+				return packedRect;
+			}
+			//move to next cell
+			binPack.DoExpendSizeForText(freeCells.Pop(false));
+		}
+	}
+	bool MaxRectsPacker::Free(const Rect& rect)
+	{
+		usedSurfaceArea -= (int64)rect.width * rect.height;
+		if (cellSize > 0)
+		{
+			return false;//cell may be dropped already
+		}
+		return binPack.Free(rect);
+	}
+	float MaxRectsPacker::Occupancy() const
+	{
+		return binWidth > 0 && binHeight > 0 ? (float)((double)usedSurfaceArea / ((int64)binWidth * binHeight)) : 0.0f;
+	}
+
+	void BenchmarkRectPackers(const TArray<RectSize>& rects, int binSize, TArray<RectPackerBenchmarkResult>& outResults)
+	{
+		outResults.Reset();
+		for (auto type : { ELGUIRectPackerType::MaxRects, ELGUIRectPackerType::Skyline, ELGUIRectPackerType::Shelf })
+		{
+			auto packer = RectPacker::Create(type);
+			packer->Init(binSize, binSize);
+			RectPackerBenchmarkResult result;
+			result.type = type;
+			double startTime = FPlatformTime::Seconds();
+			for (auto& rectSize : rects)
+			{
+				if (packer->Insert(rectSize.width, rectSize.height).height <= 0)
+				{
+					break;
+				}
+				result.insertedCount++;
+			}
+			result.insertTime = (FPlatformTime::Seconds() - startTime) * 1000.0;
+			result.occupancy = packer->Occupancy();
+			outResults.Add(result);
+		}
+	}
+}
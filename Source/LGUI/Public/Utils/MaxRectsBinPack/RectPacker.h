@@ -0,0 +1,72 @@
+﻿// Copyright 2019-Present LexLiu. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MaxRectsBinPack.h"
+
+enum class ELGUIRectPackerType :uint8;
+
+namespace rbp {
+
+	/** Common interface of rect packing algorithms, so font and sprite atlas can choose which one to use. */
+	class LGUI_API RectPacker
+	{
+	public:
+		virtual ~RectPacker() {}
+
+		/// (Re)initializes the packer to an empty bin of width x height units.
+		virtual void Init(int width, int height) = 0;
+		/// Expend the bin size, packed rects stay where they are.
+		virtual void ExpendSize(int newWidth, int newHeight) = 0;
+		/// Inserts a single rectangle into the bin.
+		/// @return Packed rect, height is 0 if the rect can't fit.
+		virtual Rect Insert(int width, int height) = 0;
+		/// Release a packed rect.
+		/// @return True if the area can be used again, false if the packer can't reuse it until the bin is packed again.
+		virtual bool Free(const Rect& rect) = 0;
+		/// Computes the ratio of used surface area to the total bin area.
+		virtual float Occupancy() const = 0;
+
+		virtual int GetBinWidth()const = 0;
+		virtual int GetBinHeight()const = 0;
+
+		/// Create packer of the given type
+		static TSharedPtr<RectPacker> Create(ELGUIRectPackerType type);
+	};
+
+	/** RectPacker that use MaxRectsBinPack with RectBestAreaFit. */
+	class LGUI_API MaxRectsPacker : public RectPacker
+	{
+	public:
+		/// @param cellSize If larger than 0, only pack inside one cell of this size and move to next cell when it is full, this keeps free rect list small but leave unused area at the end of cells. Used by font texture.
+		MaxRectsPacker(int cellSize = 0) :cellSize(cellSize) {}
+
+		virtual void Init(int width, int height)override;
+		virtual void ExpendSize(int newWidth, int newHeight)override;
+		virtual Rect Insert(int width, int height)override;
+		virtual bool Free(const Rect& rect)override;
+		virtual float Occupancy() const override;
+		virtual int GetBinWidth()const override { return binWidth; }
+		virtual int GetBinHeight()const override { return binHeight; }
+	private:
+		MaxRectsBinPack binPack;
+		int cellSize = 0;
+		TArray<Rect> freeCells;
+		int binWidth = 0;
+		int binHeight = 0;
+		int64 usedSurfaceArea = 0;
+	};
+
+	struct RectPackerBenchmarkResult
+	{
+		ELGUIRectPackerType type;
+		/// Total insert time in milliseconds
+		double insertTime = 0;
+		/// Inserted rect count, stop at first rect that can't fit
+		int insertedCount = 0;
+		float occupancy = 0;
+	};
+	/// Insert rects into a bin of binSize x binSize with every packer type, and measure insert time and occupancy.
+	LGUI_API void BenchmarkRectPackers(const TArray<RectSize>& rects, int binSize, TArray<RectPackerBenchmarkResult>& outResults);
+}
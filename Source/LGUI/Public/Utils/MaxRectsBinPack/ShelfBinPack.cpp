@@ -0,0 +1,107 @@
+﻿// Copyright 2019-Present LexLiu. All Rights Reserved.
+
+#include "ShelfBinPack.h"
+
+namespace rbp {
+
+	void ShelfBinPack::Init(int width, int height)
+	{
+		binWidth = width;
+		binHeight = height;
+		usedSurfaceArea = 0;
+		nextShelfY = 0;
+		shelves.Reset();
+	}
+	void ShelfBinPack::ExpendSize(int newWidth, int newHeight)
+	{
+		if (binWidth > newWidth || binHeight > newHeight)//new size is smaller
+			return;
+		//shelves become wider, and more space for new shelves
+		binWidth = newWidth;
+		binHeight = newHeight;
+	}
+	Rect ShelfBinPack::Insert(int width, int height)
+	{
+		if (width > binWidth)
+		{
+			Rect newNode;
+			FMemory::Memset(&newNode, 0, sizeof(Rect));
+			return newNode;
+		}
+		int shelfIndex = FindShelf(width, height, true);
+		if (shelfIndex == INDEX_NONE)
+		{
+			if (nextShelfY + height <= binHeight)//open a new shelf
+			{
+				Shelf shelf;
+				shelf.y = nextShelfY;
+				shelf.height = height;
+				shelf.usedWidth = 0;
+				shelfIndex = shelves.Add(shelf);
+				nextShelfY += height;
+			}
+			else//no space for new shelf, use any shelf that can fit
+			{
+				shelfIndex = FindShelf(width, height, false);
+				if (shelfIndex == INDEX_NONE)
+				{
+					Rect newNode;
+					FMemory::Memset(&newNode, 0, sizeof(Rect));
+					return newNode;
+				}
+			}
+		}
+		return PlaceInShelf(shelfIndex, width, height);
+	}
+	bool ShelfBinPack::Free(const Rect& rect)
+	{
+		usedSurfaceArea -= (int64)rect.width * rect.height;
+		for (auto& shelf : shelves)
+		{
+			if (shelf.y == rect.y && shelf.usedWidth == rect.x + rect.width)
+			{
+				shelf.usedWidth = rect.x;
+				return true;
+			}
+		}
+		return false;
+	}
+	float ShelfBinPack::Occupancy() const
+	{
+		return binWidth > 0 && binHeight > 0 ? (float)((double)usedSurfaceArea / ((int64)binWidth * binHeight)) : 0.0f;
+	}
+
+	int ShelfBinPack::FindShelf(int width, int height, bool wasteLimit) const
+	{
+		int bestIndex = INDEX_NONE;
+		int bestHeight = MAX_int32;
+		for (int i = 0; i < shelves.Num(); ++i)
+		{
+			auto& shelf = shelves[i];
+			if (shelf.height < height || shelf.usedWidth + width > binWidth)
+				continue;
+			//allow 1/4 of shelf height to be wasted, glyphs of same font size usually differ only a few pixels
+			if (wasteLimit && (shelf.height - height) * 4 > shelf.height)
+				continue;
+			if (shelf.height < bestHeight)
+			{
+				bestHeight = shelf.height;
+				bestIndex = i;
+			}
+		}
+		return bestIndex;
+	}
+	Rect ShelfBinPack::PlaceInShelf(int shelfIndex, int width, int height)
+	{
+		auto& shelf = shelves[shelfIndex];
+		Rect newNode;
+		newNode.x = shelf.usedWidth;
+		newNode.y = shelf.y;
+		newNode.width = width;
+		newNode.height = height;
+		shelf.usedWidth += width;
+		usedSurfaceArea += (int64)width * height;
+		return newNode;
+	}
+
+}
@@ -0,0 +1,47 @@
+﻿// Copyright 2019-Present LexLiu. All Rights Reserved.
+
+/*
+	Shelf bin packer. Rects are placed left to right in horizontal shelves, a shelf's height is the height of the first rect placed in it.
+	Insert cost depends on shelf count, very fast for many rects with similar height, like glyphs of one font size.
+	Leave more unused area than MaxRects or Skyline when rect heights differ a lot.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RectPacker.h"
+
+namespace rbp {
+
+	class LGUI_API ShelfBinPack : public RectPacker
+	{
+	public:
+		virtual void Init(int width, int height)override;
+		virtual void ExpendSize(int newWidth, int newHeight)override;
+		virtual Rect Insert(int width, int height)override;
+		/// Only the last rect of a shelf can be released for use again.
+		virtual bool Free(const Rect& rect)override;
+		virtual float Occupancy() const override;
+		virtual int GetBinWidth()const override { return binWidth; }
+		virtual int GetBinHeight()const override { return binHeight; }
+	private:
+		struct Shelf
+		{
+			int y;
+			int height;
+			/// Width used from left side
+			int usedWidth;
+		};
+		TArray<Shelf> shelves;
+		/// Bottom of next new shelf
+		int nextShelfY = 0;
+		int binWidth = 0;
+		int binHeight = 0;
+		int64 usedSurfaceArea = 0;
+
+		/// Find the lowest shelf that can fit the rect. if wasteLimit is true then skip shelves that much higher than the rect.
+		int FindShelf(int width, int height, bool wasteLimit) const;
+		Rect PlaceInShelf(int shelfIndex, int width, int height);
+	};
+
+}
@@ -0,0 +1,145 @@
+﻿// Copyright 2019-Present LexLiu. All Rights Reserved.
+
+#include "SkylineBinPack.h"
+
+namespace rbp {
+
+	void SkylineBinPack::Init(int width, int height)
+	{
+		binWidth = width;
+		binHeight = height;
+		usedSurfaceArea = 0;
+		skyLine.Reset();
+		SkylineNode node;
+		node.x = 0;
+		node.y = 0;
+		node.width = width;
+		skyLine.Add(node);
+	}
+	void SkylineBinPack::ExpendSize(int newWidth, int newHeight)
+	{
+		if (binWidth > newWidth || binHeight > newHeight)//new size is smaller
+			return;
+		if (newWidth > binWidth)
+		{
+			//area on the right side is empty from bottom
+			SkylineNode node;
+			node.x = binWidth;
+			node.y = 0;
+			node.width = newWidth - binWidth;
+			skyLine.Add(node);
+			MergeSkylines();
+		}
+		binWidth = newWidth;
+		binHeight = newHeight;
+	}
+	Rect SkylineBinPack::Insert(int width, int height)
+	{
+		Rect newNode;
+		FMemory::Memset(&newNode, 0, sizeof(Rect));
+		int bestHeight = MAX_int32;
+		int bestWidth = MAX_int32;
+		int bestIndex = INDEX_NONE;
+		for (int i = 0; i < skyLine.Num(); ++i)
+		{
+			int y;
+			if (RectangleFits(i, width, height, y))
+			{
+				//lowest top edge first, then narrowest step
+				if (y + height < bestHeight || (y + height == bestHeight && skyLine[i].width < bestWidth))
+				{
+					bestHeight = y + height;
+					bestWidth = skyLine[i].width;
+					bestIndex = i;
+					newNode.x = skyLine[i].x;
+					newNode.y = y;
+					newNode.width = width;
+					newNode.height = height;
+				}
+			}
+		}
+		if (bestIndex == INDEX_NONE)
+			return newNode;
+
+		AddSkylineLevel(bestIndex, newNode);
+		usedSurfaceArea += (int64)width * height;
+		return newNode;
+	}
+	bool SkylineBinPack::Free(const Rect& rect)
+	{
+		usedSurfaceArea -= (int64)rect.width * rect.height;
+		return false;
+	}
+	float SkylineBinPack::Occupancy() const
+	{
+		return binWidth > 0 && binHeight > 0 ? (float)((double)usedSurfaceArea / ((int64)binWidth * binHeight)) : 0.0f;
+	}
+
+	bool SkylineBinPack::RectangleFits(int skylineNodeIndex, int width, int height, int& outY) const
+	{
+		int x = skyLine[skylineNodeIndex].x;
+		if (x + width > binWidth)
+			return false;
+		int widthLeft = width;
+		int i = skylineNodeIndex;
+		outY = skyLine[skylineNodeIndex].y;
+		while (widthLeft > 0)
+		{
+			outY = FMath::Max(outY, skyLine[i].y);
+			if (outY + height > binHeight)
+				return false;
+			widthLeft -= skyLine[i].width;
+			++i;
+			check(i < skyLine.Num() || widthLeft <= 0);
+		}
+		return true;
+	}
+	void SkylineBinPack::AddSkylineLevel(int skylineNodeIndex, const Rect& rect)
+	{
+		SkylineNode newNode;
+		newNode.x = rect.x;
+		newNode.y = rect.y + rect.height;
+		newNode.width = rect.width;
+		skyLine.Insert(newNode, skylineNodeIndex);
+
+		//shrink or remove nodes that covered by the new node
+		for (int i = skylineNodeIndex + 1; i < skyLine.Num(); ++i)
+		{
+			auto& prevNode = skyLine[i - 1];
+			auto& node = skyLine[i];
+			if (node.x < prevNode.x + prevNode.width)
+			{
+				int shrink = prevNode.x + prevNode.width - node.x;
+				node.x += shrink;
+				node.width -= shrink;
+				if (node.width <= 0)
+				{
+					skyLine.RemoveAt(i);
+					--i;
+				}
+				else
+				{
+					break;
+				}
+			}
+			else
+			{
+				break;
+			}
+		}
+		MergeSkylines();
+	}
+	void SkylineBinPack::MergeSkylines()
+	{
+		for (int i = 0; i < skyLine.Num() - 1; ++i)
+		{
+			if (skyLine[i].y == skyLine[i + 1].y)
+			{
+				skyLine[i].width += skyLine[i + 1].width;
+				skyLine.RemoveAt(i + 1);
+				--i;
+			}
+		}
+	}
+
+}
@@ -0,0 +1,49 @@
+﻿// Copyright 2019-Present LexLiu. All Rights Reserved.
+
+/*
+	Skyline bottom-left bin packer, based on SkylineBinPack by Jukka Jylänki (public domain).
+	Only keep the top edge of packed rects, so insert cost depends on how many steps the skyline have, not on packed rect count.
+	Good for many small rects with similar size, like glyphs. Released area can't be used again until the bin is packed again.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RectPacker.h"
+
+namespace rbp {
+
+	class LGUI_API SkylineBinPack : public RectPacker
+	{
+	public:
+		virtual void Init(int width, int height)override;
+		virtual void ExpendSize(int newWidth, int newHeight)override;
+		virtual Rect Insert(int width, int height)override;
+		virtual bool Free(const Rect& rect)override;
+		virtual float Occupancy() const override;
+		virtual int GetBinWidth()const override { return binWidth; }
+		virtual int GetBinHeight()const override { return binHeight; }
+	private:
+		/// Represents a single level (a horizontal line) of the skyline/horizon/envelope.
+		struct SkylineNode
+		{
+			/// The starting x-coordinate (leftmost).
+			int x;
+			/// The y-coordinate of the skyline level line.
+			int y;
+			/// The line width. The ending coordinate (inclusive) will be x+width-1.
+			int width;
+		};
+		TArray<SkylineNode> skyLine;
+		int binWidth = 0;
+		int binHeight = 0;
+		int64 usedSurfaceArea = 0;
+
+		/// @return True if the rect can be placed with left side at skyLine[skylineNodeIndex], outY is the bottom of placed rect.
+		bool RectangleFits(int skylineNodeIndex, int width, int height, int& outY) const;
+		void AddSkylineLevel(int skylineNodeIndex, const Rect& rect);
+		/// Merges all skyline nodes that are at the same level.
+		void MergeSkylines();
+	};
+
+}